@@ -214,7 +214,9 @@ SRC_OS += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/croutine.c
 SRC_OS += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/event_groups.c
 SRC_OS += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/list.c
 SRC_OS += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/portable/Keil/ARM968es/port.c
-ifeq ("${CfG_ENABLE_HEAP_5}", "1")
+ifeq ("${CFG_HEAP_TLSF}", "1")
+SRC_OS += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/portable/MemMang/heap_tlsf.c
+else ifeq ("${CfG_ENABLE_HEAP_5}", "1")
 SRC_OS += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/portable/MemMang/heap_5.c
 else
 SRC_OS += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/portable/MemMang/heap_4.c
@@ -67,6 +67,37 @@ beken_semaphore_t app_sema = NULL;
 WIFI_CORE_T g_wifi_core = {0};
 volatile int32_t bmsg_rx_count = 0;
 
+#if CFG_WIFI_TX_BATCH
+/*
+ * Single producer/single consumer ring between lwip (serialized by the tcpip
+ * core lock) and the core thread. Only the first frame of a burst posts a
+ * BMSG_TX_BATCH_TYPE message, the core thread then drains up to
+ * CFG_WIFI_TX_BATCH_NUM frames per message and runs ke scheduler once.
+ */
+#define TX_RING_MASK              (CFG_WIFI_TX_RING_LEN - 1)
+#define TX_RING_BARRIER()         __asm volatile("" ::: "memory")
+
+typedef struct _tx_ring_slot_
+{
+    struct pbuf *p;
+    uint32_t vif_idx;
+    void *node;                         // pool node taken by bmsg_tx_sender
+} TX_RING_SLOT_T;
+
+typedef struct _tx_ring_
+{
+    TX_RING_SLOT_T slot[CFG_WIFI_TX_RING_LEN];
+    volatile uint32_t head;             // written by the producer only
+    volatile uint32_t tail;             // written by the core thread only
+    volatile uint32_t kick_pending;     // a BMSG_TX_BATCH_TYPE message is queued
+    volatile uint32_t kick_lost;        // the queue was full, the core thread drains on its next message
+    volatile uint32_t producer_waiting;
+    beken_semaphore_t space_sema;
+} TX_RING_T;
+
+static TX_RING_T g_tx_ring = {0};
+#endif
+
 extern void net_wlan_initial(void);
 extern void wpas_thread_start(void);
 extern void extended_app_waiting_for_launch(void);
@@ -143,15 +174,40 @@ void bmsg_skt_tx_handler(BUS_MSG_T *msg)
     hapd_intf_ke_rx_handle(msg->arg);
 }
 
+static void bmsg_tx_wakeup(void)
+{
+    ps_set_data_prevent();
+
+#if CFG_USE_STA_PS
+    bmsg_ps_handler_rf_ps_mode_real_wakeup();
+    bk_wlan_dtim_rf_ps_mode_do_wakeup();
+#endif
+}
+
 void bmsg_tx_handler(BUS_MSG_T *msg)
 {
     struct pbuf *p = (struct pbuf *)msg->arg;
     struct pbuf *q = p;
     uint8_t vif_idx = (uint8_t)msg->len;
+#if CFG_MSDU_TX_POOL
+    MSDU_NODE_T *node = (MSDU_NODE_T *)msg->param;
+
+    if(node)
+    {
+        /* node was taken from the pool by bmsg_tx_sender, gather the chain straight into it */
+        pbuf_copy_partial(p, rwm_get_msdu_content_ptr(node), p->tot_len, 0);
+        pbuf_free(p);
+
+        bmsg_tx_wakeup();
+        rwm_transfer_msdu(vif_idx, node, 0, 0);
+        return;
+    }
+#endif
 
     if(p->next)
     {
-        q = pbuf_coalesce(p, PBUF_RAW);
+        /* keep the encapsulation head room, so the result can go out in place */
+        q = pbuf_coalesce(p, PBUF_RAW_TX);
         if(q == p)
         {
             // must be out of memory
@@ -159,11 +215,14 @@ void bmsg_tx_handler(BUS_MSG_T *msg)
         }
     }
 
-    ps_set_data_prevent();
+    bmsg_tx_wakeup();
 
-#if CFG_USE_STA_PS
-    bmsg_ps_handler_rf_ps_mode_real_wakeup();
-    bk_wlan_dtim_rf_ps_mode_do_wakeup();
+#if CFG_WIFI_TX_ZERO_COPY
+    if(RW_SUCCESS == rwm_transfer_pbuf(vif_idx, q))
+    {
+        /* pbuf reference is owned by the msdu node, released in rwm_tx_confirm */
+        return;
+    }
 #endif
 
     rwm_transfer(vif_idx, q->payload, q->len, 0, 0);
@@ -172,6 +231,134 @@ tx_handler_exit:
     pbuf_free(q);
 }
 
+#if CFG_WIFI_TX_BATCH
+static void bmsg_tx_ring_kick(void)
+{
+    OSStatus ret;
+    BUS_MSG_T msg;
+
+    msg.type = BMSG_TX_BATCH_TYPE;
+    msg.arg = 0;
+    msg.len = 0;
+    msg.sema = NULL;
+
+    ret = rtos_push_to_queue(&g_wifi_core.io_queue, &msg, BEKEN_NO_WAIT);
+    if(kNoErr != ret)
+    {
+        // the full queue keeps the core thread busy, it picks the ring up
+        // after its next message. kick_pending stays set meanwhile.
+        g_tx_ring.kick_lost = 1;
+        APP_PRT("bmsg_tx_ring_kick failed\r\n");
+    }
+}
+
+static int bmsg_tx_ring_push(struct pbuf *p, uint32_t vif_idx, void *node)
+{
+    uint32_t head = g_tx_ring.head;
+    TX_RING_SLOT_T *slot;
+
+    while((head - g_tx_ring.tail) >= CFG_WIFI_TX_RING_LEN)
+    {
+        if(!g_tx_ring.kick_pending)
+        {
+            g_tx_ring.kick_pending = 1;
+            bmsg_tx_ring_kick();
+        }
+
+        g_tx_ring.producer_waiting = 1;
+        TX_RING_BARRIER();
+        if((head - g_tx_ring.tail) < CFG_WIFI_TX_RING_LEN)
+        {
+            break;
+        }
+
+        if(kNoErr != rtos_get_semaphore(&g_tx_ring.space_sema, 1 * SECONDS))
+        {
+            g_tx_ring.producer_waiting = 0;
+            return -1;
+        }
+    }
+
+    slot = &g_tx_ring.slot[head & TX_RING_MASK];
+    slot->p = p;
+    slot->vif_idx = vif_idx;
+    slot->node = node;
+    TX_RING_BARRIER();
+    g_tx_ring.head = head + 1;
+    TX_RING_BARRIER();
+
+    if(!g_tx_ring.kick_pending)
+    {
+        g_tx_ring.kick_pending = 1;
+        bmsg_tx_ring_kick();
+    }
+
+    return 0;
+}
+
+void bmsg_tx_batch_handler(BUS_MSG_T *msg)
+{
+    BUS_MSG_T tx_msg;
+    TX_RING_SLOT_T *slot;
+    uint32_t tail = g_tx_ring.tail;
+    uint32_t count = 0;
+
+    while((tail != g_tx_ring.head) && (count < CFG_WIFI_TX_BATCH_NUM))
+    {
+        slot = &g_tx_ring.slot[tail & TX_RING_MASK];
+        tx_msg.arg = (uint32_t)slot->p;
+        tx_msg.len = slot->vif_idx;
+        tx_msg.param = slot->node;
+        TX_RING_BARRIER();
+        g_tx_ring.tail = ++ tail;
+
+        bmsg_tx_handler(&tx_msg);
+        count ++;
+    }
+
+    if(g_tx_ring.producer_waiting)
+    {
+        g_tx_ring.producer_waiting = 0;
+        rtos_set_semaphore(&g_tx_ring.space_sema);
+    }
+
+    if(tail != g_tx_ring.head)
+    {
+        // requeue behind rx/ioctl messages instead of starving them
+        bmsg_tx_ring_kick();
+        return;
+    }
+
+    g_tx_ring.kick_pending = 0;
+    TX_RING_BARRIER();
+    if(tail != g_tx_ring.head)
+    {
+        // raced with a producer that still saw kick_pending set
+        g_tx_ring.kick_pending = 1;
+        bmsg_tx_ring_kick();
+    }
+}
+
+static void bmsg_tx_ring_flush(void)
+{
+    TX_RING_SLOT_T *slot;
+
+    while(g_tx_ring.tail != g_tx_ring.head)
+    {
+        slot = &g_tx_ring.slot[g_tx_ring.tail & TX_RING_MASK];
+        if(slot->node)
+        {
+            rwm_node_free((MSDU_NODE_T *)slot->node);
+        }
+        pbuf_free(slot->p);
+        g_tx_ring.tail ++;
+    }
+    g_tx_ring.kick_pending = 0;
+    g_tx_ring.kick_lost = 0;
+    g_tx_ring.producer_waiting = 0;
+}
+#endif
+
 void bmsg_tx_raw_cb_handler(BUS_MSG_T *msg)
 {
 	rwm_raw_frame_with_cb((uint8_t *)msg->arg, msg->len, msg->cb, msg->param);
@@ -465,12 +652,51 @@ int bmsg_tx_sender(struct pbuf *p, uint32_t vif_idx)
     msg.arg = (uint32_t)p;
     msg.len = vif_idx;
     msg.sema = NULL;
+    msg.cb = NULL;
+    msg.param = NULL;
+
+#if CFG_MSDU_TX_POOL
+    /* take the tx node here, so that a dry pool is pushed back to lwip */
+#if CFG_WIFI_TX_ZERO_COPY
+    if(!rwm_tx_pbuf_in_place(p))
+#endif
+    {
+        msg.param = rwm_tx_node_alloc_data(p->tot_len);
+        if(NULL == msg.param)
+        {
+            return kNoMemoryErr;
+        }
+    }
+#endif
 
     pbuf_ref(p);
+#if CFG_WIFI_TX_BATCH
+    /* lwip is the only producer of the ring, frames forwarded by the
+       core thread itself (softap bridging) keep using the message queue */
+    if(!rtos_is_current_thread(&g_wifi_core.handle))
+    {
+        ret = bmsg_tx_ring_push(p, vif_idx, msg.param);
+        if(kNoErr != ret)
+        {
+            APP_PRT("bmsg_tx_sender failed\r\n");
+            if(msg.param)
+            {
+                rwm_node_free((MSDU_NODE_T *)msg.param);
+            }
+            pbuf_free(p);
+        }
+
+        return ret;
+    }
+#endif
     ret = rtos_push_to_queue(&g_wifi_core.io_queue, &msg, 1 * SECONDS);
     if(kNoErr != ret)
     {
         APP_PRT("bmsg_tx_sender failed\r\n");
+        if(msg.param)
+        {
+            rwm_node_free((MSDU_NODE_T *)msg.param);
+        }
         pbuf_free(p);
     }
 
@@ -691,6 +917,12 @@ static void core_thread_main( void *arg )
 				bmsg_rx_lsig_handler(&msg);
 				break;
 #endif
+
+#if CFG_WIFI_TX_BATCH
+            case BMSG_TX_BATCH_TYPE:
+                bmsg_tx_batch_handler(&msg);
+                break;
+#endif
             default:
                 APP_PRT("unknown_msg\r\n");
                 break;
@@ -700,6 +932,13 @@ static void core_thread_main( void *arg )
             {
                 rtos_set_semaphore(&msg.sema);
             }
+#if CFG_WIFI_TX_BATCH
+            if(g_tx_ring.kick_lost)
+            {
+                g_tx_ring.kick_lost = 0;
+                bmsg_tx_batch_handler(NULL);
+            }
+#endif
             if(!ke_skip)
                 ke_evt_core_scheduler();
             else
@@ -735,6 +974,15 @@ void core_thread_init(void)
         goto fail;
     }
 
+#if CFG_WIFI_TX_BATCH
+    ret = rtos_init_semaphore(&g_tx_ring.space_sema, 1);
+    if (kNoErr != ret)
+    {
+        os_printf("Create tx ring sema failed\r\n");
+        goto fail;
+    }
+#endif
+
     ret = rtos_create_thread(&g_wifi_core.handle,
                              THD_CORE_PRIORITY,
                              "core_thread",
@@ -769,6 +1017,15 @@ void core_thread_uninit(void)
         g_wifi_core.io_queue = 0;
     }
 
+#if CFG_WIFI_TX_BATCH
+    bmsg_tx_ring_flush();
+    if(g_tx_ring.space_sema)
+    {
+        rtos_deinit_semaphore(&g_tx_ring.space_sema);
+        g_tx_ring.space_sema = NULL;
+    }
+#endif
+
     g_wifi_core.queue_item_count = 0;
     g_wifi_core.stack_size = 0;
 }
@@ -892,6 +1149,12 @@ int bmsg_is_empty(void)
     {
         return 0;
     }
+#if CFG_WIFI_TX_BATCH
+    else if(g_tx_ring.tail != g_tx_ring.head)
+    {
+        return 0;
+    }
+#endif
     else
     {
         return 1;
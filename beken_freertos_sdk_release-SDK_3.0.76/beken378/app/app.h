@@ -35,6 +35,10 @@ enum
 #if (SUPPORT_LSIG_MONITOR)
     BMSG_RX_LSIG = 10,      /* phy receive 802.11 LSIG*/
 #endif
+
+#if CFG_WIFI_TX_BATCH
+    BMSG_TX_BATCH_TYPE      = 11,   /* drain the tx ring */
+#endif
 };
 
 typedef struct bus_message
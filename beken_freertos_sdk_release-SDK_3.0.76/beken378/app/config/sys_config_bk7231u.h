@@ -250,6 +250,8 @@
 #endif
 #define CFG_USE_HSLAVE_SPI                         0
 #define CFG_USE_SPIDMA                             0
+/* camera dma writes into the video pool, frames queued as a ring */
+#define CFG_VIDEO_DMA_FRAME_RING                   0
 
 #if CFG_USE_CAMERA_INTF
 #define CFG_USE_I2C1                               1
@@ -9,6 +9,8 @@
 #define CFG_JTAG_ENABLE                            0
 #define OSMALLOC_STATISTICAL                       0
 #define CFG_MEM_DEBUG                              0
+/* tlsf heap instead of heap_4: bounded time malloc/free, good fit */
+#define CFG_HEAP_TLSF                              0
 
 /*section 0-----app macro config-----*/
 #define CFG_IEEE80211N                             1
@@ -53,7 +55,13 @@
 
 /*section 2-----function macro config-----*/
 #define CFG_SUPPORT_MATTER                         0
+/* append-only log backend for the matter kv flash, it changes the on-flash layout */
+#define CFG_FLASH_KV_LOG                           0
 #define CFG_RWNX_REODER                            0
+#if CFG_RWNX_REODER
+#define CFG_RWNX_REORD_SESSION_NUM                 4  // concurrent [sta, tid] block ack sessions
+#define CFG_RWNX_REORD_WIN_MAX                     32 // caps the addba buffer size, at most 32
+#endif
 #define CFG_FORCE_RATE                             0
 #define CFG_TX_EVM_TEST                            1
 #define CFG_RX_SENSITIVITY_TEST                    1
@@ -74,6 +82,8 @@
 #if (CFG_WLAN_FAST_CONNECT_STATIC_IP && CFG_WLAN_SUPPORT_FAST_DHCP)
 #error "static ip support and fast dhcp support cannot be opened at the same time"
 #endif
+/* remember this many networks for fast connect, 0 keeps only the last one */
+#define CFG_WLAN_FAST_CONNECT_PROFILES             0
 #endif
 #define CFG_WPA2_ENTERPRISE                        0
 #define CFG_WPA3_ENTERPRISE                        0
@@ -157,6 +167,10 @@
 #if CFG_USE_MBEDTLS
 #define CFG_MBEDTLS                                1
 #endif
+/* resume tls client sessions, kept in easyflash when CFG_EASY_FLASH */
+#define CFG_TLS_SESSION_RESUME                     0
+#define CFG_TLS_SESSION_MAX_USES                   24
+#define CFG_TLS_SESSION_RAM_SLOTS                  2
 #if CFG_QUICK_TRACK
 #define _DUT_                                      1
 #endif
@@ -177,7 +191,48 @@
 #define CFG_MSDU_RESV_HEAD_LEN                     96
 #define CFG_MSDU_RESV_TAIL_LEN                     16
 
+/* transmit lwip pbufs in place instead of copying them into a new msdu node */
+#define CFG_WIFI_TX_ZERO_COPY                      0
+#if (CFG_SUPPORT_MATTER)
+#undef CFG_WIFI_TX_ZERO_COPY
+#define CFG_WIFI_TX_ZERO_COPY                      0
+#endif
+#if CFG_WIFI_TX_ZERO_COPY
+#define CFG_MSDU_RESV_NODE_LEN                     36 // msdu node, and up to 3 bytes to word align it
+#endif
+
+/* hand tx frames to the core thread through a ring, drained in batches */
+#define CFG_WIFI_TX_BATCH                          0
+#if CFG_WIFI_TX_BATCH
+#define CFG_WIFI_TX_RING_LEN                       32 // power of 2
+#define CFG_WIFI_TX_BATCH_NUM                      8  // frames per core thread wakeup
+#endif
+
+/* preallocated tx msdu nodes, a dry pool returns ERR_MEM to lwip */
+#define CFG_MSDU_TX_POOL                           0
+#if CFG_MSDU_TX_POOL
+#define CFG_MSDU_POOL_SMALL_LEN                    128
+#define CFG_MSDU_POOL_SMALL_CNT                    16
+#define CFG_MSDU_POOL_MIDDLE_LEN                   512
+#define CFG_MSDU_POOL_MIDDLE_CNT                   8
+#define CFG_MSDU_POOL_LARGE_LEN                    1600
+#define CFG_MSDU_POOL_LARGE_CNT                    16
+#endif
+
+/* deliver a-msdu subframes as pbufs referencing the received mpdu, no copy */
+#define CFG_WIFI_RX_AMSDU_ZERO_COPY                0
+#if CFG_WIFI_RX_AMSDU_ZERO_COPY
+#define CFG_AMSDU_RX_REF_NUM                       16 // subframes in flight in lwip
+#endif
+
 #define CFG_USE_USB_HOST                           0
+/* sector cache under fatfs for the usb disk: read-ahead and write-back */
+#define CFG_FATFS_DISK_CACHE                       0
+#if CFG_FATFS_DISK_CACHE
+#define CFG_FATFS_CACHE_LINES                      8  // lines, os_malloc'ed
+#define CFG_FATFS_CACHE_LINE_SECTORS               8  // 512 byte sectors per line, at most 32
+#define CFG_FATFS_CACHE_READAHEAD                  2  // extra lines filled by a sequential miss
+#endif
 
 #define CFG_USB                                    0
 #if CFG_USB
@@ -190,6 +245,7 @@
 
 /*section 4-----DEBUG macro config-----*/
 #define CFG_UART_DEBUG                             0
+#define CFG_UART_DEFERRED_LOG                      0
 #define CFG_SUPPORT_BKREG                          1
 #define CFG_ENABLE_WPA_LOG                         0
 #define IPERF_CLOSE                                0  /* close iperf */
@@ -261,6 +317,7 @@
 
 /*section 13-----for GENERRAL DMA */
 #define CFG_GENERAL_DMA                            1
+#define CFG_GDMA_ASYNC                             0
 
 /*section 14-----for FTPD UPGRADE*/
 #define CFG_USE_FTPD_UPGRADE                       0
@@ -304,6 +361,9 @@
 
 /*section 20 ----- support mp3 decoder*/
 #define CONFIG_APP_MP3PLAYER                       0
+#define CFG_MP3_PIPELINE                           0
+#define CFG_MP3_PIPE_READ_BUF                      (16 * 1024)
+#define CFG_MP3_PIPE_FRAMES                        4
 
 /*section 21 ----- support ota*/
 #if( ( CFG_SUPPORT_ALIOS ) || ( CFG_SUPPORT_RTT ) || (CFG_SUPPORT_MATTER == 1))
@@ -312,6 +372,10 @@
 #define CFG_SUPPORT_OTA_HTTP                       1
 #endif
 #define CFG_SUPPORT_OTA_TFTP                       0
+/* http ota: write the image from a writer task with erase-ahead and a sha256 */
+#define CFG_HTTP_OTA_PIPELINE                      0
+/* http ota: resume an interrupted download with Range, needs CFG_HTTP_OTA_PIPELINE */
+#define CFG_HTTP_OTA_RESUME                        0
 
 /*section 23 ----- support reduce nomal power*/
 #define CFG_SYS_REDUCE_NORMAL_POWER                0
@@ -327,6 +391,8 @@
 #define CFG_USE_AUDIO                              0
 #define CFG_USE_AUD_DAC                            0
 #define CFG_USE_AUD_ADC                            0
+#define CFG_TVOICE_CODEC                           0   /* 0 raw, 1 framed pcm, 2 framed ima adpcm */
+#define CFG_TVOICE_VAD                             0
 
 /*section 25 ----- use tick time calibrate*/
 #define CFG_USE_TICK_CAL                           1
@@ -252,6 +252,8 @@
 #endif
 #define CFG_USE_HSLAVE_SPI                         0
 #define CFG_USE_SPIDMA                             0
+/* camera dma writes into the video pool, frames queued as a ring */
+#define CFG_VIDEO_DMA_FRAME_RING                   0
 #if CFG_USE_CAMERA_INTF
 #define CFG_USE_I2C1                               1
 #define CFG_USE_I2C2                               0
@@ -374,6 +376,8 @@
 
 /*section 28 ----- hardware security: aes/sha/rsa */
 #define CFG_USE_SECURITY                           0
+/* mbedtls aes (cbc/ctr/gcm/ccm) on the security engine */
+#define CFG_MBEDTLS_AES_HW                         0
 
 #define CFG_USE_FFT                                0
 #define CFG_USE_I2S                                0
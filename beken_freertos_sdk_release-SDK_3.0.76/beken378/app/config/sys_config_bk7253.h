@@ -54,6 +54,8 @@
 
 /*section 2-----function macro config-----*/
 #define CFG_SUPPORT_MATTER                         0
+/* append-only log backend for the matter kv flash, it changes the on-flash layout */
+#define CFG_FLASH_KV_LOG                           0
 
 #define CFG_TX_EVM_TEST                            1
 #define CFG_RX_SENSITIVITY_TEST                    1
@@ -148,6 +150,10 @@
 #if CFG_USE_MBEDTLS
 #define CFG_MBEDTLS                                1
 #endif
+/* resume tls client sessions, kept in easyflash when CFG_EASY_FLASH */
+#define CFG_TLS_SESSION_RESUME                     0
+#define CFG_TLS_SESSION_MAX_USES                   24
+#define CFG_TLS_SESSION_RAM_SLOTS                  2
 #if CFG_QUICK_TRACK
 #define _DUT_                                      1
 #endif
@@ -173,6 +179,13 @@
 #define CFG_MSDU_RESV_TAIL_LEN                     16
 
 #define CFG_USE_USB_HOST                           0
+/* sector cache under fatfs for the usb disk: read-ahead and write-back */
+#define CFG_FATFS_DISK_CACHE                       0
+#if CFG_FATFS_DISK_CACHE
+#define CFG_FATFS_CACHE_LINES                      8  // lines, os_malloc'ed
+#define CFG_FATFS_CACHE_LINE_SECTORS               8  // 512 byte sectors per line, at most 32
+#define CFG_FATFS_CACHE_READAHEAD                  2  // extra lines filled by a sequential miss
+#endif
 
 #define CFG_USB                                    0
 #if CFG_USB
@@ -186,6 +199,7 @@
 
 /*section 4-----DEBUG macro config-----*/
 #define CFG_UART_DEBUG                             0
+#define CFG_UART_DEFERRED_LOG                      0
 #define CFG_SUPPORT_BKREG                          1
 #define CFG_ENABLE_WPA_LOG                         0
 #define CFG_TCP_SERVER_TEST                        0
@@ -256,6 +270,8 @@
 #endif
 #define CFG_USE_HSLAVE_SPI                         0
 #define CFG_USE_SPIDMA                             0
+/* camera dma writes into the video pool, frames queued as a ring */
+#define CFG_VIDEO_DMA_FRAME_RING                   0
 #if CFG_USE_CAMERA_INTF
 #define CFG_USE_I2C1                               1
 #define CFG_USE_I2C2                               0
@@ -320,6 +336,9 @@
 
 /*section 20 ----- support mp3 decoder*/
 #define CONFIG_APP_MP3PLAYER                       0
+#define CFG_MP3_PIPELINE                           0
+#define CFG_MP3_PIPE_READ_BUF                      (16 * 1024)
+#define CFG_MP3_PIPE_FRAMES                        4
 
 /*section 21 ----- support ota*/
 #if( ( CFG_SUPPORT_ALIOS ) || ( CFG_SUPPORT_RTT ) || (CFG_SUPPORT_MATTER == 1))
@@ -328,6 +347,10 @@
 #define CFG_SUPPORT_OTA_HTTP                       1
 #endif
 #define CFG_SUPPORT_OTA_TFTP                       0
+/* http ota: write the image from a writer task with erase-ahead and a sha256 */
+#define CFG_HTTP_OTA_PIPELINE                      0
+/* http ota: resume an interrupted download with Range, needs CFG_HTTP_OTA_PIPELINE */
+#define CFG_HTTP_OTA_RESUME                        0
 
 /*section 23 ----- support reduce nomal power*/
 #define CFG_SYS_REDUCE_NORMAL_POWER                0
@@ -343,6 +366,8 @@
 #define CFG_USE_AUDIO                              1
 #define CFG_USE_AUD_DAC                            1
 #define CFG_USE_AUD_ADC                            1
+#define CFG_TVOICE_CODEC                           0   /* 0 raw, 1 framed pcm, 2 framed ima adpcm */
+#define CFG_TVOICE_VAD                             0
 
 /*section 25 ----- use tick time calibrate*/
 #define CFG_USE_TICK_CAL                           1
@@ -409,6 +434,8 @@
 #endif
 /* enable hw ip checksum */
 #define CFG_LWIP_HW_CSUM                           1
+/* shorter buffers are summed in software */
+#define CFG_LWIP_HW_CSUM_THRESHOLD                 128
 
 #define FLASH_SELECTION_TYPE_DYNAMIC               0 //select with flashID runtime
 #define FLASH_SELECTION_TYPE_1M                    0x100000 //1MBytes
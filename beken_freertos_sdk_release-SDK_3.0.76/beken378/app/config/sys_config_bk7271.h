@@ -164,6 +164,13 @@
 #define CFG_USB                                    1
 #define CFG_USE_USB_HOST                           1
 #define CFG_USE_USB_DEVICE                         0
+/* sector cache under fatfs for the usb disk: read-ahead and write-back */
+#define CFG_FATFS_DISK_CACHE                       0
+#if CFG_FATFS_DISK_CACHE
+#define CFG_FATFS_CACHE_LINES                      8  // lines, os_malloc'ed
+#define CFG_FATFS_CACHE_LINE_SECTORS               8  // 512 byte sectors per line, at most 32
+#define CFG_FATFS_CACHE_READAHEAD                  2  // extra lines filled by a sequential miss
+#endif
 
 #define USE_USB1_PORT		                        1
 #define USE_USB2_PORT		                        2
@@ -333,6 +333,30 @@ static int sfifo_write(sfifo_t *f, const void *_buf, int len)
     return total;
 }
 
+#ifndef FTPD_STREAM_BUF_SIZE
+#define FTPD_STREAM_BUF_SIZE        (8 * 1024)
+#endif
+
+#ifndef FTPD_WRITE_BEHIND_MAX
+#define FTPD_WRITE_BEHIND_MAX       (8 * 1024)
+#endif
+
+#define FTPD_SECTOR_SIZE            _MAX_SS
+
+/*
+ * File data of a RETR/STOR transfer. RETR queues it on the pcb by
+ * reference, so a chunk must stay in place until the peer acks it.
+ */
+struct ftpd_stream
+{
+    u8_t *buf;
+    u32_t size;
+    u32_t head;         /* RETR: next file read lands here, STOR: bytes gathered */
+    u32_t unsent;       /* RETR: read from the file, not queued yet */
+    u32_t inflight;     /* RETR: queued on the pcb, not acked yet */
+    int stor;
+};
+
 struct ftpd_datastate
 {
     int connected;
@@ -340,6 +364,7 @@ struct ftpd_datastate
     vfs_dirent_t *vfs_dirent;
     vfs_file_t *vfs_file;
     sfifo_t fifo;
+    struct ftpd_stream stream;
     struct tcp_pcb *msgpcb;
     struct ftpd_msgstate *msgfs;
 };
@@ -359,6 +384,64 @@ struct ftpd_msgstate
 
 static void send_msg(struct tcp_pcb *pcb, struct ftpd_msgstate *fsm, char *msg, ...);
 
+static int ftpd_stream_flush(struct ftpd_datastate *fsd)
+{
+    struct ftpd_stream *st = &fsd->stream;
+    int len;
+
+    if (st->head == 0)
+        return 0;
+
+    len = vfs_write(st->buf, 1, st->head, fsd->vfs_file);
+    if (len != st->head)
+    {
+        dbg_printf("ftpd_stream_flush: error writing!\r\n");
+        st->head = 0;
+        return -1;
+    }
+    st->head = 0;
+
+    return 0;
+}
+
+/* STOR: gather the upload so fatfs is handed whole clusters at a time */
+static int ftpd_stream_put(struct ftpd_datastate *fsd, const u8_t *data, u32_t len)
+{
+    struct ftpd_stream *st = &fsd->stream;
+    u32_t n;
+
+    while (len > 0)
+    {
+        n = st->size - st->head;
+        if (n > len)
+            n = len;
+        memcpy(st->buf + st->head, data, n);
+        st->head += n;
+        data += n;
+        len -= n;
+
+        if ((st->head == st->size) && (ftpd_stream_flush(fsd) != 0))
+            return -1;
+    }
+
+    return 0;
+}
+
+static void ftpd_datafree(struct ftpd_datastate *fsd)
+{
+    if (fsd->vfs_file)
+    {
+        if (fsd->stream.stor)
+            ftpd_stream_flush(fsd);
+        vfs_close(fsd->vfs_file);
+        fsd->vfs_file = NULL;
+    }
+    if (fsd->stream.buf)
+        os_free(fsd->stream.buf);
+    sfifo_close(&fsd->fifo);
+    os_free(fsd);
+}
+
 static void ftpd_dataerr(void *arg, err_t err)
 {
     struct ftpd_datastate *fsd = arg;
@@ -368,19 +451,24 @@ static void ftpd_dataerr(void *arg, err_t err)
         return;
     fsd->msgfs->datafs = NULL;
     fsd->msgfs->state = FTPD_IDLE;
-    os_free(fsd);
+    ftpd_datafree(fsd);
 }
 
 static void ftpd_dataclose(struct tcp_pcb *pcb, struct ftpd_datastate *fsd)
 {
+    u32_t inflight = fsd->stream.inflight;
+
     tcp_arg(pcb, NULL);
     tcp_sent(pcb, NULL);
     tcp_recv(pcb, NULL);
     fsd->msgfs->datafs = NULL;
-    sfifo_close(&fsd->fifo);
-    os_free(fsd);
+    ftpd_datafree(fsd);
     tcp_arg(pcb, NULL);
-    tcp_close(pcb);
+    /* unacked segments would keep pointing into the freed stream buffer */
+    if (inflight)
+        tcp_abort(pcb);
+    else
+        tcp_close(pcb);
 }
 
 static void send_data(struct tcp_pcb *pcb, struct ftpd_datastate *fsd)
@@ -427,46 +515,84 @@ static void send_data(struct tcp_pcb *pcb, struct ftpd_datastate *fsd)
     }
 }
 
-static void send_file(struct ftpd_datastate *fsd, struct tcp_pcb *pcb)
+/*
+ * RETR: read the file in whole sectors straight into the stream buffer,
+ * so fatfs skips its sector copy, and queue the chunk on the pcb without
+ * copying it. Chunks are sized to the send window and the room left
+ * behind the oldest unacked byte.
+ */
+static void send_stream(struct tcp_pcb *pcb, struct ftpd_datastate *fsd)
 {
-    if (!fsd->connected)
-        return;
+    struct ftpd_stream *st = &fsd->stream;
+    u32_t tail, space, len;
+    err_t err;
+    int rd;
 
-    if (fsd->vfs_file)
+    while (1)
     {
-        char buffer[2048];
-        int len;
-
-        len = sfifo_space(&fsd->fifo);
-        if (len == 0)
+        if (st->unsent == 0)
         {
-            send_data(pcb, fsd);
-            return;
+            if ((fsd->vfs_file == NULL) || (st->inflight >= st->size))
+                break;
+
+            if ((st->inflight == 0) || (st->head == st->size))
+                st->head = 0;
+            tail = (st->head + st->size - st->inflight) % st->size;
+            space = (tail > st->head) ? (tail - st->head) : (st->size - st->head);
+
+            len = tcp_sndbuf(pcb);
+            if (len > space)
+                len = space;
+            len &= ~(FTPD_SECTOR_SIZE - 1);
+            if (len == 0)
+                break;
+
+            rd = vfs_read(st->buf + st->head, 1, len, fsd->vfs_file);
+            if (rd <= 0)
+            {
+                if (vfs_eof(fsd->vfs_file) == 0)
+                    break;
+                vfs_close(fsd->vfs_file);
+                fsd->vfs_file = NULL;
+                break;
+            }
+            st->unsent = rd;
         }
-        if (len > 2048)
-            len = 2048;
-        len = vfs_read(buffer, 1, len, fsd->vfs_file);
+
+        len = tcp_sndbuf(pcb);
+        if (len > st->unsent)
+            len = st->unsent;
         if (len == 0)
+            break;
+
+        err = tcp_write(pcb, st->buf + st->head, (u16_t)len, 0);
+        if (err != ERR_OK)
         {
-            if (vfs_eof(fsd->vfs_file) == 0)
-                return;
-            vfs_close(fsd->vfs_file);
-            fsd->vfs_file = NULL;
-            return;
+            /* out of segments, the sent callback retries */
+            dbg_printf("send_stream: error writing!\r\n");
+            break;
         }
-        sfifo_write(&fsd->fifo, buffer, len);
-        send_data(pcb, fsd);
+        st->head += len;
+        st->unsent -= len;
+        st->inflight += len;
     }
-    else
+
+    tcp_output(pcb);
+}
+
+static void send_file(struct ftpd_datastate *fsd, struct tcp_pcb *pcb)
+{
+    if (!fsd->connected)
+        return;
+
+    if (fsd->vfs_file)
+        send_stream(pcb, fsd);
+
+    if ((fsd->vfs_file == NULL) && (fsd->stream.inflight == 0))
     {
         struct ftpd_msgstate *fsm;
         struct tcp_pcb *msgpcb;
 
-        if (sfifo_used(&fsd->fifo) > 0)
-        {
-            send_data(pcb, fsd);
-            return;
-        }
         fsm = fsd->msgfs;
         msgpcb = fsd->msgpcb;
 
@@ -570,6 +696,9 @@ static err_t ftpd_datasent(void *arg, struct tcp_pcb *pcb, u16_t len)
         send_next_directory(fsd, pcb, 1);
         break;
     case FTPD_RETR:
+        if (len > fsd->stream.inflight)
+            len = fsd->stream.inflight;
+        fsd->stream.inflight -= len;
         send_file(fsd, pcb);
         break;
     default:
@@ -590,12 +719,9 @@ static err_t ftpd_datarecv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t
 
         for (q = p; q != NULL; q = q->next)
         {
-            int len;
-
-            len = vfs_write(q->payload, 1, q->len, fsd->vfs_file);
-            tot_len += len;
-            if (len != q->len)
+            if (ftpd_stream_put(fsd, q->payload, q->len) != 0)
                 break;
+            tot_len += q->len;
         }
 
         /* Inform TCP that we have taken the data. */
@@ -607,10 +733,15 @@ static err_t ftpd_datarecv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t
     {
         struct ftpd_msgstate *fsm;
         struct tcp_pcb *msgpcb;
+        int aborted;
 
         fsm = fsd->msgfs;
         msgpcb = fsd->msgpcb;
+        /* peer closed while a RETR still has data in flight */
+        aborted = (fsd->stream.inflight != 0);
 
+        if (fsd->stream.stor)
+            ftpd_stream_flush(fsd);
         vfs_close(fsd->vfs_file);
         fsd->vfs_file = NULL;
         ftpd_dataclose(pcb, fsd);
@@ -618,6 +749,9 @@ static err_t ftpd_datarecv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t
         fsm->datafs = NULL;
         fsm->state = FTPD_IDLE;
         send_msg(msgpcb, fsm, msg226);
+
+        if (aborted)
+            return ERR_ABRT;
     }
 
     return ERR_OK;
@@ -854,6 +988,7 @@ static void cmd_retr(const char *arg, struct tcp_pcb *pcb, struct ftpd_msgstate
 {
     vfs_file_t *vfs_file;
     vfs_stat_t st;
+    u8_t *buf;
 
     vfs_stat(fsm->vfs, arg, &st);
     if (!VFS_ISREG(st.st_mode))
@@ -867,22 +1002,34 @@ static void cmd_retr(const char *arg, struct tcp_pcb *pcb, struct ftpd_msgstate
         send_msg(pcb, fsm, msg550);
         return;
     }
+    buf = (u8_t *)os_malloc(FTPD_STREAM_BUF_SIZE);
+    if (!buf)
+    {
+        vfs_close(vfs_file);
+        send_msg(pcb, fsm, msg451);
+        return;
+    }
 
     send_msg(pcb, fsm, msg150recv, arg, st.st_size);
 
     if (open_dataconnection(pcb, fsm) != 0)
     {
+        os_free(buf);
         vfs_close(vfs_file);
         return;
     }
 
     fsm->datafs->vfs_file = vfs_file;
+    fsm->datafs->stream.buf = buf;
+    fsm->datafs->stream.size = FTPD_STREAM_BUF_SIZE;
     fsm->state = FTPD_RETR;
 }
 
 static void cmd_stor(const char *arg, struct tcp_pcb *pcb, struct ftpd_msgstate *fsm)
 {
     vfs_file_t *vfs_file;
+    u8_t *buf;
+    int size;
 
     vfs_file = vfs_open(fsm->vfs, arg, "wb");
     if (!vfs_file)
@@ -891,15 +1038,33 @@ static void cmd_stor(const char *arg, struct tcp_pcb *pcb, struct ftpd_msgstate
         return;
     }
 
+    /* write behind in cluster sized chunks, a new file starts cluster aligned */
+    size = vfs_cluster_size(vfs_file);
+    if (size > FTPD_WRITE_BEHIND_MAX)
+        size = FTPD_WRITE_BEHIND_MAX;
+    if (size < FTPD_SECTOR_SIZE)
+        size = FTPD_SECTOR_SIZE;
+    buf = (u8_t *)os_malloc(size);
+    if (!buf)
+    {
+        vfs_close(vfs_file);
+        send_msg(pcb, fsm, msg451);
+        return;
+    }
+
     send_msg(pcb, fsm, msg150stor, arg);
 
     if (open_dataconnection(pcb, fsm) != 0)
     {
+        os_free(buf);
         vfs_close(vfs_file);
         return;
     }
 
     fsm->datafs->vfs_file = vfs_file;
+    fsm->datafs->stream.buf = buf;
+    fsm->datafs->stream.size = size;
+    fsm->datafs->stream.stor = 1;
     fsm->state = FTPD_STOR;
 }
 
@@ -998,10 +1163,13 @@ static void cmd_abrt(const char *arg, struct tcp_pcb *pcb, struct ftpd_msgstate
         tcp_sent(fsm->datapcb, NULL);
         tcp_recv(fsm->datapcb, NULL);
         tcp_arg(fsm->datapcb, NULL);
-        tcp_abort(pcb);
-        sfifo_close(&fsm->datafs->fifo);
-        os_free(fsm->datafs);
+        if (fsm->datafs->connected)
+            tcp_abort(fsm->datapcb);
+        else
+            tcp_close(fsm->datapcb);
+        ftpd_datafree(fsm->datafs);
         fsm->datafs = NULL;
+        fsm->datapcb = NULL;
     }
     fsm->state = FTPD_IDLE;
 }
@@ -70,12 +70,46 @@ int vfs_stat(vfs_t *vfs, const char *filename, vfs_stat_t *st)
     return 0;
 }
 
+#if ((_FATFS == 68300) && _USE_FASTSEEK)
+#define VFS_LINKMAP_ITEMS   32
+
+/* cluster link map, reads and seeks of a file being streamed skip the fat chain walk */
+static void vfs_linkmap(vfs_file_t *f)
+{
+    DWORD items = VFS_LINKMAP_ITEMS;
+    FRESULT r = FR_NOT_ENOUGH_CORE;
+
+    while (r == FR_NOT_ENOUGH_CORE)
+    {
+        if (f->cltbl)
+            os_free(f->cltbl);
+        f->cltbl = (DWORD *)os_malloc(items * sizeof(DWORD));
+        if (f->cltbl == NULL)
+            return;
+        f->cltbl[0] = items;
+        r = f_lseek(f, CREATE_LINKMAP);
+        /* on a short table the first item holds the size needed */
+        items = f->cltbl[0];
+    }
+
+    if (r != FR_OK)
+    {
+        os_free(f->cltbl);
+        f->cltbl = NULL;
+    }
+}
+#endif
+
 void vfs_close(vfs_t *vfs)
 {
     if (vfs != &guard_for_the_whole_fs)
     {
         /* Close a file */
         f_close(vfs);
+#if ((_FATFS == 68300) && _USE_FASTSEEK)
+        if (vfs->cltbl)
+            os_free(vfs->cltbl);
+#endif
     }
     os_free(vfs);
 }
@@ -88,6 +122,16 @@ int vfs_write (void *buffer, int dummy, int len, vfs_file_t *file)
     return byteswritten;
 }
 
+/* allocation unit of the volume the file lives on, in bytes */
+int vfs_cluster_size(vfs_file_t *file)
+{
+#if (_FATFS == 68300)
+    return file->obj.fs->csize * _MAX_SS;
+#else
+    return file->fs->csize * _MAX_SS;
+#endif
+}
+
 vfs_t *vfs_openfs(void)
 {
     return &guard_for_the_whole_fs;
@@ -109,6 +153,10 @@ vfs_file_t *vfs_open(vfs_t *vfs, const char *filename, const char *mode)
         os_free(f);
         return NULL;
     }
+#if ((_FATFS == 68300) && _USE_FASTSEEK)
+    if (flags == FA_READ)
+        vfs_linkmap(f);
+#endif
     return f;
 }
 
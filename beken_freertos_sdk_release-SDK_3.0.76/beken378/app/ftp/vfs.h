@@ -77,6 +77,7 @@ struct tm
 char *vfs_getcwd(vfs_t *vfs, void *, int dummy);
 int vfs_read (void *buffer, int dummy, int len, vfs_file_t *file);
 int vfs_write (void *buffer, int dummy, int len, vfs_file_t *file);
+int vfs_cluster_size(vfs_file_t *file);
 vfs_dirent_t *vfs_readdir(vfs_dir_t *dir);
 vfs_file_t *vfs_open(vfs_t *vfs, const char *filename, const char *mode);
 vfs_t *vfs_openfs(void);
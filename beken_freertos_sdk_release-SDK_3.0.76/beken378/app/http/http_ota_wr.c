@@ -0,0 +1,551 @@
+#include "include.h"
+#include <string.h>
+#include <stddef.h>
+#include "http_ota_wr.h"
+
+#if CFG_HTTP_OTA_PIPELINE
+#include "rtos_pub.h"
+#include "mem_pub.h"
+#include "str_pub.h"
+#include "uart_pub.h"
+#include "drv_model_pub.h"
+#include "flash_pub.h"
+#include "BkDriverFlash.h"
+
+#if CFG_MBEDTLS
+#include "mbedtls/sha256.h"
+#define HTTP_OTA_WR_SHA256                  1
+#else
+#define HTTP_OTA_WR_SHA256                  0
+#endif
+
+#define HTTP_OTA_WR_SECTOR_SIZE             0x1000
+#define HTTP_OTA_WR_NO_BUF                  0xFF
+#define HTTP_OTA_WR_VERIFY_SIZE             64      //bytes read back per compare, on the writer stack
+
+#if CFG_HTTP_OTA_RESUME
+#define HTTP_OTA_JRNL_MAGIC                 0x4A41544F //"OTAJ"
+#define HTTP_OTA_JRNL_BLANK                 0xFFFFFFFF
+#define HTTP_OTA_JRNL_NUM                   (HTTP_OTA_WR_SECTOR_SIZE / sizeof(http_ota_jrnl_t))
+#endif
+
+enum
+{
+	HTTP_OTA_WR_MSG_DATA = 0,
+	HTTP_OTA_WR_MSG_FINISH,
+	HTTP_OTA_WR_MSG_ABORT,
+};
+
+typedef struct
+{
+	UINT8 type;
+	UINT8 idx;
+	UINT16 len;
+} http_ota_wr_msg_t;
+
+#if CFG_HTTP_OTA_RESUME
+/* one slot of the journal sector, the magic is programmed last */
+typedef struct
+{
+	UINT32 id;                  //hash of the url
+	UINT32 offset;              //bytes programmed from the partition start
+	UINT32 sha_state[8];
+	char etag[HTTP_OTA_WR_ETAG_LEN];
+	UINT32 reserved[5];
+	UINT32 magic;
+} http_ota_jrnl_t;
+
+/* the request being made, kept across writer restarts */
+typedef struct
+{
+	UINT32 id;                  //0 when the url is unknown
+	UINT32 offset;              //offset asked for with Range, 0 for the whole image
+	UINT32 sha_state[8];
+	char etag[HTTP_OTA_WR_ETAG_LEN];
+} http_ota_resume_t;
+#endif
+
+typedef struct
+{
+	UINT8 active;
+	UINT8 cur;                  //buffer being filled by the receive path
+	UINT16 cur_len;
+	UINT8 *buf[HTTP_OTA_WR_BUF_NUM];
+	beken_queue_t full_q;       //http_ota_wr_msg_t, receive path -> writer
+	beken_queue_t free_q;       //UINT8 buffer index, writer -> receive path
+	beken_semaphore_t done_sema;
+	beken_thread_t thd;
+	DD_HANDLE flash_hdl;
+
+	/* owned by the writer task while active */
+	int err;
+	UINT32 wr_addr;
+	UINT32 erase_addr;
+	UINT32 end_addr;
+#if CFG_HTTP_OTA_RESUME
+	UINT32 start_addr;
+	UINT32 jrnl_addr;
+	UINT16 jrnl_slot;           //first slot never written
+	UINT8 jrnl_reset;
+#endif
+#if HTTP_OTA_WR_SHA256
+	mbedtls_sha256_context sha;
+#endif
+	UINT8 digest_valid;
+	UINT8 digest[HTTP_OTA_WR_DIGEST_LEN];
+} http_ota_wr_t;
+
+static http_ota_wr_t ota_wr;
+#if CFG_HTTP_OTA_RESUME
+static http_ota_resume_t ota_resume;
+#endif
+
+static void http_ota_wr_erase_next(void)
+{
+	UINT32 param = ota_wr.erase_addr;
+	GLOBAL_INT_DECLARATION();
+
+	GLOBAL_INT_DISABLE();
+	ddev_control(ota_wr.flash_hdl, CMD_FLASH_ERASE_SECTOR, (void *)&param);
+	GLOBAL_INT_RESTORE();
+	ota_wr.erase_addr += HTTP_OTA_WR_SECTOR_SIZE;
+}
+
+#if CFG_HTTP_OTA_RESUME
+static void http_ota_jrnl_erase(void)
+{
+	UINT32 param = ota_wr.jrnl_addr;
+	GLOBAL_INT_DECLARATION();
+
+	GLOBAL_INT_DISABLE();
+	ddev_control(ota_wr.flash_hdl, CMD_FLASH_ERASE_SECTOR, (void *)&param);
+	GLOBAL_INT_RESTORE();
+	ota_wr.jrnl_slot = 0;
+}
+
+/* returns 1 with the newest complete entry, *next is the first blank slot */
+static int http_ota_jrnl_load(DD_HANDLE hdl, UINT32 addr, http_ota_jrnl_t *last, UINT16 *next)
+{
+	http_ota_jrnl_t entry;
+	UINT16 i;
+	int found = 0;
+
+	for (i = 0; i < HTTP_OTA_JRNL_NUM; i++) {
+		ddev_read(hdl, (char *)&entry, sizeof(entry), addr + i * sizeof(entry));
+		if (entry.magic == HTTP_OTA_JRNL_MAGIC) {
+			os_memcpy(last, &entry, sizeof(entry));
+			found = 1;
+		} else if (entry.id == HTTP_OTA_JRNL_BLANK) {
+			break;
+		}
+		//else torn by a power cut, skipped
+	}
+	*next = i;
+
+	return found;
+}
+
+static void http_ota_jrnl_append(void)
+{
+	http_ota_jrnl_t entry;
+	UINT32 addr;
+	GLOBAL_INT_DECLARATION();
+
+	if (ota_wr.jrnl_slot >= HTTP_OTA_JRNL_NUM)
+		http_ota_jrnl_erase();
+
+	os_memset(&entry, 0xFF, sizeof(entry));
+	entry.id = ota_resume.id;
+	entry.offset = ota_wr.wr_addr - ota_wr.start_addr;
+#if HTTP_OTA_WR_SHA256
+	/* blocks are a multiple of 64 bytes, nothing is pending in sha.buffer */
+	os_memcpy(entry.sha_state, ota_wr.sha.state, sizeof(entry.sha_state));
+#endif
+	os_memcpy(entry.etag, ota_resume.etag, HTTP_OTA_WR_ETAG_LEN);
+	addr = ota_wr.jrnl_addr + ota_wr.jrnl_slot * sizeof(entry);
+
+	GLOBAL_INT_DISABLE();
+	ddev_write(ota_wr.flash_hdl, (char *)&entry, offsetof(http_ota_jrnl_t, magic), addr);
+	GLOBAL_INT_RESTORE();
+	entry.magic = HTTP_OTA_JRNL_MAGIC;
+	GLOBAL_INT_DISABLE();
+	ddev_write(ota_wr.flash_hdl, (char *)&entry.magic, sizeof(entry.magic), addr + offsetof(http_ota_jrnl_t, magic));
+	GLOBAL_INT_RESTORE();
+	ota_wr.jrnl_slot++;
+}
+
+/* FNV-1a, never 0 nor a blank flash word */
+static UINT32 http_ota_wr_url_id(const char *url)
+{
+	UINT32 hash = 0x811C9DC5;
+
+	while (*url) {
+		hash ^= (UINT8)*url++;
+		hash *= 0x01000193;
+	}
+	if (hash == 0 || hash == HTTP_OTA_JRNL_BLANK)
+		hash = 1;
+
+	return hash;
+}
+#endif
+
+static int http_ota_wr_program(UINT8 *buf, UINT32 len)
+{
+	UINT8 rd[HTTP_OTA_WR_VERIFY_SIZE];
+	UINT32 off, n;
+	GLOBAL_INT_DECLARATION();
+
+	if (ota_wr.wr_addr + len > ota_wr.end_addr) {
+		os_printf("ota image exceeds partition\r\n");
+		return -1;
+	}
+
+	/* normally already done while waiting for the network */
+	while (ota_wr.erase_addr < ota_wr.wr_addr + len)
+		http_ota_wr_erase_next();
+
+	for (off = 0; off < len; off += n) {
+		n = _min(len - off, HTTP_OTA_WR_PROG_SIZE);
+		GLOBAL_INT_DISABLE();
+		ddev_write(ota_wr.flash_hdl, (char *)buf + off, n, ota_wr.wr_addr + off);
+		GLOBAL_INT_RESTORE();
+	}
+
+	/* the digest describes the flash, not the buffer that was programmed */
+	for (off = 0; off < len; off += n) {
+		n = _min(len - off, HTTP_OTA_WR_VERIFY_SIZE);
+		ddev_read(ota_wr.flash_hdl, (char *)rd, n, ota_wr.wr_addr + off);
+		if (os_memcmp(rd, buf + off, n)) {
+			os_printf("ota verify err at 0x%x\r\n", ota_wr.wr_addr + off);
+			return -1;
+		}
+#if HTTP_OTA_WR_SHA256
+		mbedtls_sha256_update(&ota_wr.sha, rd, n);
+#endif
+	}
+	ota_wr.wr_addr += len;
+
+	return 0;
+}
+
+static void http_ota_wr_thread(beken_thread_arg_t arg)
+{
+	http_ota_wr_msg_t msg;
+	UINT32 wait;
+
+#if CFG_HTTP_OTA_RESUME
+	/* a new image: progress of the previous one no longer describes the flash */
+	if (ota_wr.jrnl_reset)
+		http_ota_jrnl_erase();
+#endif
+
+	while (1) {
+		if ((ota_wr.erase_addr < ota_wr.end_addr)
+			&& (ota_wr.erase_addr < ota_wr.wr_addr + HTTP_OTA_WR_ERASE_AHEAD * HTTP_OTA_WR_SECTOR_SIZE))
+			wait = BEKEN_NO_WAIT;
+		else
+			wait = BEKEN_WAIT_FOREVER;
+
+		if (rtos_pop_from_queue(&ota_wr.full_q, &msg, wait) != kNoErr) {
+			http_ota_wr_erase_next();
+			continue;
+		}
+
+		if (msg.type != HTTP_OTA_WR_MSG_DATA)
+			break;
+
+		if (!ota_wr.err && http_ota_wr_program(ota_wr.buf[msg.idx], msg.len))
+			ota_wr.err = -1;
+#if CFG_HTTP_OTA_RESUME
+		/* only whole blocks are resumable, the last partial one is never journaled */
+		if (!ota_wr.err && ota_resume.id && msg.len == HTTP_OTA_WR_BUF_SIZE)
+			http_ota_jrnl_append();
+#endif
+		rtos_push_to_queue(&ota_wr.free_q, &msg.idx, BEKEN_NO_WAIT);
+	}
+
+	if (msg.type == HTTP_OTA_WR_MSG_FINISH && !ota_wr.err) {
+#if CFG_HTTP_OTA_RESUME
+		http_ota_jrnl_erase();
+#endif
+#if HTTP_OTA_WR_SHA256
+		mbedtls_sha256_finish(&ota_wr.sha, ota_wr.digest);
+		ota_wr.digest_valid = 1;
+#endif
+	}
+
+	rtos_set_semaphore(&ota_wr.done_sema);
+	rtos_delete_thread(NULL);
+}
+
+static void http_ota_wr_release(void)
+{
+	UINT8 i;
+
+	if (ota_wr.done_sema)
+		rtos_deinit_semaphore(&ota_wr.done_sema);
+	if (ota_wr.free_q)
+		rtos_deinit_queue(&ota_wr.free_q);
+	if (ota_wr.full_q)
+		rtos_deinit_queue(&ota_wr.full_q);
+	for (i = 0; i < HTTP_OTA_WR_BUF_NUM; i++) {
+		if (ota_wr.buf[i])
+			os_free(ota_wr.buf[i]);
+		ota_wr.buf[i] = NULL;
+	}
+	if (ota_wr.flash_hdl != DD_HANDLE_UNVALID)
+		ddev_close(ota_wr.flash_hdl);
+#if HTTP_OTA_WR_SHA256
+	mbedtls_sha256_free(&ota_wr.sha);
+#endif
+
+	ota_wr.done_sema = NULL;
+	ota_wr.free_q = NULL;
+	ota_wr.full_q = NULL;
+	ota_wr.thd = NULL;
+	ota_wr.flash_hdl = DD_HANDLE_UNVALID;
+	ota_wr.active = 0;
+
+	bk_flash_enable_security(FLASH_UNPROTECT_LAST_BLOCK);
+}
+
+/* stop the writer task: flush the partial buffer when finishing */
+static int http_ota_wr_stop(UINT8 type)
+{
+	http_ota_wr_msg_t msg;
+	int ret;
+
+	if (!ota_wr.active)
+		return -1;
+
+	if (type == HTTP_OTA_WR_MSG_FINISH && ota_wr.cur != HTTP_OTA_WR_NO_BUF && ota_wr.cur_len) {
+		msg.type = HTTP_OTA_WR_MSG_DATA;
+		msg.idx = ota_wr.cur;
+		msg.len = ota_wr.cur_len;
+		rtos_push_to_queue(&ota_wr.full_q, &msg, BEKEN_WAIT_FOREVER);
+		ota_wr.cur = HTTP_OTA_WR_NO_BUF;
+	}
+
+	msg.type = type;
+	msg.idx = 0;
+	msg.len = 0;
+	rtos_push_to_queue(&ota_wr.full_q, &msg, BEKEN_WAIT_FOREVER);
+	rtos_get_semaphore(&ota_wr.done_sema, BEKEN_WAIT_FOREVER);
+
+	ret = ota_wr.err;
+	http_ota_wr_release();
+
+	return ret;
+}
+
+int http_ota_wr_init(void)
+{
+	bk_logic_partition_t *pt;
+	UINT32 status;
+	UINT8 i;
+
+	/* a transfer left open is restarted, like the direct writer does */
+	if (ota_wr.active)
+		http_ota_wr_stop(HTTP_OTA_WR_MSG_ABORT);
+
+	os_memset(&ota_wr, 0, sizeof(ota_wr));
+	ota_wr.cur = HTTP_OTA_WR_NO_BUF;
+	ota_wr.flash_hdl = DD_HANDLE_UNVALID;
+
+	pt = bk_flash_get_info(BK_PARTITION_OTA);
+	if (pt == NULL)
+		return -1;
+	ota_wr.wr_addr = pt->partition_start_addr;
+	ota_wr.erase_addr = pt->partition_start_addr;
+	ota_wr.end_addr = pt->partition_start_addr + pt->partition_length;
+
+	ota_wr.flash_hdl = ddev_open(FLASH_DEV_NAME, &status, 0);
+	if (ota_wr.flash_hdl == DD_HANDLE_UNVALID)
+		goto err;
+
+#if CFG_HTTP_OTA_RESUME
+	/* the last sector of the partition holds the journal */
+	ota_wr.start_addr = pt->partition_start_addr;
+	ota_wr.end_addr -= HTTP_OTA_WR_SECTOR_SIZE;
+	ota_wr.jrnl_addr = ota_wr.end_addr;
+	if (ota_resume.offset && ota_resume.offset < ota_wr.end_addr - ota_wr.start_addr) {
+		http_ota_jrnl_t entry;
+
+		http_ota_jrnl_load(ota_wr.flash_hdl, ota_wr.jrnl_addr, &entry, &ota_wr.jrnl_slot);
+		ota_wr.wr_addr += ota_resume.offset;
+		ota_wr.erase_addr = ota_wr.wr_addr;
+		os_printf("ota resume at 0x%x\r\n", ota_resume.offset);
+	} else {
+		ota_resume.offset = 0;
+		ota_wr.jrnl_reset = 1;
+	}
+#endif
+
+	if (rtos_init_queue(&ota_wr.full_q, "ota_full", sizeof(http_ota_wr_msg_t), HTTP_OTA_WR_BUF_NUM + 1) != kNoErr)
+		goto err;
+	if (rtos_init_queue(&ota_wr.free_q, "ota_free", sizeof(UINT8), HTTP_OTA_WR_BUF_NUM) != kNoErr)
+		goto err;
+	if (rtos_init_semaphore(&ota_wr.done_sema, 1) != kNoErr)
+		goto err;
+
+	for (i = 0; i < HTTP_OTA_WR_BUF_NUM; i++) {
+		ota_wr.buf[i] = os_malloc(HTTP_OTA_WR_BUF_SIZE);
+		if (ota_wr.buf[i] == NULL)
+			goto err;
+		rtos_push_to_queue(&ota_wr.free_q, &i, BEKEN_NO_WAIT);
+	}
+
+#if HTTP_OTA_WR_SHA256
+	mbedtls_sha256_init(&ota_wr.sha);
+	mbedtls_sha256_starts(&ota_wr.sha, 0);
+#if CFG_HTTP_OTA_RESUME
+	if (ota_resume.offset) {
+		os_memcpy(ota_wr.sha.state, ota_resume.sha_state, sizeof(ota_wr.sha.state));
+		ota_wr.sha.total[0] = ota_resume.offset;
+	}
+#endif
+#endif
+
+	bk_flash_enable_security(FLASH_PROTECT_NONE);
+	ota_wr.active = 1;
+
+	if (rtos_create_thread(&ota_wr.thd, THD_EXTENDED_APP_PRIORITY, "ota_wr",
+						   (beken_thread_function_t)http_ota_wr_thread, 2048, NULL) != kNoErr)
+		goto err;
+
+	os_printf("ota write to 0x%x\r\n", ota_wr.wr_addr);
+	return 0;
+
+err:
+	os_printf("ota writer init err\r\n");
+	http_ota_wr_release();
+	return -1;
+}
+
+void http_ota_wr_data(const UINT8 *data, UINT32 len)
+{
+	http_ota_wr_msg_t msg;
+	UINT32 n;
+
+	if (!ota_wr.active)
+		return;
+
+	while (len) {
+		if (ota_wr.cur == HTTP_OTA_WR_NO_BUF) {
+			/* blocks only while every buffer is queued for the flash */
+			rtos_pop_from_queue(&ota_wr.free_q, &ota_wr.cur, BEKEN_WAIT_FOREVER);
+			ota_wr.cur_len = 0;
+		}
+
+		n = _min(len, HTTP_OTA_WR_BUF_SIZE - ota_wr.cur_len);
+		os_memcpy(ota_wr.buf[ota_wr.cur] + ota_wr.cur_len, data, n);
+		ota_wr.cur_len += n;
+		data += n;
+		len -= n;
+
+		if (ota_wr.cur_len == HTTP_OTA_WR_BUF_SIZE) {
+			msg.type = HTTP_OTA_WR_MSG_DATA;
+			msg.idx = ota_wr.cur;
+			msg.len = HTTP_OTA_WR_BUF_SIZE;
+			rtos_push_to_queue(&ota_wr.full_q, &msg, BEKEN_WAIT_FOREVER);
+			ota_wr.cur = HTTP_OTA_WR_NO_BUF;
+			os_printf(".");
+		}
+	}
+}
+
+int http_ota_wr_finish(void)
+{
+	int ret;
+	UINT8 i;
+
+	ret = http_ota_wr_stop(HTTP_OTA_WR_MSG_FINISH);
+	if (ret) {
+		os_printf("ota write err\r\n");
+		return ret;
+	}
+
+#if CFG_HTTP_OTA_RESUME
+	os_memset(&ota_resume, 0, sizeof(ota_resume));
+#endif
+
+	if (ota_wr.digest_valid) {
+		os_printf("ota sha256 ");
+		for (i = 0; i < HTTP_OTA_WR_DIGEST_LEN; i++)
+			os_printf("%02x", ota_wr.digest[i]);
+		os_printf("\r\n");
+	}
+
+	return 0;
+}
+
+void http_ota_wr_abort(void)
+{
+	http_ota_wr_stop(HTTP_OTA_WR_MSG_ABORT);
+}
+
+int http_ota_wr_get_digest(UINT8 digest[HTTP_OTA_WR_DIGEST_LEN])
+{
+	if (!ota_wr.digest_valid)
+		return -1;
+
+	os_memcpy(digest, ota_wr.digest, HTTP_OTA_WR_DIGEST_LEN);
+	return 0;
+}
+
+#if CFG_HTTP_OTA_RESUME
+/* returns the offset to ask for with Range, 0 to download the whole image */
+UINT32 http_ota_wr_resume_prepare(const char *url, char etag[HTTP_OTA_WR_ETAG_LEN])
+{
+	bk_logic_partition_t *pt;
+	http_ota_jrnl_t entry;
+	DD_HANDLE hdl;
+	UINT32 status;
+	UINT16 next;
+
+	os_memset(&ota_resume, 0, sizeof(ota_resume));
+	ota_resume.id = http_ota_wr_url_id(url);
+
+	pt = bk_flash_get_info(BK_PARTITION_OTA);
+	hdl = ddev_open(FLASH_DEV_NAME, &status, 0);
+	if (pt && hdl != DD_HANDLE_UNVALID) {
+		if (http_ota_jrnl_load(hdl, pt->partition_start_addr + pt->partition_length - HTTP_OTA_WR_SECTOR_SIZE, &entry, &next)
+			&& entry.id == ota_resume.id && entry.offset && !(entry.offset % HTTP_OTA_WR_BUF_SIZE)) {
+			ota_resume.offset = entry.offset;
+			os_memcpy(ota_resume.sha_state, entry.sha_state, sizeof(ota_resume.sha_state));
+			os_memcpy(ota_resume.etag, entry.etag, HTTP_OTA_WR_ETAG_LEN);
+			ota_resume.etag[HTTP_OTA_WR_ETAG_LEN - 1] = '\0';
+		}
+	}
+	if (hdl != DD_HANDLE_UNVALID)
+		ddev_close(hdl);
+
+	os_memcpy(etag, ota_resume.etag, HTTP_OTA_WR_ETAG_LEN);
+	return ota_resume.offset;
+}
+
+/* a 200 answer restarts the image, a 206 must start where it was asked to */
+int http_ota_wr_resume_accept(UINT8 partial, UINT32 range_start)
+{
+	if (partial && ota_resume.offset && range_start == ota_resume.offset)
+		return 0;
+
+	ota_resume.offset = 0;
+	return partial ? -1 : 0;
+}
+
+/* a truncated ETag would make If-Range match a changed image, drop it */
+void http_ota_wr_set_etag(const char *etag)
+{
+	if (os_strlen(etag) >= HTTP_OTA_WR_ETAG_LEN) {
+		os_printf("ota etag too long, not resumable\r\n");
+		ota_resume.id = 0;
+		ota_resume.etag[0] = '\0';
+		return;
+	}
+
+	os_strlcpy(ota_resume.etag, etag, HTTP_OTA_WR_ETAG_LEN);
+}
+#endif
+#endif // CFG_HTTP_OTA_PIPELINE
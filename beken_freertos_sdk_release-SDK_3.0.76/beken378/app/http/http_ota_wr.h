@@ -0,0 +1,58 @@
+#ifndef _HTTP_OTA_WR_H_
+#define _HTTP_OTA_WR_H_
+
+#include "include.h"
+
+/* the tftp image format keeps its own path */
+#if CFG_HTTP_OTA_PIPELINE && !CFG_SUPPORT_OTA_TFTP
+#define HTTP_OTA_WR_ENABLE                  1
+#else
+#define HTTP_OTA_WR_ENABLE                  0
+#endif
+
+#if HTTP_OTA_WR_ENABLE && CFG_HTTP_OTA_RESUME
+#define HTTP_OTA_WR_RESUME                  1
+#else
+#define HTTP_OTA_WR_RESUME                  0
+#endif
+
+#if CFG_HTTP_OTA_PIPELINE
+/*
+ * OTA image writer stage: the receive path only copies into one of
+ * HTTP_OTA_WR_BUF_NUM sector buffers, a writer task programs the full ones,
+ * erases sectors ahead of the write pointer while it is idle, and reads every
+ * block back: a mismatch fails the download, the digest is taken over what the
+ * flash holds.
+ */
+#ifndef CFG_HTTP_OTA_PIPELINE_BUF_NUM
+#define CFG_HTTP_OTA_PIPELINE_BUF_NUM       3
+#endif
+
+#define HTTP_OTA_WR_BUF_NUM                 CFG_HTTP_OTA_PIPELINE_BUF_NUM
+#define HTTP_OTA_WR_BUF_SIZE                0x1000
+#define HTTP_OTA_WR_PROG_SIZE               256     //bytes programmed per interrupt-off slice
+#define HTTP_OTA_WR_ERASE_AHEAD             16      //sectors kept erased ahead of the write pointer
+#define HTTP_OTA_WR_DIGEST_LEN              32
+
+int http_ota_wr_init(void);
+void http_ota_wr_data(const UINT8 *data, UINT32 len);
+int http_ota_wr_finish(void);
+void http_ota_wr_abort(void);
+int http_ota_wr_get_digest(UINT8 digest[HTTP_OTA_WR_DIGEST_LEN]);
+
+#if CFG_HTTP_OTA_RESUME
+/*
+ * Resume: the writer task appends a journal entry (offset, sha256 state, ETag)
+ * to the last sector of the partition after every programmed block, and a new
+ * request for the same url continues from that offset with a Range request.
+ */
+#define HTTP_OTA_WR_ETAG_LEN                64      //longer ETags are not resumed
+#define HTTP_OTA_WR_RETRY_MAX               5
+
+UINT32 http_ota_wr_resume_prepare(const char *url, char etag[HTTP_OTA_WR_ETAG_LEN]);
+int http_ota_wr_resume_accept(UINT8 partial, UINT32 range_start);
+void http_ota_wr_set_etag(const char *etag);
+#endif
+#endif // CFG_HTTP_OTA_PIPELINE
+
+#endif // _HTTP_OTA_WR_H_
@@ -15,6 +15,8 @@
 #include "flash_pub.h"
 #endif
 
+#include "http_ota_wr.h"
+
 #if CFG_SUPPORT_OTA_HTTP
 #define HTTPCLIENT_MIN(x,y) (((x)<(y))?(x):(y))
 #define HTTPCLIENT_MAX(x,y) (((x)>(y))?(x):(y))
@@ -48,7 +50,9 @@ HTTP_DATA_ST bk_http = {
 #endif
 };
 HTTP_DATA_ST *bk_http_ptr = &bk_http;
+#if !HTTP_OTA_WR_ENABLE
 static UINT32 ota_wr_block = 0;
+#endif
 
 #if AT_SERVICE_CFG
 volatile char http_is_ota = 0;
@@ -423,6 +427,23 @@ int httpclient_recv(httpclient_t *client, char *buf, int min_len, int max_len, i
 }
 
 #if HTTP_WR_TO_FLASH
+#if HTTP_OTA_WR_ENABLE
+void http_flash_init(void)
+{
+	http_ota_wr_init();
+}
+
+void http_flash_deinit(void)
+{
+	http_ota_wr_abort();
+	os_printf("write over\r\n");
+}
+
+void http_wr_to_flash(char *page, UINT32 len)
+{
+	http_ota_wr_data((UINT8 *)page, len);
+}
+#else
 void http_flash_wr(UINT8 *src, unsigned len)
 {
 	UINT32 param;
@@ -523,6 +544,7 @@ void http_wr_to_flash(char *page, UINT32 len)
 		}
 	}
 }
+#endif // HTTP_OTA_WR_ENABLE
 #endif
 
 void http_data_process(char *buf, UINT32 len)
@@ -696,6 +718,15 @@ int httpclient_retrieve_content(httpclient_t *client, char *data, int len, uint3
                 if (ret == ERROR_HTTP_CONN) {
                     return ret;
                 }
+                if (len) {
+                    /* the timeout is for a stalled transfer, not the whole body */
+                    utils_time_countdown_ms(&timer, timeout_ms);
+                } else if (utils_time_is_expired(&timer)) {
+                    log_err("recv timeout, %d bytes left", readLen);
+                    bk_http_ptr->do_data = 0;
+                    os_free(b_data);
+                    return ERROR_NET_TIMEOUT;
+                }
             }
             if(readLen==len)
             {
@@ -733,6 +764,11 @@ int httpclient_retrieve_content(httpclient_t *client, char *data, int len, uint3
 #if HTTP_WR_TO_FLASH
                 #if CFG_SUPPORT_OTA_TFTP//support bk ota format
                 store_block(ota_wr_block, bk_http_ptr->wr_buf, bk_http_ptr->wr_last_len);
+                #elif HTTP_OTA_WR_ENABLE  //flush and wait for the writer task
+                if (http_ota_wr_finish()) {
+                    http_flash_deinit();
+                    return ERROR_HTTP;
+                }
                 #else                    //direct wrtie to flash
                 http_flash_wr(bk_http_ptr->wr_buf, bk_http_ptr->wr_last_len);
                 #endif
@@ -753,6 +789,9 @@ int httpclient_response_parse(httpclient_t *client, char *data, int len, uint32_
 {
 	int crlf_pos;
 	iotx_time_t timer;
+#if HTTP_OTA_WR_RESUME
+	UINT32 range_start = 0;
+#endif
 
 	iotx_time_init(&timer);
 	utils_time_countdown_ms(&timer, timeout_ms);
@@ -790,11 +829,11 @@ int httpclient_response_parse(httpclient_t *client, char *data, int len, uint32_
 	/* Now get headers */
 	while (true) {
 		char key[32];
-		char value[32];
+		char value[80];     //room for an ETag longer than the resume journal keeps
 		int n;
 
 		key[31] = '\0';
-		value[31] = '\0';
+		value[79] = '\0';
 
 		crlf_ptr = os_strstr(data, "\r\n");
 		if (crlf_ptr == NULL) {
@@ -824,7 +863,7 @@ int httpclient_response_parse(httpclient_t *client, char *data, int len, uint32_
 
 		data[crlf_pos] = '\0';
 
-		n = sscanf(data, "%31[^:]: %31[^\r\n]", key, value);
+		n = sscanf(data, "%31[^:]: %79[^\r\n]", key, value);
 		if (n == 2) {
 			log_debug("Read header : %s: %s", key, value);
 			if (!os_strcmp(key, "Content-Length")) {
@@ -837,6 +876,13 @@ int httpclient_response_parse(httpclient_t *client, char *data, int len, uint32_
 					client_data->retrieve_len = 0;
 				}
 			}
+#if HTTP_OTA_WR_RESUME
+			else if (!os_strcmp(key, "ETag") || !os_strcmp(key, "Etag")) {
+				http_ota_wr_set_etag(value);
+			} else if (!os_strcmp(key, "Content-Range")) {
+				sscanf(value, "bytes %u-", &range_start);
+			}
+#endif
 			os_memmove(data, &data[crlf_pos + 2], len - (crlf_pos + 2) + 1); /* Be sure to move NULL-terminating char as well */
 			len -= (crlf_pos + 2);
 
@@ -846,7 +892,16 @@ int httpclient_response_parse(httpclient_t *client, char *data, int len, uint32_
 		}
 	}
 
+#if HTTP_OTA_WR_RESUME
+	if (http_ota_wr_resume_accept(client->response_code == 206, range_start)) {
+		log_err("Content-Range %u not asked for", range_start);
+		return ERROR_HTTP;
+	}
+
+	if (client->response_code != 200 && client->response_code != 206) {
+#else
 	if (client->response_code != 200) {
+#endif
 		os_printf("Could not found\r\n");
 		return MQTT_SUB_INFO_NOT_FOUND_ERROR;
 	}
@@ -914,6 +969,9 @@ iotx_err_t httpclient_recv_response(httpclient_t *client, uint32_t timeout_ms, h
         if (reclen) {
             log_multi_line(LOG_DEBUG_LEVEL, "RESPONSE", "%s", buf, "<");
             ret = httpclient_response_parse(client, buf, reclen, iotx_time_left(&timer), client_data);
+        } else {
+            log_err("no response");
+            ret = ERROR_NET_TIMEOUT;
         }
     }
 
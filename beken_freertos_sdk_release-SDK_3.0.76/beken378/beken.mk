@@ -87,6 +87,7 @@ $(NAME)_SOURCES :=  app/app.c \
 					app/net_work/video_demo_station.c \
 					app/net_work/video_demo_softap.c \
 					app/http/utils_httpc.c \
+					app/http/http_ota_wr.c \
 					app/http/utils_net.c \
 					app/http/utils_timer.c \
 					app/http/lite-log.c \
@@ -128,6 +129,8 @@ $(NAME)_SOURCES :=  app/app.c \
 					func/misc/start_type.c \
 					func/rwnx_intf/rw_ieee80211.c \
 					func/rwnx_intf/rw_msdu.c \
+					func/rwnx_intf/rw_msdu_pool.c \
+					func/rwnx_intf/rw_rx_reord.c \
 					func/rwnx_intf/rw_tx_buffering.c \
 					func/rwnx_intf/rw_msg_rx.c \
 					func/rwnx_intf/rw_msg_tx.c \
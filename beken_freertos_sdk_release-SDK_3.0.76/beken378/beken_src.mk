@@ -81,6 +81,7 @@ INCLUDES += -I$(ROOT_DIR)/beken378/driver/i2c
 INCLUDES += -I$(ROOT_DIR)/beken378/driver/spi
 INCLUDES += -I$(ROOT_DIR)/beken378/driver/jpeg
 INCLUDES += -I$(ROOT_DIR)/beken378/driver/usb
+INCLUDES += -I$(ROOT_DIR)/beken378/driver/security
 INCLUDES += -I$(ROOT_DIR)/beken378/func/include
 INCLUDES += -I$(ROOT_DIR)/beken378/func/ble_wifi_exchange
 INCLUDES += -I$(ROOT_DIR)/beken378/func/rf_test
@@ -499,6 +500,7 @@ SRC_FUNC_C += ./beken378/func/usb_plug/usb_plug.c
 SRC_FUNC_C += ./beken378/func/security/security_func.c
 SRC_FUNC_C += ./beken378/func/joint_up/role_launch.c
 SRC_C += ./beken378/app/http/utils_httpc.c
+SRC_C += ./beken378/app/http/http_ota_wr.c
 SRC_C += ./beken378/app/http/utils_net.c
 SRC_C += ./beken378/app/http/utils_timer.c
 SRC_C += ./beken378/app/http/lite-log.c
@@ -512,6 +514,7 @@ ifeq ($(CFG_USE_SDCARD_HOST),1)
 SRC_FUNC_C += ./beken378/func/fatfs/cc936.c
 SRC_FUNC_C += ./beken378/func/fatfs/ccsbcs.c
 SRC_FUNC_C += ./beken378/func/fatfs/disk_io.c
+SRC_FUNC_C += ./beken378/func/fatfs/disk_cache.c
 SRC_FUNC_C += ./beken378/func/fatfs/driver_udisk.c
 SRC_FUNC_C += ./beken378/func/fatfs/ff.c
 SRC_FUNC_C += ./beken378/func/fatfs/playmode.c
@@ -584,6 +587,8 @@ SRC_FUNC_C += ./beken378/func/power_save/ap_idle.c
 SRC_FUNC_C += ./beken378/func/saradc_intf/saradc_intf.c
 SRC_FUNC_C += ./beken378/func/rwnx_intf/rw_ieee80211.c
 SRC_FUNC_C += ./beken378/func/rwnx_intf/rw_msdu.c
+SRC_FUNC_C += ./beken378/func/rwnx_intf/rw_msdu_pool.c
+SRC_FUNC_C += ./beken378/func/rwnx_intf/rw_rx_reord.c
 SRC_FUNC_C += ./beken378/func/rwnx_intf/rw_tx_buffering.c
 SRC_FUNC_C += ./beken378/func/rwnx_intf/rw_msg_rx.c
 SRC_FUNC_C += ./beken378/func/rwnx_intf/rw_msg_tx.c
@@ -617,6 +622,7 @@ endif
 
 ifeq ($(CFG_SUPPORT_MATTER), 1)
 SRC_FUNC_C += ./beken378/func/key_value_flash/flash_namespace_value.c
+SRC_FUNC_C += ./beken378/func/key_value_flash/flash_kv_log.c
 endif
 
 
@@ -763,6 +769,7 @@ SRC_FUNC_C += ./beken378/func/paho-mqtt/mqtt_ui/ssl_mqtt/ssl_mqtt_client_port.c
 SRC_FUNC_C += ./beken378/func/paho-mqtt/mqtt_ui/tcp_mqtt/tcp_mqtt_client_port.c
 SRC_FUNC_C += ./beken378/func/paho-mqtt/mqtt_ui/mqtt_client_core.c
 SRC_FUNC_C += ./beken378/func/paho-mqtt/mqtt_ui/mqtt_client_com_port.c
+SRC_FUNC_C += ./beken378/func/paho-mqtt/mqtt_ui/mqtt_topic_trie.c
 endif
 
 ifeq ("${CFG_MBEDTLS}", "1")
@@ -780,9 +787,12 @@ SRC_MBEDTLS_C += $(foreach dir, $(MBEDTLS_LIB_DIRS), $(wildcard $(dir)/*.c))
 else
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/ecp_curves_alt.c
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/ecp_alt.c
+SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/ecp_comb_alt.c
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/timing_alt.c
+SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/aes_alt.c
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/tls_certificate.c
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/tls_client.c
+SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/tls_session.c
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls-port/src/tls_net.c
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls/library/aes.c
 SRC_MBEDTLS_C += ./beken378/func/mbedtls/mbedtls/library/aesni.c
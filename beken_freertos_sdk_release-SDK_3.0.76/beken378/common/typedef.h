@@ -21,10 +21,14 @@ typedef unsigned long long    UINT64;			/* Unsigned 32 bit quantity        */
 typedef signed   long long    INT64;			/* Signed   32 bit quantity        */
 typedef float         		  FP32;			/* Single precision floating point */
 typedef double         		  FP64;			/* Double precision floating point */
+#ifdef __SIZE_TYPE__
+typedef __SIZE_TYPE__         size_t;         /* same as <stddef.h> on hosted builds */
+#else
 typedef unsigned int          size_t;
+#endif
 typedef unsigned char         BOOLEAN;
 
-#if (CFG_OS_FREERTOS) || (CFG_SUPPORT_RTT) || (CFG_SUPPORT_ALIOS) || (CFG_SUPPORT_MATTER)
+#if (CFG_OS_FREERTOS) || (CFG_SUPPORT_RTT) || (CFG_SUPPORT_ALIOS) || (CFG_SUPPORT_MATTER) || (CFG_HOST_POSIX)
 typedef unsigned char         BOOL;
 #endif
 
@@ -678,6 +678,249 @@ static UINT32 gdma_enable( GDMA_DO_PTR do_st )
     return do_st->length;
 }
 
+#if GDMA_ASYNC_ENABLE
+typedef struct
+{
+    GDMA_ASYNC_PTR head;                        //requests waiting for a channel
+    GDMA_ASYNC_PTR tail;
+    GDMA_ASYNC_PTR active[GDMA_CHANNEL_MAX];
+    UINT32 busy;                                //pool channels owned by a request
+} GDMA_ASYNC_ENV_ST;
+
+static GDMA_ASYNC_ENV_ST gdma_async;
+
+static void gdma_async_fin_handler(UINT32 channel);
+
+static void gdma_async_fin_ch0(UINT32 param)
+{
+    gdma_async_fin_handler(GDMA_CHANNEL_0);
+}
+
+static void gdma_async_fin_ch1(UINT32 param)
+{
+    gdma_async_fin_handler(GDMA_CHANNEL_1);
+}
+
+static void gdma_async_fin_ch2(UINT32 param)
+{
+    gdma_async_fin_handler(GDMA_CHANNEL_2);
+}
+
+static void gdma_async_fin_ch3(UINT32 param)
+{
+    gdma_async_fin_handler(GDMA_CHANNEL_3);
+}
+
+static void gdma_async_fin_ch4(UINT32 param)
+{
+    gdma_async_fin_handler(GDMA_CHANNEL_4);
+}
+
+static void gdma_async_fin_ch5(UINT32 param)
+{
+    gdma_async_fin_handler(GDMA_CHANNEL_5);
+}
+
+static void (*const gdma_async_fin_tbl[GDMA_CHANNEL_MAX])(UINT32) =
+{
+    gdma_async_fin_ch0,
+    gdma_async_fin_ch1,
+    gdma_async_fin_ch2,
+    gdma_async_fin_ch3,
+    gdma_async_fin_ch4,
+    gdma_async_fin_ch5,
+};
+
+static void gdma_async_skip_done(GDMA_ASYNC_PTR req)
+{
+    while(req->cur && (req->offset >= req->cur->length))
+    {
+        req->cur = req->cur->next;
+        req->offset = 0;
+    }
+}
+
+static UINT32 gdma_async_seg_len(GDMA_ASYNC_PTR req)
+{
+    return _min(req->cur->length - req->offset, GDMA_ASYNC_SEG_MAX);
+}
+
+static void gdma_async_start(UINT32 channel, GDMA_ASYNC_PTR req)
+{
+    gdma_set_dst_start_addr(channel, (UINT8 *)req->cur->dst_addr + req->offset);
+    gdma_set_src_start_addr(channel, (UINT8 *)req->cur->src_addr + req->offset);
+    gdma_set_transfer_length(channel, gdma_async_seg_len(req));
+    gdma_set_dma_en(channel, 1);
+}
+
+static void gdma_async_complete(GDMA_ASYNC_PTR req)
+{
+    req->state = GDMA_ASYNC_DONE;
+
+    if(req->cb)
+        req->cb(req->arg);
+    if(req->sema)
+        rtos_set_semaphore(req->sema);
+}
+
+/* interrupts must be disabled */
+static void gdma_async_dispatch(void)
+{
+    UINT32 channel;
+    GDMA_ASYNC_PTR req;
+
+    for(channel = 0; (channel < GDMA_CHANNEL_MAX) && gdma_async.head; channel++)
+    {
+        if(!(CFG_GDMA_ASYNC_CHANNEL_MASK & (1 << channel))
+                || (gdma_async.busy & (1 << channel)))
+            continue;
+
+        req = gdma_async.head;
+        gdma_async.head = req->next;
+        if(!gdma_async.head)
+            gdma_async.tail = NULL;
+        req->next = NULL;
+        req->state = GDMA_ASYNC_RUNNING;
+
+        gdma_async.busy |= (1 << channel);
+        gdma_async.active[channel] = req;
+        gdma_async_start(channel, req);
+    }
+}
+
+static void gdma_async_fin_handler(UINT32 channel)
+{
+    GDMA_ASYNC_PTR req = gdma_async.active[channel];
+
+    // a polled gdma_memcpy clears its own status, nothing to do otherwise
+    if(!req)
+        return;
+
+    req->offset += gdma_async_seg_len(req);
+    gdma_async_skip_done(req);
+    if(req->cur)
+    {
+        gdma_async_start(channel, req);
+        return;
+    }
+
+    gdma_async.active[channel] = NULL;
+    gdma_async.busy &= ~(1 << channel);
+    gdma_async_complete(req);
+    gdma_async_dispatch();
+}
+
+static void gdma_async_init(void)
+{
+    UINT32 channel;
+    GDMACFG_TPYES_ST cfg;
+
+    os_memset(&gdma_async, 0, sizeof(gdma_async));
+    os_memset(&cfg, 0, sizeof(GDMACFG_TPYES_ST));
+
+    cfg.dstdat_width = 32;
+    cfg.srcdat_width = 32;
+    cfg.dstptr_incr = 1;
+    cfg.srcptr_incr = 1;
+    cfg.prio = 1;
+
+    for(channel = 0; channel < GDMA_CHANNEL_MAX; channel++)
+    {
+        if(!(CFG_GDMA_ASYNC_CHANNEL_MASK & (1 << channel)))
+            continue;
+
+        // memory to memory, like channel 0
+        cfg.channel = channel;
+        gdma_congfig_type0(&cfg);
+        p_dma_fin_handler[channel] = gdma_async_fin_tbl[channel];
+        gdma_cfg_finish_inten(channel, 1);
+    }
+}
+
+/*
+ * Queue a copy of req->sg. Short requests are copied by the cpu and completed
+ * before returning, so the callback may run in the caller's context too.
+ */
+int gdma_async_submit(GDMA_ASYNC_PTR req)
+{
+    UINT32 total = 0;
+    GDMA_SG_PTR sg;
+    GLOBAL_INT_DECLARATION();
+
+    if(!req || (req->state == GDMA_ASYNC_PENDING) || (req->state == GDMA_ASYNC_RUNNING))
+        return GDMA_FAILURE;
+
+    for(sg = req->sg; sg; sg = sg->next)
+        total += sg->length;
+
+    if(!total || (total < CFG_GDMA_ASYNC_MIN_LEN))
+    {
+        for(sg = req->sg; sg; sg = sg->next)
+            os_memcpy(sg->dst_addr, sg->src_addr, sg->length);
+        gdma_async_complete(req);
+        return GDMA_SUCCESS;
+    }
+
+    req->cur = req->sg;
+    req->offset = 0;
+    req->next = NULL;
+    gdma_async_skip_done(req);
+    req->state = GDMA_ASYNC_PENDING;
+
+    GLOBAL_INT_DISABLE();
+    if(gdma_async.tail)
+        gdma_async.tail->next = req;
+    else
+        gdma_async.head = req;
+    gdma_async.tail = req;
+    gdma_async_dispatch();
+    GLOBAL_INT_RESTORE();
+
+    return GDMA_SUCCESS;
+}
+
+/* single segment helper, sg is the caller's storage for the segment */
+int gdma_async_memcpy(GDMA_ASYNC_PTR req, GDMA_SG_PTR sg, void *out, const void *in, UINT32 n,
+                      GDMA_ASYNC_CB cb, void *arg)
+{
+    sg->dst_addr = out;
+    sg->src_addr = in;
+    sg->length = n;
+    sg->next = NULL;
+
+    req->sg = sg;
+    req->cb = cb;
+    req->arg = arg;
+    req->sema = NULL;
+    req->state = GDMA_ASYNC_IDLE;
+
+    return gdma_async_submit(req);
+}
+
+int gdma_async_wait(GDMA_ASYNC_PTR req, UINT32 timeout_ms)
+{
+    if(req->sema)
+        return (rtos_get_semaphore(req->sema, timeout_ms) == kNoErr) ? GDMA_SUCCESS : GDMA_FAILURE;
+
+    while(req->state != GDMA_ASYNC_DONE)
+    {
+        if(!timeout_ms)
+            return GDMA_FAILURE;
+
+        rtos_delay_milliseconds(1);
+        if(timeout_ms != BEKEN_WAIT_FOREVER)
+            timeout_ms --;
+    }
+
+    return GDMA_SUCCESS;
+}
+
+UINT32 gdma_async_is_done(GDMA_ASYNC_PTR req)
+{
+    return (req->state == GDMA_ASYNC_DONE);
+}
+#endif // GDMA_ASYNC_ENABLE
+
 /*---------------------------------------------------------------------------*/
 void gdma_flush(void)
 {
@@ -778,6 +1021,10 @@ void gdma_init(void)
     gdma_set_priority(0);  // round-robin mode, all dma priority are same
     gdma_enable_interrupt();
 #endif // (CFG_SOC_NAME != SOC_BK7231)
+
+#if GDMA_ASYNC_ENABLE
+    gdma_async_init();
+#endif
 }
 
 void gdma_exit(void)
@@ -975,7 +1222,18 @@ void *gdma_memcpy(void *out, const void *in, UINT32 n)
     do_st.length = n;
     do_st.dst_addr = out;
     GLOBAL_INT_DISABLE();
+#if GDMA_ASYNC_ENABLE
+    // channel 0 is running a queued request, copy with the cpu meanwhile
+    if(gdma_async.busy & (1 << GDMA_CHANNEL_0))
+    {
+        GLOBAL_INT_RESTORE();
+        return os_memcpy(out, in, n);
+    }
+#endif
     gdma_enable(&do_st);
+#if GDMA_ASYNC_ENABLE
+    gdma_clr_finish_interrupt_bit(GDMA_CHANNEL_0);
+#endif
     GLOBAL_INT_RESTORE();    
 
     return out;
@@ -1008,8 +1266,9 @@ static void gdma_isr(void)
         if(status & cmp_bit) 
         {
             if(p_dma_fin_handler[i]){
-                p_dma_fin_handler[i](1);
+                // clear first, the handler may restart the channel
                 REG_WRITE(GENER_DMA_REG38_DMA_INT_STATUS, cmp_bit);
+                p_dma_fin_handler[i](1);
             }
         }
     }
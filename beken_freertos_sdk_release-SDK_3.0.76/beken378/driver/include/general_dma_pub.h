@@ -293,6 +293,72 @@ void gdma_exit(void);
 void *gdma_memcpy(void *out, const void *in, UINT32 n);
 UINT32 gdma_ctrl(UINT32 cmd, void *param);
 
+/* bk7231 has no per-channel finish interrupt, bk7252n has its own driver */
+#if CFG_GDMA_ASYNC && (CFG_SOC_NAME != SOC_BK7231) && (CFG_SOC_NAME != SOC_BK7252N)
+#define GDMA_ASYNC_ENABLE                   1
+#else
+#define GDMA_ASYNC_ENABLE                   0
+#endif
+
+#if GDMA_ASYNC_ENABLE
+#include "rtos_pub.h"
+
+/*
+ * Asynchronous memcpy: requests are queued in FIFO order on the channels of
+ * CFG_GDMA_ASYNC_CHANNEL_MASK, the finish interrupt of a channel starts the
+ * next segment, and the request completes through its callback (interrupt
+ * context) and/or semaphore. Channels other than 0 in the mask are taken
+ * away from their peripheral users (spi, audio, sdio, camera).
+ */
+#ifndef CFG_GDMA_ASYNC_CHANNEL_MASK
+#define CFG_GDMA_ASYNC_CHANNEL_MASK         (1 << GDMA_CHANNEL_0)
+#endif
+
+#ifndef CFG_GDMA_ASYNC_MIN_LEN
+#define CFG_GDMA_ASYNC_MIN_LEN              256     //shorter copies are done by the cpu at submit
+#endif
+
+#define GDMA_ASYNC_SEG_MAX                  0x10000 //largest single transfer of a channel
+
+enum
+{
+    GDMA_ASYNC_IDLE = 0,
+    GDMA_ASYNC_PENDING,
+    GDMA_ASYNC_RUNNING,
+    GDMA_ASYNC_DONE,
+};
+
+typedef struct gdma_sg_st
+{
+    void *dst_addr;
+    const void *src_addr;
+    UINT32 length;
+    struct gdma_sg_st *next;
+} GDMA_SG_ST, *GDMA_SG_PTR;
+
+typedef void (*GDMA_ASYNC_CB)(void *arg);
+
+typedef struct gdma_async_st
+{
+    GDMA_SG_PTR sg;                 //segment list, must stay valid until done
+    GDMA_ASYNC_CB cb;               //interrupt context, or the submitter for short copies
+    void *arg;
+    beken_semaphore_t *sema;        //set on completion, may be NULL
+
+    /* owned by the driver while queued */
+    GDMA_SG_PTR cur;
+    UINT32 offset;
+    volatile UINT32 state;
+    struct gdma_async_st *next;
+} GDMA_ASYNC_ST, *GDMA_ASYNC_PTR;
+
+int gdma_async_submit(GDMA_ASYNC_PTR req);
+int gdma_async_memcpy(GDMA_ASYNC_PTR req, GDMA_SG_PTR sg, void *out, const void *in, UINT32 n,
+                      GDMA_ASYNC_CB cb, void *arg);
+int gdma_async_wait(GDMA_ASYNC_PTR req, UINT32 timeout_ms);
+UINT32 gdma_async_is_done(GDMA_ASYNC_PTR req);
+#endif // GDMA_ASYNC_ENABLE
+
 #if (CFG_SOC_NAME == SOC_BK7252N)
 uint32_t bk_dma_get_transfer_len_max(dma_id_t id);
 bk_err_t bk_dma_set_transfer_len(dma_id_t id, uint32_t tran_len);
@@ -135,6 +135,11 @@ extern void uart3_isr(void);
 extern void fatal_print(const char *fmt, ...);
 extern void bk_printf(const char *fmt, ...);
 extern void bk_send_string(UINT8 uport, const char *string);
+extern void bk_print_string(const char *string);
+#if CFG_UART_DEFERRED_LOG
+extern void uart_log_flush(void);
+extern void uart_log_panic(void);
+#endif
 extern UINT32 uart_wait_tx_over();
 extern UINT8 uart_is_tx_fifo_empty(UINT8 uport);
 extern UINT8 uart_is_tx_fifo_full(UINT8 uport);
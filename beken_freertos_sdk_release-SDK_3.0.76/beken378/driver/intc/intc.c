@@ -341,6 +341,9 @@ void bk_cpu_shutdown(void)
     GLOBAL_INT_DECLARATION();
 	
     os_printf("shutdown...\n");
+#if CFG_UART_DEFERRED_LOG
+    uart_log_flush();
+#endif
 	
     GLOBAL_INT_DISABLE();	
     while(1);
@@ -349,6 +352,9 @@ void bk_cpu_shutdown(void)
 
 void bk_show_register (struct arm_registers *regs)
 {
+#if CFG_UART_DEFERRED_LOG
+    uart_log_panic();
+#endif
     os_printf("Current regs:\n");
     os_printf("r00:0x%08x r01:0x%08x r02:0x%08x r03:0x%08x\n",
                regs->r0, regs->r1, regs->r2, regs->r3);
@@ -1247,13 +1247,13 @@ void __wrap_printf(const char *fmt, ...)
 	va_start(ap, fmt);
 	__wrap_vsnprintf(string, sizeof(string) - 1, fmt, ap);
 	string[127] = 0;
-	bk_send_string(uart_print_port, string);
+	bk_print_string(string);
 	va_end(ap);
 }
 
 int __wrap_puts(const char *s)
 {
-    bk_send_string(uart_print_port, s);
+    bk_print_string(s);
 
 	return 1;	/* non-negative value returned */
 }
@@ -156,6 +156,136 @@ void bk_send_string(UINT8 uport, const char *string)
     }
 }
 
+#if CFG_UART_DEFERRED_LOG
+/*
+ * deferred log: the printing context only copies the formatted line into a
+ * ring, the tx fifo need-write interrupt of the print port drains it. A line
+ * that does not fit is dropped and counted, and a notice with the count is
+ * queued in front of the next line that fits.
+ */
+#define UART_LOG_RING_MASK          (CFG_UART_DEFERRED_LOG_SIZE - 1)
+
+static UINT8 uart_log_ring[CFG_UART_DEFERRED_LOG_SIZE];
+static volatile UINT32 uart_log_wr;     // free running, advanced by the printers
+static volatile UINT32 uart_log_rd;     // free running, advanced by the drain
+static UINT32 uart_log_dropped;         // lines lost since the last notice
+static UINT8 uart_log_sync;             // crash path, print directly again
+
+/* bytes of string once '\n' is expanded to "\r\n" like bk_send_string */
+static UINT32 uart_log_len(const char *string)
+{
+    const char *p = string;
+    UINT32 len = 0;
+
+    while(*string)
+    {
+        if ((*string == '\n') && (p == string || *(string - 1) != '\r'))
+            len ++;
+        len ++;
+        string ++;
+    }
+
+    return len;
+}
+
+static void uart_log_copy(const char *string)
+{
+    const char *p = string;
+
+    while(*string)
+    {
+        if ((*string == '\n') && (p == string || *(string - 1) != '\r'))
+            uart_log_ring[(uart_log_wr ++) & UART_LOG_RING_MASK] = '\r';
+        uart_log_ring[(uart_log_wr ++) & UART_LOG_RING_MASK] = *string++;
+    }
+}
+
+static void uart_log_put(const char *string)
+{
+    char notice[32];
+    UINT32 len, notice_len = 0;
+    GLOBAL_INT_DECLARATION();
+
+    len = uart_log_len(string);
+    if(!len)
+        return;
+
+    GLOBAL_INT_DISABLE();
+    if(uart_log_dropped)
+    {
+        snprintf(notice, sizeof(notice), "[%u log dropped]\r\n", (unsigned int)uart_log_dropped);
+        notice_len = uart_log_len(notice);
+    }
+
+    if(len + notice_len > CFG_UART_DEFERRED_LOG_SIZE - (uart_log_wr - uart_log_rd))
+    {
+        uart_log_dropped ++;
+    }
+    else
+    {
+        if(notice_len)
+        {
+            uart_log_copy(notice);
+            uart_log_dropped = 0;
+        }
+        uart_log_copy(string);
+        uart_set_tx_fifo_needwr_int(uart_print_port, 1);
+    }
+    GLOBAL_INT_RESTORE();
+}
+
+/* isr context of the print port */
+static void uart_log_drain(UINT8 uport)
+{
+    UINT32 val;
+
+    while(uart_log_rd != uart_log_wr)
+    {
+        if(uart_is_tx_fifo_full(uport))
+            return;
+
+        val = uart_log_ring[uart_log_rd & UART_LOG_RING_MASK];
+        UART_WRITE_BYTE(uport, val);
+        uart_log_rd ++;
+    }
+
+    uart_set_tx_fifo_needwr_int(uport, 0);
+}
+
+/* push out everything queued, polling the fifo */
+void uart_log_flush(void)
+{
+    GLOBAL_INT_DECLARATION();
+
+    GLOBAL_INT_DISABLE();
+    while(uart_log_rd != uart_log_wr)
+    {
+        bk_send_byte(uart_print_port, uart_log_ring[uart_log_rd & UART_LOG_RING_MASK]);
+        uart_log_rd ++;
+    }
+    GLOBAL_INT_RESTORE();
+}
+
+/* interrupts will not run any more, print synchronously from here on */
+void uart_log_panic(void)
+{
+    uart_log_sync = 1;
+    uart_log_flush();
+}
+#endif // CFG_UART_DEFERRED_LOG
+
+void bk_print_string(const char *string)
+{
+#if CFG_UART_DEFERRED_LOG
+    if(!uart_log_sync)
+    {
+        uart_log_put(string);
+        return;
+    }
+#endif
+    bk_send_string(uart_print_port, string);
+}
+
 /*uart2 as deubg port*/
 void bk_printf(const char *fmt, ...)
 {
@@ -185,7 +315,7 @@ void bk_printf(const char *fmt, ...)
     va_start(ap, fmt);
     vsnprintf(string, sizeof(string) - 1, fmt, ap);
     string[127] = 0;
-    bk_send_string(uart_print_port, string);
+    bk_print_string(string);
     va_end(ap);
 #endif
 
@@ -206,6 +336,9 @@ void print_hex_dump(const char *prefix, void *buf, int len)
 void fatal_print(const char *fmt, ...)
 {
     os_printf(fmt);
+#if CFG_UART_DEFERRED_LOG
+    uart_log_panic();
+#endif
 
     DEAD_WHILE();
 }
@@ -743,6 +876,10 @@ void uart1_isr(void)
 
     if(status & TX_FIFO_NEED_WRITE_STA)
     {
+#if CFG_UART_DEFERRED_LOG
+        if(UART1_PORT == uart_print_port)
+            uart_log_drain(UART1_PORT);
+#endif
         if (uart_txfifo_needwr_callback[0].callback != 0)
         {
             void *param = uart_txfifo_needwr_callback[0].param;
@@ -997,6 +1134,10 @@ void uart2_isr(void)
 
 	if(status & TX_FIFO_NEED_WRITE_STA)
     {
+#if CFG_UART_DEFERRED_LOG
+        if(UART2_PORT == uart_print_port)
+            uart_log_drain(UART2_PORT);
+#endif
         if (uart_txfifo_needwr_callback[1].callback != 0)
         {
             void *param = uart_txfifo_needwr_callback[1].param;
@@ -1251,6 +1392,10 @@ void uart3_isr(void)
 
     if(status & TX_FIFO_NEED_WRITE_STA)
     {
+#if CFG_UART_DEFERRED_LOG
+        if(UART3_PORT == uart_print_port)
+            uart_log_drain(UART3_PORT);
+#endif
         if (uart_txfifo_needwr_callback[2].callback != 0)
         {
             void *param = uart_txfifo_needwr_callback[2].param;
@@ -1478,6 +1623,9 @@ UINT32 uart3_ctrl(UINT32 cmd, void *parm)
 
 UINT32 uart_wait_tx_over()
 {
+#if CFG_UART_DEFERRED_LOG
+    uart_log_flush();
+#endif
 #if !(CFG_SOC_NAME == SOC_BK7252N)
     UINT32 uart_wait_us,baudrate1,baudrate2;
 #else
@@ -128,6 +128,12 @@
 
 #define DEBUG_TX_FIFO_MAX_COUNT     16
 
+#if CFG_UART_DEFERRED_LOG
+#ifndef CFG_UART_DEFERRED_LOG_SIZE
+#define CFG_UART_DEFERRED_LOG_SIZE  4096   // power of two
+#endif
+#endif
+
 /* uart parameter config----end*/
 
 typedef struct _uart_
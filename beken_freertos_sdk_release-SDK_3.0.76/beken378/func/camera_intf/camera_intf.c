@@ -56,6 +56,9 @@ void camera_intf_delay_timer_hdl(UINT8 param)
     GDMA_CFG_ST en_cfg;
     UINT16 already_len = ejpeg_cfg.rx_read_len;
     UINT32 channel = ejpeg_cfg.dma_channel;
+    #if CFG_VIDEO_DMA_FRAME_RING
+    UINT16 last_node = already_len;
+    #endif
     GLOBAL_INT_DECLARATION();
 
     if (ejpeg_hdl == DD_HANDLE_UNVALID)
@@ -94,7 +97,25 @@ void camera_intf_delay_timer_hdl(UINT8 param)
     en_cfg.param = 0;
     sddev_control(GDMA_DEV_NAME, CMD_GDMA_SET_DMA_ENABLE, &en_cfg);
 
+    #if CFG_VIDEO_DMA_FRAME_RING
+    // rxbuf holds the queued frames, start the next one on the node
+    // following this frame instead of overwriting the first node
+    already_len = last_node;
+    if (rec_len > 0)
+    {
+        already_len += ejpeg_cfg.node_len;
+        if (already_len >= ejpeg_cfg.rxbuf_len)
+        {
+            already_len -= ejpeg_cfg.rxbuf_len;
+        }
+    }
+
+    en_cfg.param = (UINT32)(ejpeg_cfg.rxbuf + already_len);
+    sddev_control(GDMA_DEV_NAME, CMD_GDMA_SET_DST_START_ADDR, &en_cfg);
+    ejpeg_cfg.rx_read_len = already_len;
+    #else
     ejpeg_cfg.rx_read_len = 0;
+    #endif
     en_cfg.param = 1;
     sddev_control(GDMA_DEV_NAME, CMD_GDMA_SET_DMA_ENABLE, &en_cfg);
     #endif
@@ -447,7 +447,7 @@ static EfErrCode del_env(const char *key){
     }
     /* calculate remain ENV length */
     remain_env_length = get_env_data_size()
-            - (((uint32_t) del_env + del_env_length) - ((uint32_t) env_cache + ENV_PARAM_BYTE_SIZE));
+            - (((uintptr_t) del_env + del_env_length) - ((uintptr_t) env_cache + ENV_PARAM_BYTE_SIZE));
     /* remain ENV move forward */
     memcpy(del_env, del_env + del_env_length, remain_env_length);
     /* reset ENV end address */
@@ -40,6 +40,9 @@
  * Please change it when your firmware add a new ENV to default_env_set.
  */
 #define EF_ENV_VER_NUM            0x00400001  // "4.0.1"
+
+/* RAM hash index of all ENV names (8 bytes per entry, power of 2), the ENV lookup won't scan the flash */
+/* #define EF_ENV_INDEX_TABLE_SIZE   64 */
  
 /* MCU Endian Configuration, default is Little Endian Order. */
 /* #define EF_BIG_ENDIAN  */         
@@ -82,6 +82,22 @@
 #define EF_ENV_USING_CACHE
 #endif
 
+/* the ENV hash index table size, it maps every ENV name to its address, 0: disable the index */
+#ifndef EF_ENV_INDEX_TABLE_SIZE
+#define EF_ENV_INDEX_TABLE_SIZE                  0
+#endif
+
+#if EF_ENV_INDEX_TABLE_SIZE > 0
+#if (EF_ENV_INDEX_TABLE_SIZE & (EF_ENV_INDEX_TABLE_SIZE - 1)) != 0
+#error "The ENV index table size must be a power of 2"
+#endif
+#define EF_ENV_USING_INDEX
+/* rebuild the index when used slots (alive and deleted) is over 3/4 of the table */
+#define ENV_INDEX_LOAD_MAX                       (EF_ENV_INDEX_TABLE_SIZE * 3 / 4)
+/* deleted slot mark, ENV address is always aligned so it never be a valid address */
+#define ENV_INDEX_DELETED_ADDR                   0xFFFFFFFE
+#endif
+
 /* the sector is not combined value */
 #define SECTOR_NOT_COMBINED                      0xFFFFFFFF
 /* the next address is get failed */
@@ -191,6 +207,12 @@ struct env_cache_node {
 };
 typedef struct env_cache_node *env_cache_node_t;
 
+struct env_index_node {
+    uint32_t name_hash;                          /**< ENV name's CRC32 high 24bit value | name length */
+    uint32_t addr;                               /**< ENV node address, FAILED_ADDR: empty slot */
+};
+typedef struct env_index_node *env_index_node_t;
+
 struct sector_cache_node {
     uint32_t addr;                               /**< sector start address */
     uint32_t empty_addr;                         /**< sector empty address */
@@ -219,6 +241,15 @@ struct env_cache_node env_cache_table[EF_ENV_CACHE_TABLE_SIZE] = { 0 };
 struct sector_cache_node sector_cache_table[EF_SECTOR_CACHE_TABLE_SIZE] = { 0 };
 #endif /* EF_ENV_USING_CACHE */
 
+#ifdef EF_ENV_USING_INDEX
+/* ENV hash index table, open addressing with linear probing */
+static struct env_index_node env_index_table[EF_ENV_INDEX_TABLE_SIZE];
+/* used slot number, include the deleted slots */
+static size_t env_index_used = 0;
+/* the index holds every ENV in flash, a missed ENV is not exist when it's true */
+static bool env_index_ok = false;
+#endif /* EF_ENV_USING_INDEX */
+
 static size_t set_status(uint8_t status_table[], size_t status_num, size_t status_index)
 {
     size_t byte_index = ~0UL;
@@ -419,6 +450,158 @@ static bool get_env_from_cache(const char *name, size_t name_len, uint32_t *addr
 }
 #endif /* EF_ENV_USING_CACHE */
 
+#ifdef EF_ENV_USING_INDEX
+static void env_iterator(env_node_obj_t env, void *arg1, void *arg2,
+        bool (*callback)(env_node_obj_t env, void *arg1, void *arg2));
+
+static uint32_t env_index_hash(const char *name, size_t name_len)
+{
+    return (ef_calc_crc32(0, name, name_len) & 0xFFFFFF00) | (name_len & 0xFF);
+}
+
+/*
+ * Find the index slot of the ENV. The slot is matched by address when addr isn't FAILED_ADDR,
+ * otherwise by the ENV name in flash. It's return EF_ENV_INDEX_TABLE_SIZE when not found.
+ */
+static size_t env_index_find(const char *name, uint32_t name_hash, uint32_t addr)
+{
+    size_t i, n, name_len = name_hash & 0xFF;
+    env_index_node_t node;
+
+    for (i = name_hash >> 8, n = 0; n < EF_ENV_INDEX_TABLE_SIZE; i++, n++) {
+        node = &env_index_table[i & (EF_ENV_INDEX_TABLE_SIZE - 1)];
+        if (node->addr == FAILED_ADDR) {
+            break;
+        }
+        if (node->addr == ENV_INDEX_DELETED_ADDR || node->name_hash != name_hash) {
+            continue;
+        }
+        if (addr != FAILED_ADDR) {
+            if (node->addr == addr) {
+                return i & (EF_ENV_INDEX_TABLE_SIZE - 1);
+            }
+        } else {
+            char saved_name[EF_ENV_NAME_MAX];
+            /* read the ENV name in flash */
+            ef_port_read(node->addr + ENV_HDR_DATA_SIZE, (uint32_t *) saved_name, EF_ENV_NAME_MAX);
+            if (!strncmp(name, saved_name, name_len)) {
+                return i & (EF_ENV_INDEX_TABLE_SIZE - 1);
+            }
+        }
+    }
+
+    return EF_ENV_INDEX_TABLE_SIZE;
+}
+
+/*
+ * Put the ENV to a free slot, the caller make sure the ENV isn't in index.
+ */
+static bool env_index_insert(uint32_t name_hash, uint32_t addr)
+{
+    size_t i, n;
+    env_index_node_t node;
+
+    if (env_index_used >= ENV_INDEX_LOAD_MAX) {
+        return false;
+    }
+    for (i = name_hash >> 8, n = 0; n < EF_ENV_INDEX_TABLE_SIZE; i++, n++) {
+        node = &env_index_table[i & (EF_ENV_INDEX_TABLE_SIZE - 1)];
+        if (node->addr == ENV_INDEX_DELETED_ADDR) {
+            break;
+        } else if (node->addr == FAILED_ADDR) {
+            env_index_used++;
+            break;
+        }
+    }
+    node->name_hash = name_hash;
+    node->addr = addr;
+
+    return true;
+}
+
+static bool env_index_build_cb(env_node_obj_t env, void *arg1, void *arg2)
+{
+    if (env->crc_is_ok && env->status == ENV_WRITE
+            && !env_index_insert(env_index_hash(env->name, env->name_len), env->addr.start)) {
+        EF_INFO("Warning: The ENV index table is full, the index is disabled.\n");
+        env_index_ok = false;
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * Clear the index, and load all ENV in flash to index when rebuild is true.
+ */
+static void env_index_reset(bool rebuild)
+{
+    struct env_node_obj env;
+
+    memset(env_index_table, 0xFF, sizeof(env_index_table));
+    env_index_used = 0;
+    env_index_ok = true;
+    if (rebuild) {
+        env_iterator(&env, NULL, NULL, env_index_build_cb);
+    }
+}
+
+/*
+ * Add or update the ENV address in index, it must be called after the ENV status is ENV_WRITE.
+ */
+static void update_env_index(const char *name, size_t name_len, uint32_t addr)
+{
+    uint32_t name_hash;
+    size_t i;
+
+    if (!env_index_ok) {
+        return;
+    }
+    name_hash = env_index_hash(name, name_len);
+    if ((i = env_index_find(name, name_hash, FAILED_ADDR)) < EF_ENV_INDEX_TABLE_SIZE) {
+        env_index_table[i].addr = addr;
+    } else if (!env_index_insert(name_hash, addr)) {
+        /* too many deleted slots, the new ENV is already in flash */
+        env_index_reset(true);
+    }
+}
+
+/*
+ * Change the ENV address in index when it's moved, or delete it when new_addr is FAILED_ADDR.
+ * The old address isn't in index when it's an old value which was prepare deleted.
+ */
+static void move_env_index(const char *name, size_t name_len, uint32_t old_addr, uint32_t new_addr)
+{
+    size_t i;
+
+    if (!env_index_ok) {
+        return;
+    }
+    if ((i = env_index_find(name, env_index_hash(name, name_len), old_addr)) < EF_ENV_INDEX_TABLE_SIZE) {
+        env_index_table[i].addr = (new_addr == FAILED_ADDR) ? ENV_INDEX_DELETED_ADDR : new_addr;
+    }
+}
+
+/*
+ * Get ENV address from index. It's return false when the index can't decide.
+ */
+static bool get_env_from_index(const char *name, size_t name_len, uint32_t *addr)
+{
+    size_t i;
+
+    if (!env_index_ok) {
+        return false;
+    }
+    if ((i = env_index_find(name, env_index_hash(name, name_len), FAILED_ADDR)) < EF_ENV_INDEX_TABLE_SIZE) {
+        *addr = env_index_table[i].addr;
+    } else {
+        *addr = FAILED_ADDR;
+    }
+
+    return true;
+}
+#endif /* EF_ENV_USING_INDEX */
+
 /*
  * find the continue 0xFF flash address to end address
  */
@@ -737,15 +920,28 @@ static bool find_env(const char *key, env_node_obj_t env)
 {
     bool find_ok = false;
 
-#ifdef EF_ENV_USING_CACHE
+#if defined(EF_ENV_USING_CACHE) || defined(EF_ENV_USING_INDEX)
     size_t key_len = strlen(key);
+#endif
 
+#ifdef EF_ENV_USING_CACHE
     if (get_env_from_cache(key, key_len, &env->addr.start)) {
         read_env(env);
         return true;
     }
 #endif /* EF_ENV_USING_CACHE */
 
+#ifdef EF_ENV_USING_INDEX
+    if (get_env_from_index(key, key_len, &env->addr.start)) {
+        /* the index holds all ENV, don't need search the flash when it's missed */
+        if (env->addr.start == FAILED_ADDR) {
+            return false;
+        }
+        read_env(env);
+        find_ok = env->crc_is_ok && env->status == ENV_WRITE;
+    }
+    if (!find_ok)
+#endif /* EF_ENV_USING_INDEX */
     find_ok = find_env_no_cache(key, env);
 
 #ifdef EF_ENV_USING_CACHE
@@ -1061,6 +1257,7 @@ static uint32_t alloc_env(sector_meta_data_t sector, size_t env_size)
 static EfErrCode del_env(const char *key, env_node_obj_t old_env, bool complete_del) {
     EfErrCode result = EF_NO_ERR;
     uint32_t dirty_status_addr;
+    struct env_node_obj env;
     static bool last_is_complete_del = false;
 
 #if (ENV_STATUS_TABLE_SIZE >= DIRTY_STATUS_TABLE_SIZE)
@@ -1071,7 +1268,6 @@ static EfErrCode del_env(const char *key, env_node_obj_t old_env, bool complete_
 
     /* need find ENV */
     if (!old_env) {
-        struct env_node_obj env;
         /* find ENV */
         if (find_env(key, &env)) {
             old_env = &env;
@@ -1100,6 +1296,17 @@ static EfErrCode del_env(const char *key, env_node_obj_t old_env, bool complete_
 #endif /* EF_ENV_USING_CACHE */
         }
 
+#ifdef EF_ENV_USING_INDEX
+        /* it's already moved to the new ENV when the ENV value is changed or the ENV is moved */
+        if (result == EF_NO_ERR) {
+            if (key != NULL) {
+                move_env_index(key, strlen(key), old_env->addr.start, FAILED_ADDR);
+            } else {
+                move_env_index(old_env->name, old_env->name_len, old_env->addr.start, FAILED_ADDR);
+            }
+        }
+#endif /* EF_ENV_USING_INDEX */
+
         last_is_complete_del = false;
     }
 
@@ -1169,6 +1376,10 @@ static EfErrCode move_env(env_node_obj_t env)
                 env_addr + ENV_HDR_DATA_SIZE + EF_WG_ALIGN(env->name_len) + EF_WG_ALIGN(env->value_len));
         update_env_cache(env->name, env->name_len, env_addr);
 #endif /* EF_ENV_USING_CACHE */
+
+#ifdef EF_ENV_USING_INDEX
+        move_env_index(env->name, env->name_len, env->addr.start, env_addr);
+#endif /* EF_ENV_USING_INDEX */
     }
 
     EF_DEBUG("Moved the ENV (%.*s) from 0x%08X to 0x%08X.\n", env->name_len, env->name, env->addr.start, env_addr);
@@ -1361,6 +1572,11 @@ static EfErrCode create_env_blob(sector_meta_data_t sector, const char *key, con
         if (result == EF_NO_ERR) {
             result = write_status(env_addr, env_hdr.status_table, ENV_STATUS_NUM, ENV_WRITE);
         }
+#ifdef EF_ENV_USING_INDEX
+        if (result == EF_NO_ERR) {
+            update_env_index(key, env_hdr.name_len, env_addr);
+        }
+#endif /* EF_ENV_USING_INDEX */
         /* trigger GC collect when current sector is full */
         if (result == EF_NO_ERR && is_full) {
             EF_DEBUG("Trigger a GC check after created ENV.\n");
@@ -1539,6 +1755,12 @@ EfErrCode ef_env_set_default(void)
 
     /* lock the ENV cache */
     ef_port_env_lock();
+#ifdef EF_ENV_USING_INDEX
+    /* all ENV will be removed, the default ENV is added to index when it's created */
+    if (env_index_ok) {
+        env_index_reset(false);
+    }
+#endif /* EF_ENV_USING_INDEX */
     /* format all sectors */
     for (addr = env_start_addr; addr < env_start_addr + ENV_AREA_SIZE; addr += SECTOR_SIZE) {
         result = format_sector(addr, SECTOR_NOT_COMBINED);
@@ -1766,6 +1988,11 @@ __retry:
 
     in_recovery_check = false;
 
+#ifdef EF_ENV_USING_INDEX
+    /* load all ENV to index */
+    env_index_reset(true);
+#endif /* EF_ENV_USING_INDEX */
+
     /* unlock the ENV cache */
     ef_port_env_unlock();
 
@@ -0,0 +1,345 @@
+#include "include.h"
+#include "disk_cache.h"
+
+#if (CFG_USE_USB_HOST && CFG_FATFS_DISK_CACHE)
+#include "mem_pub.h"
+#include "driver_udisk.h"
+
+/*
+ * The cache is CFG_FATFS_CACHE_LINES lines of CFG_FATFS_CACHE_LINE_SECTORS
+ * sectors, kept back to back in one buffer and reused in fifo order. Lines
+ * filled or written one after the other therefore sit in neighbouring slots,
+ * so a read miss in a sequential stream fills several lines with one
+ * transfer and a write-back merges dirty runs across slots.
+ */
+#define DC_LINES                CFG_FATFS_CACHE_LINES
+#define DC_LINE_SECTORS         CFG_FATFS_CACHE_LINE_SECTORS
+#define DC_LINE_BYTES           (DC_LINE_SECTORS * _MAX_SS)
+#define DC_SEQ_THRESHOLD        2   /* back to back reads before reading ahead */
+#define DC_NO_LINE              0xFFFFFFFF
+
+#if (DC_LINE_SECTORS > 32)
+#error "CFG_FATFS_CACHE_LINE_SECTORS must fit the 32 bit sector bitmaps"
+#endif
+
+#define DC_MASK(from, to)       ((((to) >= 32) ? 0xFFFFFFFF : ((1UL << (to)) - 1)) & ~((1UL << (from)) - 1))
+
+typedef struct
+{
+    uint32 base;        /* first sector, DC_NO_LINE when the slot is free */
+    uint32 valid;       /* sector bitmaps */
+    uint32 dirty;
+} DC_LINE_T;
+
+typedef struct
+{
+    uint8 *buf;
+    uint32 total;       /* sectors on the medium, 0 if unknown */
+    uint32 victim;      /* next slot to reuse */
+    uint32 next_sector; /* where a sequential read would continue */
+    uint32 seq;
+    DC_LINE_T line[DC_LINES];
+} DISK_CACHE_T;
+
+static DISK_CACHE_T dc;
+
+static uint8 *dc_data(int idx, uint32 sector)
+{
+    return dc.buf + idx * DC_LINE_BYTES + (sector - dc.line[idx].base) * _MAX_SS;
+}
+
+static int dc_lookup(uint32 base)
+{
+    int i;
+
+    for (i = 0; i < DC_LINES; i++)
+    {
+        if (dc.line[i].base == base)
+            return i;
+    }
+
+    return -1;
+}
+
+/* write back line idx, a run reaching the end of the line goes on into
+   the next slots while they hold the following lines */
+static DRESULT dc_flush_line(int idx)
+{
+    DC_LINE_T *l = &dc.line[idx];
+    uint32 s, e, count;
+    int last, i;
+
+    while (l->dirty)
+    {
+        for (s = 0; !(l->dirty & (1UL << s)); s++)
+            ;
+        for (e = s; (e < DC_LINE_SECTORS) && (l->dirty & (1UL << e)); e++)
+            ;
+        count = e - s;
+        last = idx;
+
+        while ((e == DC_LINE_SECTORS) && (last + 1 < DC_LINES)
+                && (dc.line[last + 1].base == dc.line[last].base + DC_LINE_SECTORS)
+                && (dc.line[last + 1].dirty & 1))
+        {
+            last++;
+            for (e = 0; (e < DC_LINE_SECTORS) && (dc.line[last].dirty & (1UL << e)); e++)
+                ;
+            count += e;
+        }
+
+        if (udisk_wr_blk_sync(l->base + s, count, dc_data(idx, l->base + s)) != USB_RET_OK)
+            return RES_ERROR;
+
+        if (last == idx)
+        {
+            l->dirty &= ~DC_MASK(s, e);
+        }
+        else
+        {
+            l->dirty &= ~DC_MASK(s, DC_LINE_SECTORS);
+            for (i = idx + 1; i < last; i++)
+                dc.line[i].dirty = 0;
+            dc.line[last].dirty &= ~DC_MASK(0, e);
+        }
+    }
+
+    return RES_OK;
+}
+
+/* hand out nlines free slots in a row starting at the fifo victim */
+static int dc_take(int nlines)
+{
+    int idx = dc.victim, i;
+
+    for (i = 0; i < nlines; i++)
+    {
+        if (dc.line[idx + i].dirty && (dc_flush_line(idx + i) != RES_OK))
+            return -1;
+        dc.line[idx + i].base = DC_NO_LINE;
+        dc.line[idx + i].valid = 0;
+    }
+    dc.victim = (idx + nlines) % DC_LINES;
+
+    return idx;
+}
+
+static int dc_read_lines(int idx, int nlines)
+{
+    uint32 base = dc.line[idx].base;
+    uint32 count = nlines * DC_LINE_SECTORS;
+    int i;
+
+    if (dc.total && (base + count > dc.total))
+        count = dc.total - base;
+
+    if (udisk_rd_blk_sync(base, count, dc.buf + idx * DC_LINE_BYTES) != USB_RET_OK)
+        return -1;
+
+    for (i = 0; i < nlines; i++, count -= DC_LINE_SECTORS)
+        dc.line[idx + i].valid = (count >= DC_LINE_SECTORS) ? DC_MASK(0, DC_LINE_SECTORS) : DC_MASK(0, count);
+
+    return 0;
+}
+
+static int dc_fill(uint32 base, int nlines)
+{
+    int idx, i;
+
+    if (dc.victim + nlines > DC_LINES)
+        nlines = DC_LINES - dc.victim;
+    for (i = 1; i < nlines; i++)
+    {
+        if ((dc.total && (base + i * DC_LINE_SECTORS >= dc.total))
+                || (dc_lookup(base + i * DC_LINE_SECTORS) >= 0))
+            break;
+    }
+    nlines = i;
+
+    idx = dc_take(nlines);
+    if (idx < 0)
+        return -1;
+    for (i = 0; i < nlines; i++)
+        dc.line[idx + i].base = base + i * DC_LINE_SECTORS;
+
+    if (dc_read_lines(idx, nlines) == 0)
+        return idx;
+
+    /* the read ahead may run off the end of a medium of unknown size */
+    for (i = 1; i < nlines; i++)
+        dc.line[idx + i].base = DC_NO_LINE;
+    if ((nlines > 1) && (dc_read_lines(idx, 1) == 0))
+        return idx;
+
+    dc.line[idx].base = DC_NO_LINE;
+    return -1;
+}
+
+/* slot holding a valid copy of sector */
+static int dc_get(uint32 sector, int nlines)
+{
+    uint32 base = sector - sector % DC_LINE_SECTORS;
+    int idx;
+
+    idx = dc_lookup(base);
+    if (idx < 0)
+        return dc_fill(base, nlines);
+
+    if (!(dc.line[idx].valid & (1UL << (sector - base))))
+    {
+        /* partly written line, get its dirty sectors out before reloading it */
+        if ((dc_flush_line(idx) != RES_OK) || (dc_read_lines(idx, 1) != 0))
+            return -1;
+    }
+
+    return idx;
+}
+
+DRESULT disk_cache_read(BYTE *buff, DWORD sector, UINT count)
+{
+    uint32 i, s;
+    int idx, nlines = 1;
+
+    if (dc.buf == NULL)
+        return (udisk_rd_blk_sync(sector, count, buff) == USB_RET_OK) ? RES_OK : RES_ERROR;
+
+    if (sector == dc.next_sector)
+        dc.seq++;
+    else
+        dc.seq = 0;
+    dc.next_sector = sector + count;
+    if (dc.seq >= DC_SEQ_THRESHOLD)
+        nlines += CFG_FATFS_CACHE_READAHEAD;
+
+    if (count >= DC_LINE_SECTORS)
+    {
+        /* large reads go straight to the buffer, dirty sectors are newer than the medium */
+        if (udisk_rd_blk_sync(sector, count, buff) != USB_RET_OK)
+            return RES_ERROR;
+
+        for (idx = 0; idx < DC_LINES; idx++)
+        {
+            for (i = 0; dc.line[idx].dirty && (i < DC_LINE_SECTORS); i++)
+            {
+                s = dc.line[idx].base + i;
+                if ((dc.line[idx].dirty & (1UL << i)) && (s >= sector) && (s < sector + count))
+                    os_memcpy(buff + (s - sector) * _MAX_SS, dc_data(idx, s), _MAX_SS);
+            }
+        }
+
+        return RES_OK;
+    }
+
+    for (; count > 0; count--, sector++, buff += _MAX_SS)
+    {
+        idx = dc_get(sector, nlines);
+        if (idx < 0)
+            return RES_ERROR;
+        os_memcpy(buff, dc_data(idx, sector), _MAX_SS);
+    }
+
+    return RES_OK;
+}
+
+DRESULT disk_cache_write(const BYTE *buff, DWORD sector, UINT count)
+{
+    uint32 base, bit, i, s;
+    int idx;
+
+    if (dc.buf == NULL)
+        return (udisk_wr_blk_sync(sector, count, (uint8 *)buff) == USB_RET_OK) ? RES_OK : RES_ERROR;
+
+    if (count >= DC_LINE_SECTORS)
+    {
+        /* write through, cached copies take the new data and turn clean */
+        if (udisk_wr_blk_sync(sector, count, (uint8 *)buff) != USB_RET_OK)
+            return RES_ERROR;
+
+        for (idx = 0; idx < DC_LINES; idx++)
+        {
+            for (i = 0; dc.line[idx].valid && (i < DC_LINE_SECTORS); i++)
+            {
+                s = dc.line[idx].base + i;
+                if ((dc.line[idx].valid & (1UL << i)) && (s >= sector) && (s < sector + count))
+                {
+                    os_memcpy(dc_data(idx, s), buff + (s - sector) * _MAX_SS, _MAX_SS);
+                    dc.line[idx].dirty &= ~(1UL << i);
+                }
+            }
+        }
+
+        return RES_OK;
+    }
+
+    for (; count > 0; count--, sector++, buff += _MAX_SS)
+    {
+        base = sector - sector % DC_LINE_SECTORS;
+        idx = dc_lookup(base);
+        if (idx < 0)
+        {
+            idx = dc_take(1);
+            if (idx < 0)
+                return RES_ERROR;
+            dc.line[idx].base = base;
+        }
+
+        bit = 1UL << (sector - base);
+        os_memcpy(dc_data(idx, sector), buff, _MAX_SS);
+        dc.line[idx].valid |= bit;
+        dc.line[idx].dirty |= bit;
+    }
+
+    return RES_OK;
+}
+
+DRESULT disk_cache_sync(void)
+{
+    DRESULT res = RES_OK;
+    int i;
+
+    if (dc.buf == NULL)
+        return RES_OK;
+
+    for (i = 0; i < DC_LINES; i++)
+    {
+        if (dc_flush_line(i) != RES_OK)
+            res = RES_ERROR;
+    }
+
+    return res;
+}
+
+void disk_cache_init(uint32 total_sectors)
+{
+    int i;
+
+    if (dc.buf == NULL)
+    {
+        /* os_malloc prefers psram on the parts that have it */
+        dc.buf = (uint8 *)os_malloc(DC_LINES * DC_LINE_BYTES);
+        if (dc.buf == NULL)
+            FAT_WARN("disk cache: no memory, uncached\r\n");
+    }
+
+    dc.total = total_sectors;
+    dc.victim = 0;
+    dc.next_sector = DC_NO_LINE;
+    dc.seq = 0;
+    for (i = 0; i < DC_LINES; i++)
+    {
+        dc.line[i].base = DC_NO_LINE;
+        dc.line[i].valid = 0;
+        dc.line[i].dirty = 0;
+    }
+}
+
+void disk_cache_deinit(void)
+{
+    if (dc.buf == NULL)
+        return;
+
+    disk_cache_sync();
+    os_free(dc.buf);
+    dc.buf = NULL;
+}
+#endif // (CFG_USE_USB_HOST && CFG_FATFS_DISK_CACHE)
@@ -0,0 +1,16 @@
+#ifndef _DISK_CACHE_H_
+#define _DISK_CACHE_H_
+
+#include "include.h"
+#include "diskio.h"
+
+#if (CFG_USE_USB_HOST && CFG_FATFS_DISK_CACHE)
+/* sector cache between fatfs and the usb disk driver, total_sectors 0 means unknown */
+void disk_cache_init(uint32 total_sectors);
+void disk_cache_deinit(void);
+DRESULT disk_cache_read(BYTE *buff, DWORD sector, UINT count);
+DRESULT disk_cache_write(const BYTE *buff, DWORD sector, UINT count);
+DRESULT disk_cache_sync(void);
+#endif
+
+#endif // _DISK_CACHE_H_
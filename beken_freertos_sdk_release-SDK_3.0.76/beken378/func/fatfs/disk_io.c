@@ -144,6 +144,7 @@ DSTATUS disk_close(void)
 #include <stdio.h>
 #include <string.h>
 #include "driver_udisk.h"
+#include "disk_cache.h"
 
 enum
 {
@@ -165,6 +166,9 @@ DSTATUS disk_initialize(uint8 pdrv)
     }
     else if (udisk_init() == USB_RET_OK)
     {
+#if CFG_FATFS_DISK_CACHE
+        disk_cache_init(udisk_get_size());
+#endif
         return RES_OK;
     }
 
@@ -193,7 +197,11 @@ DRESULT disk_read (
     }
     else
     {
+#if CFG_FATFS_DISK_CACHE
+        if (disk_cache_read(buff, sector, count) != RES_OK)
+#else
         if (udisk_rd_blk_sync(sector, count, buff) !=  USB_RET_OK)
+#endif
         {
         	os_printf("disk_read_error\r\n");
             ret =  RES_ERROR;
@@ -222,7 +230,11 @@ DRESULT disk_write (
     }
     else
     {
+#if CFG_FATFS_DISK_CACHE
+        res = disk_cache_write(buff, sector, count);
+#else
         res = udisk_wr_blk_sync((int)sector, (int)count, (uint8 *)buff);
+#endif
     }
 
     if (res == 0x00)return RES_OK;
@@ -251,7 +263,11 @@ DRESULT disk_ioctl (
             //   else res = RES_ERROR;
             //	Delay(10000);
             //		    	printf("CTRL_SYNC \r\n");
+#if CFG_FATFS_DISK_CACHE
+            res = disk_cache_sync();
+#else
             res = RES_OK;
+#endif
             break;
         case GET_SECTOR_SIZE:
             *(WORD *)buff = 512;
@@ -298,8 +314,13 @@ DRESULT disk_unmount(uint8 pdrv)
         //		SD_SPI_Uninit();
         return RES_ERROR;
     else
+    {
         //    	udisk_uninit();
+#if CFG_FATFS_DISK_CACHE
+        disk_cache_deinit();
+#endif
         return RES_OK;
+    }
 }
 
 #endif
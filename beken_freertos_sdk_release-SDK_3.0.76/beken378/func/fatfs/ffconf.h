@@ -81,8 +81,14 @@ typedef unsigned int   u_int32;                  /* 
 /* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
 
 
+#if CFG_FATFS_DISK_CACHE
+#define	_USE_FASTSEEK	1
+#else
 #define	_USE_FASTSEEK	0
-/* This option switches fast seek function. (0:Disable or 1:Enable) */
+#endif
+/* This option switches fast seek function. (0:Disable or 1:Enable)
+/  It comes with the usb disk cache, the ftp vfs keeps a cluster link map
+/  per read-only file with it. */
 
 
 #define	_USE_EXPAND		0
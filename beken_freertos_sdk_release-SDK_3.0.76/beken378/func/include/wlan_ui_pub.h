@@ -338,6 +338,16 @@ struct wlan_fast_connect_info
 #define IP_STATUS_VALID     "\x89\xAB\xCD\xEF"
 #endif
 
+#if CFG_WLAN_FAST_CONNECT_PROFILES
+/* fast connect keeps the last CFG_WLAN_FAST_CONNECT_PROFILES networks.
+ * wlan_write_fast_connect_info() stores the profile of fci->ssid and fci->pwd,
+ * wlan_read_fast_connect_info() returns the most recently used one */
+int wlan_fast_connect_profile_find(const char *ssid, const char *key, const uint8_t *bssid,
+	struct wlan_fast_connect_info *fci);
+void wlan_fast_connect_profile_stats(UINT32 *hit, UINT32 *miss);
+void wlan_fast_connect_profile_clear(void);
+#endif
+
 typedef struct vif_addcfg_st {
     char *ssid;
     char *key;
@@ -0,0 +1,728 @@
+#include "include.h"
+#include <string.h>
+#include <stddef.h>
+
+#include "error.h"
+#include "drv_model_pub.h"
+#include "flash_pub.h"
+#include "mem_pub.h"
+#include "uart_pub.h"
+
+#include "flash_namespace_value.h"
+#include "flash_kv_log.h"
+
+#if CFG_FLASH_KV_LOG
+/*************************************************************************
+                          Matter flash map (log)
+ |---sector hdr {seq, magic}---|---record---|---record---|...|---0xFF---|
+ |---sector hdr {seq, magic}---|---record---|...                        |
+ |---erased spare sector--------------------------------------------------|
+
+ record: {magic, key_len, flags, val_len, seq, crc32} + "namespace\0name" + value
+
+ - a write or a delete only appends a record to the head sector, the newest
+   record of a key (highest seq) is the valid one, a deleted key ends with a
+   record carrying KV_LOG_REC_DELETED
+ - one sector is always kept erased. When the head is full, the spare becomes
+   the head and the live records of the oldest sector are copied into it, then
+   the oldest sector is invalidated and erased, it's the new spare
+ - power loss: a torn record fails its crc and is skipped, records behind it
+   are found again by scanning word by word. No erased sector at mount means
+   a compaction was cut, its partial copy (the newest sector) is dropped
+*************************************************************************/
+extern uint32_t ef_calc_crc32(uint32_t crc, const void *buf, size_t size);
+
+#define KV_LOG_SECTOR_MAGIC          0x314C564B //"KVL1"
+#define KV_LOG_SECTOR_INVALID        0x00000000 //written before a compacted sector is erased
+#define KV_LOG_REC_MAGIC             0x4B56
+#define KV_LOG_REC_DELETED           0x01
+
+#define KV_LOG_ALIGN(len)            (((len) + 3) & ~3)
+#define KV_LOG_SEC_HDR_SIZE          sizeof(kv_log_sec_hdr_t)
+#define KV_LOG_SEC_MAGIC_OFFSET      offsetof(kv_log_sec_hdr_t, magic)
+#define KV_LOG_REC_HDR_SIZE          sizeof(kv_log_rec_hdr_t)
+#define KV_LOG_REC_CRC_OFFSET        offsetof(kv_log_rec_hdr_t, crc)
+#define KV_LOG_REC_SIZE(key_len, val_len) KV_LOG_ALIGN(KV_LOG_REC_HDR_SIZE + (key_len) + (val_len))
+#define KV_LOG_REC_SIZE_MAX          (KV_LOG_SECTOR_SIZE - KV_LOG_SEC_HDR_SIZE)
+
+typedef struct kv_log_sec_hdr
+{
+    uint32_t seq;                       //sector open order, the oldest sector is compacted first
+    uint32_t magic;                     //programmed last, a torn header never looks valid
+} kv_log_sec_hdr_t;
+
+typedef struct kv_log_rec_hdr
+{
+    uint16_t magic;
+    uint8_t  key_len;
+    uint8_t  flags;
+    uint16_t val_len;
+    uint16_t reserved;
+    uint32_t seq;                       //the newest record of a key wins
+    uint32_t crc;                       //crc32 of the fields above, the key and the value
+} kv_log_rec_hdr_t;
+
+typedef struct kv_log_node
+{
+    uint32_t key_hash;
+    uint32_t seq;
+    uint32_t addr;                      //record offset in the partition
+    uint16_t ns_hash;
+    uint16_t val_len;
+} kv_log_node_t;
+
+typedef struct kv_log_st
+{
+    uint32_t base;
+    uint32_t sec_num;
+    uint32_t sec_seq[KV_LOG_SECTOR_NUM_MAX]; //0: the sector is erased
+    uint32_t head;
+    uint32_t head_off;
+    uint32_t next_seq;
+    uint32_t next_sec_seq;
+    uint32_t key_num;
+    uint32_t gc_cnt;
+    uint32_t erase_cnt;
+    uint32_t mounted;
+    DD_HANDLE flash_hdl;
+    uint32_t protect_flag;
+    kv_log_node_t node[CFG_FLASH_KV_LOG_KEY_NUM];
+} kv_log_t;
+
+static kv_log_t kv_log;
+
+static void kv_log_flash_open(void)
+{
+    uint32_t status = 0, protect_param = FLASH_PROTECT_NONE;
+
+    kv_log.flash_hdl = ddev_open((char *)FLASH_DEV_NAME, (UINT32 *)&status, 0);
+    ddev_control(kv_log.flash_hdl, CMD_FLASH_GET_PROTECT, &kv_log.protect_flag);
+    ddev_control(kv_log.flash_hdl, CMD_FLASH_SET_PROTECT, &protect_param);
+}
+
+static void kv_log_flash_close(void)
+{
+    ddev_control(kv_log.flash_hdl, CMD_FLASH_SET_PROTECT, &kv_log.protect_flag);
+}
+
+static void kv_log_flash_read(uint32_t addr, void *buf, uint32_t len)
+{
+    ddev_read(kv_log.flash_hdl, (char *)buf, len, kv_log.base + addr);
+}
+
+static void kv_log_flash_write(uint32_t addr, const void *buf, uint32_t len)
+{
+    ddev_write(kv_log.flash_hdl, (char *)buf, len, kv_log.base + addr);
+}
+
+static void kv_log_erase_sector(uint32_t sec)
+{
+    uint32_t addr = kv_log.base + sec * KV_LOG_SECTOR_SIZE;
+
+    ddev_control(kv_log.flash_hdl, CMD_FLASH_ERASE_SECTOR, &addr);
+    kv_log.sec_seq[sec] = 0;
+    kv_log.erase_cnt++;
+}
+
+static uint32_t kv_log_make_key(const char *ucnamespace, const char *ucname, char *key)
+{
+    uint32_t ns_len = strlen(ucnamespace), name_len = strlen(ucname);
+
+    if ((0 == name_len) || (ns_len + 1 + name_len > KV_LOG_KEY_LEN_MAX))
+    {
+        bk_printf("[%s] [%d] key %s.%s is too long \r\n", __FUNCTION__, __LINE__, ucnamespace, ucname);
+        return 0;
+    }
+    memcpy(key, ucnamespace, ns_len + 1);
+    memcpy(key + ns_len + 1, ucname, name_len);
+
+    return ns_len + 1 + name_len;
+}
+
+static uint16_t kv_log_ns_hash(const char *ucnamespace)
+{
+    return (uint16_t)ef_calc_crc32(0, ucnamespace, strlen(ucnamespace));
+}
+
+static kv_log_node_t *kv_log_find(const char *key, uint32_t key_len, uint32_t key_hash)
+{
+    uint32_t buf[(KV_LOG_REC_HDR_SIZE + KV_LOG_KEY_LEN_MAX) / 4];
+    kv_log_rec_hdr_t *hdr = (kv_log_rec_hdr_t *)buf;
+    kv_log_node_t *node;
+    uint32_t i;
+
+    for (i = 0; i < kv_log.key_num; i++)
+    {
+        node = &kv_log.node[i];
+        if (node->key_hash != key_hash)
+        {
+            continue;
+        }
+        kv_log_flash_read(node->addr, buf, KV_LOG_REC_HDR_SIZE + key_len);
+        if ((hdr->key_len == key_len) && (0 == memcmp((char *)buf + KV_LOG_REC_HDR_SIZE, key, key_len)))
+        {
+            return node;
+        }
+    }
+
+    return NULL;
+}
+
+static void kv_log_remove(kv_log_node_t *node)
+{
+    *node = kv_log.node[--kv_log.key_num];
+}
+
+/* return the record size, 0 when there is no valid record at off */
+static uint32_t kv_log_rec_check(const uint8_t *sec_buf, uint32_t off)
+{
+    const kv_log_rec_hdr_t *hdr = (const kv_log_rec_hdr_t *)(sec_buf + off);
+    uint32_t size, crc;
+
+    if ((off + KV_LOG_REC_HDR_SIZE > KV_LOG_SECTOR_SIZE) || (hdr->magic != KV_LOG_REC_MAGIC)
+        || (0 == hdr->key_len) || (hdr->key_len > KV_LOG_KEY_LEN_MAX))
+    {
+        return 0;
+    }
+    size = KV_LOG_REC_SIZE(hdr->key_len, hdr->val_len);
+    if (off + size > KV_LOG_SECTOR_SIZE)
+    {
+        return 0;
+    }
+    crc = ef_calc_crc32(0, hdr, KV_LOG_REC_CRC_OFFSET);
+    crc = ef_calc_crc32(crc, sec_buf + off + KV_LOG_REC_HDR_SIZE, hdr->key_len + hdr->val_len);
+
+    return (crc == hdr->crc) ? size : 0;
+}
+
+/* offset behind the last programmed word of the sector */
+static uint32_t kv_log_data_end(const uint8_t *sec_buf)
+{
+    const uint32_t *word = (const uint32_t *)sec_buf;
+    uint32_t i = KV_LOG_SECTOR_SIZE / 4;
+
+    while ((i > 0) && (0xFFFFFFFF == word[i - 1]))
+    {
+        i--;
+    }
+
+    return i * 4;
+}
+
+static void kv_log_apply(const uint8_t *sec_buf, uint32_t off, uint32_t addr)
+{
+    const kv_log_rec_hdr_t *hdr = (const kv_log_rec_hdr_t *)(sec_buf + off);
+    const char *key = (const char *)(sec_buf + off + KV_LOG_REC_HDR_SIZE);
+    uint32_t key_hash = ef_calc_crc32(0, key, hdr->key_len);
+    kv_log_node_t *node = kv_log_find(key, hdr->key_len, key_hash);
+
+    if ((int32_t)(hdr->seq - kv_log.next_seq) >= 0)
+    {
+        kv_log.next_seq = hdr->seq + 1;
+    }
+    if (node && ((int32_t)(hdr->seq - node->seq) < 0))
+    {
+        return;
+    }
+    if (hdr->flags & KV_LOG_REC_DELETED)
+    {
+        if (node)
+        {
+            kv_log_remove(node);
+        }
+        return;
+    }
+    if (NULL == node)
+    {
+        if (kv_log.key_num >= CFG_FLASH_KV_LOG_KEY_NUM)
+        {
+            bk_printf("[%s] [%d] index is full, %s.%s is dropped \r\n", __FUNCTION__, __LINE__, key, key + strlen(key) + 1);
+            return;
+        }
+        node = &kv_log.node[kv_log.key_num++];
+        node->key_hash = key_hash;
+        node->ns_hash = kv_log_ns_hash(key);
+    }
+    node->seq = hdr->seq;
+    node->addr = addr;
+    node->val_len = hdr->val_len;
+}
+
+static void kv_log_open_sector(uint32_t sec)
+{
+    kv_log_sec_hdr_t sec_hdr;
+
+    sec_hdr.magic = KV_LOG_SECTOR_MAGIC;
+    sec_hdr.seq = kv_log.next_sec_seq++;
+    kv_log_flash_write(sec * KV_LOG_SECTOR_SIZE, &sec_hdr, KV_LOG_SEC_HDR_SIZE);
+
+    kv_log.sec_seq[sec] = sec_hdr.seq;
+    kv_log.head = sec;
+    kv_log.head_off = KV_LOG_SEC_HDR_SIZE;
+}
+
+/* copy one record to the head through a small buffer, the gc takes no heap */
+static void kv_log_copy_rec(uint32_t from, uint32_t size)
+{
+    uint32_t buf[16];
+    uint32_t to = kv_log.head * KV_LOG_SECTOR_SIZE + kv_log.head_off;
+    uint32_t off, len;
+
+    for (off = 0; off < size; off += len)
+    {
+        len = ((size - off) > sizeof(buf)) ? sizeof(buf) : (size - off);
+        kv_log_flash_read(from + off, buf, len);
+        kv_log_flash_write(to + off, buf, len);
+    }
+    kv_log.head_off += size;
+}
+
+/* copy the live records of the oldest sector to the head, then erase it */
+static void kv_log_gc(void)
+{
+    uint32_t i, sec = kv_log.sec_num, start, addr;
+    uint32_t invalid = KV_LOG_SECTOR_INVALID;
+    kv_log_rec_hdr_t hdr;
+    kv_log_node_t *node;
+
+    for (i = 0; i < kv_log.sec_num; i++)
+    {
+        if ((0 == kv_log.sec_seq[i]) || (i == kv_log.head))
+        {
+            continue;
+        }
+        if ((sec == kv_log.sec_num) || ((int32_t)(kv_log.sec_seq[i] - kv_log.sec_seq[sec]) < 0))
+        {
+            sec = i;
+        }
+    }
+    if (sec == kv_log.sec_num)
+    {
+        return;
+    }
+
+    /* the index points at every live record, the rest of the sector is stale */
+    start = sec * KV_LOG_SECTOR_SIZE;
+    for (i = 0; i < kv_log.key_num; i++)
+    {
+        node = &kv_log.node[i];
+        if ((node->addr < start) || (node->addr >= start + KV_LOG_SECTOR_SIZE))
+        {
+            continue;
+        }
+        kv_log_flash_read(node->addr, &hdr, KV_LOG_REC_HDR_SIZE);
+        addr = node->addr;
+        node->addr = kv_log.head * KV_LOG_SECTOR_SIZE + kv_log.head_off;
+        kv_log_copy_rec(addr, KV_LOG_REC_SIZE(hdr.key_len, hdr.val_len));
+    }
+
+    kv_log_flash_write(start + KV_LOG_SEC_MAGIC_OFFSET, &invalid, sizeof(invalid));
+    kv_log_erase_sector(sec);
+    kv_log.gc_cnt++;
+}
+
+/* make room for a record of size bytes in the head sector */
+static uint32_t kv_log_reserve(uint32_t size)
+{
+    uint32_t loop, i, sec, next, free_num;
+
+    for (loop = 0; loop <= kv_log.sec_num; loop++)
+    {
+        if (kv_log.head_off + size <= KV_LOG_SECTOR_SIZE)
+        {
+            return kNoErr;
+        }
+
+        next = kv_log.sec_num;
+        free_num = 0;
+        for (i = 1; i <= kv_log.sec_num; i++)
+        {
+            sec = (kv_log.head + i) % kv_log.sec_num;
+            if (0 == kv_log.sec_seq[sec])
+            {
+                if (next == kv_log.sec_num)
+                {
+                    next = sec;
+                }
+                free_num++;
+            }
+        }
+        if (next == kv_log.sec_num)
+        {
+            return kGeneralErr;
+        }
+
+        kv_log_open_sector(next);
+        /* the spare is taken, compact the oldest sector into it */
+        if (1 == free_num)
+        {
+            kv_log_gc();
+        }
+    }
+    bk_printf("[%s] [%d] kv log is full \r\n", __FUNCTION__, __LINE__);
+
+    return kGeneralErr;
+}
+
+static uint32_t kv_log_mount(void)
+{
+    bk_logic_partition_t *partition_info = NULL;
+    kv_log_sec_hdr_t sec_hdr;
+    uint8_t order[KV_LOG_SECTOR_NUM_MAX];
+    uint32_t i, j, used = 0, off, size, data_end, rec_end, sec;
+    uint32_t invalid = KV_LOG_SECTOR_INVALID;
+    uint8_t *sec_buf;
+
+    partition_info = bk_flash_get_info(BK_PARTITION_MATTER_FLASH);
+    BK_CHECK_POINTER_NULL(partition_info);
+
+    kv_log.base = partition_info->partition_start_addr;
+    kv_log.sec_num = partition_info->partition_length / KV_LOG_SECTOR_SIZE;
+    if (kv_log.sec_num > KV_LOG_SECTOR_NUM_MAX)
+    {
+        kv_log.sec_num = KV_LOG_SECTOR_NUM_MAX;
+    }
+    if (kv_log.sec_num < 2)
+    {
+        bk_printf("[%s] [%d] kv log needs 2 sectors at least \r\n", __FUNCTION__, __LINE__);
+        return kGeneralErr;
+    }
+
+    sec_buf = (uint8_t *)os_malloc(KV_LOG_SECTOR_SIZE);
+    if (NULL == sec_buf)
+    {
+        bk_printf("[%s] [%d] malloc failed \r\n", __FUNCTION__, __LINE__);
+        return kGeneralErr;
+    }
+
+    kv_log.key_num = 0;
+    kv_log.next_seq = 1;
+    kv_log.next_sec_seq = 1;
+    for (i = 0; i < kv_log.sec_num; i++)
+    {
+        kv_log_flash_read(i * KV_LOG_SECTOR_SIZE, &sec_hdr, KV_LOG_SEC_HDR_SIZE);
+        if ((KV_LOG_SECTOR_MAGIC == sec_hdr.magic) && (0 != sec_hdr.seq) && (0xFFFFFFFF != sec_hdr.seq))
+        {
+            /* keep the sectors sorted from the oldest to the newest */
+            for (j = used; (j > 0) && ((int32_t)(kv_log.sec_seq[order[j - 1]] - sec_hdr.seq) > 0); j--)
+            {
+                order[j] = order[j - 1];
+            }
+            order[j] = i;
+            used++;
+            kv_log.sec_seq[i] = sec_hdr.seq;
+            if ((int32_t)(sec_hdr.seq - kv_log.next_sec_seq) >= 0)
+            {
+                kv_log.next_sec_seq = sec_hdr.seq + 1;
+            }
+            continue;
+        }
+
+        /* unknown data, torn header or an invalidated sector */
+        kv_log.sec_seq[i] = 0;
+        kv_log_flash_read(i * KV_LOG_SECTOR_SIZE, sec_buf, KV_LOG_SECTOR_SIZE);
+        if (kv_log_data_end(sec_buf))
+        {
+            bk_printf("[%s] [%d] erase sector %d \r\n", __FUNCTION__, __LINE__, i);
+            kv_log_erase_sector(i);
+        }
+    }
+
+    /* no spare sector: the newest one holds a cut compaction, the source is still intact */
+    if (used == kv_log.sec_num)
+    {
+        used--;
+        kv_log_flash_write(order[used] * KV_LOG_SECTOR_SIZE + KV_LOG_SEC_MAGIC_OFFSET, &invalid, sizeof(invalid));
+        kv_log_erase_sector(order[used]);
+    }
+
+    for (j = 0; j < used; j++)
+    {
+        sec = order[j];
+        kv_log_flash_read(sec * KV_LOG_SECTOR_SIZE, sec_buf, KV_LOG_SECTOR_SIZE);
+        data_end = kv_log_data_end(sec_buf);
+        rec_end = KV_LOG_SEC_HDR_SIZE;
+        for (off = KV_LOG_SEC_HDR_SIZE; off < data_end; off += size)
+        {
+            size = kv_log_rec_check(sec_buf, off);
+            if (0 == size)
+            {
+                /* torn record, look for the next one */
+                size = 4;
+                continue;
+            }
+            kv_log_apply(sec_buf, off, sec * KV_LOG_SECTOR_SIZE + off);
+            rec_end = off + size;
+        }
+        /* a value may end with 0xFF words, never append inside it */
+        kv_log.head = sec;
+        kv_log.head_off = (rec_end > data_end) ? rec_end : data_end;
+    }
+    os_free(sec_buf);
+
+    if (0 == used)
+    {
+        kv_log_open_sector(0);
+    }
+    kv_log.mounted = 1;
+
+    return kNoErr;
+}
+
+static uint32_t kv_log_begin(void)
+{
+    kv_log_flash_open();
+    if (!kv_log.mounted && (kNoErr != kv_log_mount()))
+    {
+        kv_log_flash_close();
+        return kGeneralErr;
+    }
+
+    return kNoErr;
+}
+
+static uint32_t kv_log_append(const char *key, uint32_t key_len, uint8_t flags, const char *data, uint32_t data_size,
+                                    uint32_t *addr)
+{
+    kv_log_rec_hdr_t hdr;
+    uint32_t size = KV_LOG_REC_SIZE(key_len, data_size);
+
+    if (size > KV_LOG_REC_SIZE_MAX)
+    {
+        bk_printf("[%s] [%d] data is too large:%d \r\n", __FUNCTION__, __LINE__, data_size);
+        return kGeneralErr;
+    }
+    if (kNoErr != kv_log_reserve(size))
+    {
+        return kGeneralErr;
+    }
+
+    hdr.magic = KV_LOG_REC_MAGIC;
+    hdr.key_len = key_len;
+    hdr.flags = flags;
+    hdr.val_len = data_size;
+    hdr.reserved = 0xFFFF;
+    hdr.seq = kv_log.next_seq++;
+    hdr.crc = ef_calc_crc32(0, &hdr, KV_LOG_REC_CRC_OFFSET);
+    hdr.crc = ef_calc_crc32(hdr.crc, key, key_len);
+    hdr.crc = ef_calc_crc32(hdr.crc, data, data_size);
+
+    /* header first, a cut write is caught by the crc */
+    *addr = kv_log.head * KV_LOG_SECTOR_SIZE + kv_log.head_off;
+    kv_log_flash_write(*addr, &hdr, KV_LOG_REC_HDR_SIZE);
+    kv_log_flash_write(*addr + KV_LOG_REC_HDR_SIZE, key, key_len);
+    if (data_size)
+    {
+        kv_log_flash_write(*addr + KV_LOG_REC_HDR_SIZE + key_len, data, data_size);
+    }
+    kv_log.head_off += size;
+
+    return kNoErr;
+}
+
+static uint32_t kv_log_value_equal(kv_log_node_t *node, uint32_t key_len, const char *data, uint32_t data_size)
+{
+    uint8_t buf[64];
+    uint32_t off, len;
+
+    if (node->val_len != data_size)
+    {
+        return 0;
+    }
+    for (off = 0; off < data_size; off += len)
+    {
+        len = ((data_size - off) > sizeof(buf)) ? sizeof(buf) : (data_size - off);
+        kv_log_flash_read(node->addr + KV_LOG_REC_HDR_SIZE + key_len + off, buf, len);
+        if (0 != memcmp(buf, data + off, len))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+uint32_t kv_log_write(const char *ucnamespace, const char *ucname, const char *indata, uint32_t data_size)
+{
+    char key[KV_LOG_KEY_LEN_MAX];
+    uint32_t key_len, key_hash, addr, seq;
+    uint32_t dw_rtn = kNoErr;
+    kv_log_node_t *node;
+
+    key_len = kv_log_make_key(ucnamespace, ucname, key);
+    if ((0 == key_len) || (kNoErr != kv_log_begin()))
+    {
+        return kGeneralErr;
+    }
+
+    key_hash = ef_calc_crc32(0, key, key_len);
+    node = kv_log_find(key, key_len, key_hash);
+    if (node && kv_log_value_equal(node, key_len, indata, data_size))
+    {
+        /* same data, nothing to write */
+    }
+    else if ((NULL == node) && (kv_log.key_num >= CFG_FLASH_KV_LOG_KEY_NUM))
+    {
+        bk_printf("[%s] [%d] index is full \r\n", __FUNCTION__, __LINE__);
+        dw_rtn = kGeneralErr;
+    }
+    else
+    {
+        seq = kv_log.next_seq;
+        dw_rtn = kv_log_append(key, key_len, 0, indata, data_size, &addr);
+        if (kNoErr == dw_rtn)
+        {
+            if (NULL == node)
+            {
+                node = &kv_log.node[kv_log.key_num++];
+                node->key_hash = key_hash;
+                node->ns_hash = kv_log_ns_hash(ucnamespace);
+            }
+            node->seq = seq;
+            node->addr = addr;
+            node->val_len = data_size;
+        }
+    }
+    kv_log_flash_close();
+
+    return dw_rtn;
+}
+
+uint32_t kv_log_read(const char *ucnamespace, const char *ucname, char *out_data, uint32_t dw_read_len, uint32_t *out_length)
+{
+    char key[KV_LOG_KEY_LEN_MAX];
+    uint32_t key_len;
+    uint32_t dw_rtn = kGeneralErr;
+    kv_log_node_t *node;
+
+    key_len = kv_log_make_key(ucnamespace, ucname, key);
+    if ((0 == key_len) || (kNoErr != kv_log_begin()))
+    {
+        return kGeneralErr;
+    }
+
+    node = kv_log_find(key, key_len, ef_calc_crc32(0, key, key_len));
+    if (node)
+    {
+        *out_length = (dw_read_len > node->val_len) ? node->val_len : dw_read_len;
+        kv_log_flash_read(node->addr + KV_LOG_REC_HDR_SIZE + key_len, out_data, *out_length);
+        dw_rtn = kNoErr;
+    }
+    kv_log_flash_close();
+
+    return dw_rtn;
+}
+
+uint32_t kv_log_exist(const char *ucnamespace, const char *ucname)
+{
+    char key[KV_LOG_KEY_LEN_MAX];
+    uint32_t key_len;
+    uint32_t dw_rtn = kGeneralErr;
+
+    key_len = kv_log_make_key(ucnamespace, ucname, key);
+    if ((0 == key_len) || (kNoErr != kv_log_begin()))
+    {
+        return kGeneralErr;
+    }
+    if (kv_log_find(key, key_len, ef_calc_crc32(0, key, key_len)))
+    {
+        dw_rtn = kNoErr;
+    }
+    kv_log_flash_close();
+
+    return dw_rtn;
+}
+
+uint32_t kv_log_delete(const char *ucnamespace, const char *ucname)
+{
+    char key[KV_LOG_KEY_LEN_MAX];
+    uint32_t key_len, addr;
+    uint32_t dw_rtn = kGeneralErr;
+    kv_log_node_t *node;
+
+    key_len = kv_log_make_key(ucnamespace, ucname, key);
+    if ((0 == key_len) || (kNoErr != kv_log_begin()))
+    {
+        return kGeneralErr;
+    }
+
+    node = kv_log_find(key, key_len, ef_calc_crc32(0, key, key_len));
+    if (NULL == node)
+    {
+        bk_printf("[%s] [%d] No Such Name \r\n", __FUNCTION__, __LINE__);
+    }
+    else if (kNoErr == (dw_rtn = kv_log_append(key, key_len, KV_LOG_REC_DELETED, NULL, 0, &addr)))
+    {
+        kv_log_remove(node);
+    }
+    kv_log_flash_close();
+
+    return dw_rtn;
+}
+
+uint32_t kv_log_clear_namespace(const char *ucnamespace)
+{
+    uint32_t buf[(KV_LOG_REC_HDR_SIZE + KV_LOG_KEY_LEN_MAX) / 4];
+    kv_log_rec_hdr_t *hdr = (kv_log_rec_hdr_t *)buf;
+    char *key = (char *)buf + KV_LOG_REC_HDR_SIZE;
+    uint32_t ns_len = strlen(ucnamespace), i = 0, addr;
+    uint16_t ns_hash = kv_log_ns_hash(ucnamespace);
+    uint32_t dw_rtn = kNoErr;
+    kv_log_node_t *node;
+
+    if ((ns_len >= KV_LOG_KEY_LEN_MAX) || (kNoErr != kv_log_begin()))
+    {
+        return kGeneralErr;
+    }
+
+    while (i < kv_log.key_num)
+    {
+        node = &kv_log.node[i];
+        if (node->ns_hash == ns_hash)
+        {
+            kv_log_flash_read(node->addr, buf, KV_LOG_REC_HDR_SIZE + ns_len + 1);
+            if ((hdr->key_len > ns_len + 1) && (0 == memcmp(key, ucnamespace, ns_len + 1)))
+            {
+                kv_log_flash_read(node->addr, buf, KV_LOG_REC_HDR_SIZE + hdr->key_len);
+                dw_rtn = kv_log_append(key, hdr->key_len, KV_LOG_REC_DELETED, NULL, 0, &addr);
+                if (kNoErr != dw_rtn)
+                {
+                    break;
+                }
+                kv_log_remove(node);
+                continue;
+            }
+        }
+        i++;
+    }
+    kv_log_flash_close();
+
+    return dw_rtn;
+}
+
+/* the partition was erased behind the log, mount it again on the next access */
+void kv_log_reset(void)
+{
+    os_memset(&kv_log, 0, sizeof(kv_log));
+}
+
+void kv_log_dump(void)
+{
+    uint32_t i;
+
+    if (kNoErr != kv_log_begin())
+    {
+        return;
+    }
+    os_printf("kv log: %d sectors, head %d, %d bytes free in head\r\n", kv_log.sec_num, kv_log.head,
+              KV_LOG_SECTOR_SIZE - kv_log.head_off);
+    os_printf("keys %d/%d, next seq %u, gc %u, erase %u\r\n", kv_log.key_num, CFG_FLASH_KV_LOG_KEY_NUM,
+              kv_log.next_seq, kv_log.gc_cnt, kv_log.erase_cnt);
+    for (i = 0; i < kv_log.sec_num; i++)
+    {
+        os_printf("sector %d: seq %u%s\r\n", i, kv_log.sec_seq[i], (i == kv_log.head) ? " (head)" : "");
+    }
+    kv_log_flash_close();
+}
+#endif // CFG_FLASH_KV_LOG
+// eof
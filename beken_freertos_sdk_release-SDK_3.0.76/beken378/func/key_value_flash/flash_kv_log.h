@@ -0,0 +1,38 @@
+#ifndef __FLASH_KV_LOG_H__
+#define __FLASH_KV_LOG_H__
+
+#ifdef __cplusplus
+extern"C" {
+#endif
+
+#include "include.h"
+
+#if CFG_FLASH_KV_LOG
+/*
+ * Append-only backend of bk_read_data/bk_write_data for BK_PARTITION_MATTER_FLASH.
+ * Each update appends one record (namespace, name, value, sequence number, crc32)
+ * to the head sector, a RAM index maps the key to its newest record, and the
+ * oldest sector is compacted into a spare one when the head fills up.
+ */
+#ifndef CFG_FLASH_KV_LOG_KEY_NUM
+#define CFG_FLASH_KV_LOG_KEY_NUM          128 //keys held by the RAM index
+#endif
+
+#define KV_LOG_SECTOR_SIZE                0x1000
+#define KV_LOG_SECTOR_NUM_MAX             32
+#define KV_LOG_KEY_LEN_MAX                128 //namespace + '\0' + name
+
+uint32_t kv_log_write(const char *ucnamespace, const char *ucname, const char *indata, uint32_t data_size);
+uint32_t kv_log_read(const char *ucnamespace, const char *ucname, char *out_data, uint32_t dw_read_len, uint32_t *out_length);
+uint32_t kv_log_delete(const char *ucnamespace, const char *ucname);
+uint32_t kv_log_clear_namespace(const char *ucnamespace);
+uint32_t kv_log_exist(const char *ucnamespace, const char *ucname);
+void kv_log_reset(void);
+void kv_log_dump(void);
+#endif // CFG_FLASH_KV_LOG
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
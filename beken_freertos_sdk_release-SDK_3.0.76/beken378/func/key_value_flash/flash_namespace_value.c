@@ -9,6 +9,7 @@
 #include "wpa_supplicant_i.h"
 
 #include "flash_namespace_value.h"
+#include "flash_kv_log.h"
 
 
 #if 1
@@ -656,6 +657,16 @@ uint32_t bk_set_name_data( const char * ucnamespace,const char * ucname,uint32_t
  * 
  * Date:2021-12-22
  *******************************************************************/
+#if CFG_FLASH_KV_LOG
+uint32_t bk_clean_data ( const char * ucnamespace,const char * ucname)
+{
+    BK_CHECK_POINTER_NULL(ucnamespace);
+    BK_RETURN_NS_IS_FACTORY(ucnamespace);
+    BK_CHECK_POINTER_NULL(ucname);
+
+    return kv_log_delete(ucnamespace, ucname);
+}
+#else
 uint32_t bk_clean_data ( const char * ucnamespace,const char * ucname)
 {
     DD_HANDLE flash_hdl = 0;
@@ -713,6 +724,7 @@ uint32_t bk_clean_data ( const char * ucnamespace,const char * ucname)
 
     return dw_rtn;
 }
+#endif
 
 /*********************************************************************
  * Funtion Name:bK_clear_namespace
@@ -723,6 +735,16 @@ uint32_t bk_clean_data ( const char * ucnamespace,const char * ucname)
  * 
  * Date:2021-12-22
  *******************************************************************/
+#if CFG_FLASH_KV_LOG
+uint32_t bK_clear_namespace ( const char * ucnamespace)
+{
+    BK_CHECK_POINTER_NULL(ucnamespace);
+    BK_RETURN_NS_IS_FACTORY(ucnamespace);
+    BK_RETURN_NS_IS_CONFIG_COUNTER(ucnamespace);
+
+    return kv_log_clear_namespace(ucnamespace);
+}
+#else
 uint32_t bK_clear_namespace ( const char * ucnamespace) //base_addr 要用上
 {
     uint32_t dw_rtn = kNoErr ;
@@ -785,6 +807,7 @@ uint32_t bK_clear_namespace ( const char * ucnamespace) //base_addr 要用上
 
     return dw_rtn;
 }
+#endif
 
 /*********************************************************************
  * Funtion Name:bk_read_data
@@ -796,7 +819,12 @@ uint32_t bK_clear_namespace ( const char * ucnamespace) //base_addr 要用上
  * 
  * Date:2021-12-22
  *******************************************************************/
+#if CFG_FLASH_KV_LOG
+/* chip-factory stays on the legacy layout */
+static uint32_t bk_read_data_legacy( const char * ucnamespace,const char * ucname,char * out_data,uint32_t dw_read_len,uint32_t *out_length)
+#else
 uint32_t bk_read_data( const char * ucnamespace,const char * ucname,char * out_data,uint32_t dw_read_len,uint32_t *out_length)
+#endif
 {
     uint32_t dw_rtn = kNoErr;
     DD_HANDLE flash_hdl = 0;
@@ -854,6 +882,23 @@ uint32_t bk_read_data( const char * ucnamespace,const char * ucname,char * out_d
     return dw_rtn;
 }
 
+#if CFG_FLASH_KV_LOG
+uint32_t bk_read_data( const char * ucnamespace,const char * ucname,char * out_data,uint32_t dw_read_len,uint32_t *out_length)
+{
+    BK_CHECK_POINTER_NULL(ucnamespace);
+    BK_CHECK_POINTER_NULL(ucname);
+    BK_CHECK_POINTER_NULL(out_data);
+    BK_CHECK_POINTER_NULL(out_length);
+
+    if (0 == strcmp(ucnamespace, "chip-factory"))
+    {
+        return bk_read_data_legacy(ucnamespace, ucname, out_data, dw_read_len, out_length);
+    }
+
+    return kv_log_read(ucnamespace, ucname, out_data, dw_read_len, out_length);
+}
+#endif
+
 /*********************************************************************
  * Funtion Name:bk_write_data
  *
@@ -864,6 +909,17 @@ uint32_t bk_read_data( const char * ucnamespace,const char * ucname,char * out_d
  * 
  * Date:2021-12-22
  *******************************************************************/
+#if CFG_FLASH_KV_LOG
+uint32_t bk_write_data( const char * ucnamespace,const char * ucname, char * indata,uint32_t data_size)
+{
+    BK_CHECK_POINTER_NULL(ucnamespace);
+    BK_RETURN_NS_IS_FACTORY(ucnamespace);
+    BK_CHECK_POINTER_NULL(ucname);
+    BK_CHECK_POINTER_NULL(indata);
+
+    return kv_log_write(ucnamespace, ucname, indata, data_size);
+}
+#else
 uint32_t bk_write_data( const char * ucnamespace,const char * ucname, char * indata,uint32_t data_size)
 {
     uint32_t dw_rtn = kNoErr;
@@ -894,6 +950,7 @@ uint32_t bk_write_data( const char * ucnamespace,const char * ucname, char * ind
 
     return dw_rtn;
 }
+#endif
 
 /*********************************************************************
  * Funtion Name:bk_ensure_namespace
@@ -904,7 +961,11 @@ uint32_t bk_write_data( const char * ucnamespace,const char * ucname, char * ind
  * 
  * Date:2021-12-22
  *******************************************************************/
+#if CFG_FLASH_KV_LOG
+static uint32_t bk_ensure_namespace_legacy( const char * ucnamespace)
+#else
 uint32_t bk_ensure_namespace( const char * ucnamespace)
+#endif
 {
     uint32_t dw_rtn = kGeneralErr;
     uint32_t dw_offset_addr = 0,dw_off_block = 0;
@@ -934,6 +995,20 @@ uint32_t bk_ensure_namespace( const char * ucnamespace)
 
     return dw_rtn;
 }
+
+#if CFG_FLASH_KV_LOG
+uint32_t bk_ensure_namespace( const char * ucnamespace)
+{
+    BK_CHECK_POINTER_NULL(ucnamespace);
+
+    if (0 == strcmp(ucnamespace, "chip-factory"))
+    {
+        return bk_ensure_namespace_legacy(ucnamespace);
+    }
+
+    return kNoErr;//namespaces are part of the keys in the log
+}
+#endif
 /*********************************************************************
  * Funtion Name:bk_ensure_name_data
  *
@@ -944,7 +1019,11 @@ uint32_t bk_ensure_namespace( const char * ucnamespace)
  * 
  * Date:2021-12-22
  *******************************************************************/
+#if CFG_FLASH_KV_LOG
+static uint32_t bk_ensure_name_data_legacy( const char * ucnamespace,const char * ucname)
+#else
 uint32_t bk_ensure_name_data( const char * ucnamespace,const char * ucname)
+#endif
 {
     uint32_t dw_rtn = kGeneralErr;
     uint32_t dw_offset_addr = 0,dw_off_block = 0;
@@ -978,6 +1057,21 @@ uint32_t bk_ensure_name_data( const char * ucnamespace,const char * ucname)
     return dw_rtn;
 }
 
+#if CFG_FLASH_KV_LOG
+uint32_t bk_ensure_name_data( const char * ucnamespace,const char * ucname)
+{
+    BK_CHECK_POINTER_NULL(ucnamespace);
+
+    if (0 == strcmp(ucnamespace, "chip-factory"))
+    {
+        return bk_ensure_name_data_legacy(ucnamespace, ucname);
+    }
+    BK_CHECK_POINTER_NULL(ucname);
+
+    return kv_log_exist(ucnamespace, ucname);
+}
+#endif
+
 /*********************************************************************
  * Funtion Name:bk_erase_all
  *
@@ -1027,6 +1121,12 @@ uint32_t bk_erase_all( bk_partition_t type )
     }
 #endif
     ddev_control(flash_hdl, CMD_FLASH_SET_PROTECT, &protect_flag);
+#if CFG_FLASH_KV_LOG
+    if (BK_PARTITION_MATTER_FLASH == type)
+    {
+        kv_log_reset();
+    }
+#endif
 
     return kNoErr;
 }
@@ -178,7 +178,12 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 	}
 
 	ret = bmsg_tx_sender(p, (uint32_t)vif_idx);
-	if(0 != ret)
+	if(kNoMemoryErr == ret)
+	{
+		/* tx node pool is dry, let lwip queue and retry the segment */
+		err = ERR_MEM;
+	}
+	else if(0 != ret)
 	{
 		err = ERR_TIMEOUT;
 	}
@@ -387,9 +392,12 @@ err_t lwip_netif_uap_init(struct netif *netif)
 
 #if CFG_LWIP_HW_CSUM
 extern uint16_t ipchksum_get_result(uint32_t addr, uint16_t len);
+u16_t lwip_standard_chksum(const void *dataptr, int len);
 
 /*
  * hw ip checksum verison of lwip_standard_chksum.
+ * lwip calls it once per pbuf of a chain and folds the partial sums itself,
+ * the engine takes any start address so only the length picks the path.
  * TODO: use mutex instead of disable interrupt.
  */
 uint16_t hw_ipcksum_standard_chksum(const void *dataptr, int len)
@@ -397,12 +405,65 @@ uint16_t hw_ipcksum_standard_chksum(const void *dataptr, int len)
     GLOBAL_INT_DECLARATION();
     u16_t csum;
 
+    if ((len < CFG_LWIP_HW_CSUM_THRESHOLD) || (len > 0xFFFF))
+        return lwip_standard_chksum(dataptr, len);
+
     GLOBAL_INT_DISABLE();
     csum = ipchksum_get_result((uint32_t)dataptr, (uint16_t)len);
     GLOBAL_INT_RESTORE();
 
     return csum;
 }
+
+/*
+ * compare engine and software checksum cost per KB for a few lengths,
+ * aligned and odd start, to tune CFG_LWIP_HW_CSUM_THRESHOLD.
+ * @mhz: cpu clock used to turn time into cycles
+ */
+void hw_ipcksum_bench(int mhz)
+{
+    static const int lens[] = {32, 64, 128, 256, 512, 1024, 1460};
+    const int loops = 1000;
+    GLOBAL_INT_DECLARATION();
+    uint64_t t0, hw_us, sw_us;
+    u16_t hw_csum, sw_csum;
+    uint8_t *buf;
+    int i, j, off;
+
+    buf = os_malloc(1460 + 1);
+    if (!buf)
+        return;
+    for (i = 0; i < 1460 + 1; i++)
+        buf[i] = i & 0xFF;
+
+    os_printf("len  off  hw cyc/KB  sw cyc/KB  @%dMHz\r\n", mhz);
+    for (off = 0; off < 2; off++) {
+        for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+            hw_csum = 0;
+            sw_csum = 0;
+
+            t0 = rtos_get_time_us();
+            for (j = 0; j < loops; j++) {
+                GLOBAL_INT_DISABLE();
+                hw_csum = ipchksum_get_result((uint32_t)&buf[off], lens[i]);
+                GLOBAL_INT_RESTORE();
+            }
+            hw_us = rtos_get_time_us() - t0;
+
+            t0 = rtos_get_time_us();
+            for (j = 0; j < loops; j++)
+                sw_csum = lwip_standard_chksum(&buf[off], lens[i]);
+            sw_us = rtos_get_time_us() - t0;
+
+            os_printf("%4d %4d %10d %10d%s\r\n", lens[i], off,
+                      (int)(hw_us * mhz * 1024 / ((uint64_t)loops * lens[i])),
+                      (int)(sw_us * mhz * 1024 / ((uint64_t)loops * lens[i])),
+                      (hw_csum != sw_csum) ? "  mismatch" : "");
+        }
+    }
+
+    os_free(buf);
+}
 #endif
 
 // eof
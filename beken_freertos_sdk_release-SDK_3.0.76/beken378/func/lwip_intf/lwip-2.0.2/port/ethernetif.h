@@ -8,6 +8,9 @@
 
 void ethernetif_recv(struct netif *netif, int total_len);
 err_t ethernetif_init(struct netif *netif);
+#if CFG_LWIP_HW_CSUM
+void hw_ipcksum_bench(int mhz);
+#endif
 
 
 #endif 
@@ -511,7 +511,27 @@ The STM32F107 allows computing and verifying the IP, UDP, TCP and ICMP checksums
 /* Beken specific LWIP options */
 #define BK_DHCP                         1
 
+#if CFG_WIFI_TX_ZERO_COPY
+/* room for the msdu node and 802.11 encapsulation in front of every outgoing
+ * frame, and for MIC/ICV behind it, so the wifi core transmits it in place */
+#define PBUF_LINK_ENCAPSULATION_HLEN    (CFG_MSDU_RESV_NODE_LEN + CFG_MSDU_RESV_HEAD_LEN)
+#define PBUF_LINK_ENCAPSULATION_TLEN    CFG_MSDU_RESV_TAIL_LEN
+#endif
+
+#if CFG_WIFI_RX_AMSDU_ZERO_COPY
+/* a-msdu subframes are pbuf_custom pointing into the parent mpdu */
+#define LWIP_SUPPORT_CUSTOM_PBUF        1
+#endif
+
+/* software checksum sums 8 bytes per loop, odd start address allowed */
+#define LWIP_CHKSUM_ALGORITHM           3
+
 #if CFG_LWIP_HW_CSUM
+/* buffers of at least this many bytes go to the checksum engine, shorter ones
+ * are cheaper in software than programming the engine */
+#ifndef CFG_LWIP_HW_CSUM_THRESHOLD
+#define CFG_LWIP_HW_CSUM_THRESHOLD      128
+#endif
 uint16_t hw_ipcksum_standard_chksum(const void *dataptr, int len);
 #define LWIP_CHKSUM hw_ipcksum_standard_chksum
 #endif
@@ -351,7 +351,8 @@ pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type)
     break;
   case PBUF_RAM:
     {
-      mem_size_t alloc_len = LWIP_MEM_ALIGN_SIZE(SIZEOF_STRUCT_PBUF + offset) + LWIP_MEM_ALIGN_SIZE(length);
+      mem_size_t alloc_len = LWIP_MEM_ALIGN_SIZE(SIZEOF_STRUCT_PBUF + offset) + LWIP_MEM_ALIGN_SIZE(length)
+                             + PBUF_LINK_ENCAPSULATION_TLEN;
       
       /* bug #50040: Check for integer overflow when calculating alloc_len */
       if (alloc_len < LWIP_MEM_ALIGN_SIZE(length)) {
@@ -1364,6 +1364,15 @@
 #define PBUF_LINK_ENCAPSULATION_HLEN    0u
 #endif
 
+/**
+ * PBUF_LINK_ENCAPSULATION_TLEN: the number of bytes that should be allocated
+ * behind the payload of PBUF_RAM pbufs, e.g. for a MIC/ICV appended by the
+ * link layer in place.
+ */
+#if !defined PBUF_LINK_ENCAPSULATION_TLEN || defined __DOXYGEN__
+#define PBUF_LINK_ENCAPSULATION_TLEN    0u
+#endif
+
 /**
  * PBUF_POOL_BUFSIZE: the size of each pbuf in the pbuf pool. The default is
  * designed to accommodate single full size TCP frame in one pbuf, including
@@ -649,6 +649,25 @@ int mbedtls_ecp_gen_key( mbedtls_ecp_group_id grp_id, mbedtls_ecp_keypair *key,
  */
 int mbedtls_ecp_check_pub_priv( const mbedtls_ecp_keypair *pub, const mbedtls_ecp_keypair *prv );
 
+#if defined(MBEDTLS_ECP_ROM_TABLES)
+/* 1 by default, 0 makes mbedtls_ecp_comb_rom() return NULL */
+extern int mbedtls_ecp_comb_rom_enabled;
+
+/**
+ * \brief           Comb table kept in flash for R = m * P, see ecp_comb_alt.c
+ *
+ * \param grp       ECP group used
+ * \param P         Point to multiply
+ * \param w         Set to the width of the table
+ *
+ * \return          the table when P is the generator of a curve that has
+ *                  one, or NULL
+ */
+const mbedtls_ecp_point *mbedtls_ecp_comb_rom( const mbedtls_ecp_group *grp,
+                                               const mbedtls_ecp_point *P,
+                                               unsigned char *w );
+#endif /* MBEDTLS_ECP_ROM_TABLES */
+
 #if defined(MBEDTLS_SELF_TEST)
 
 /**
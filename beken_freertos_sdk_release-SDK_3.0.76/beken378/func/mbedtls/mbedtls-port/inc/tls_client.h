@@ -50,6 +50,12 @@ typedef struct MbedTLSSession
 #if USE_CA_CERTIFICATE_EN
     mbedtls_x509_crt cacert;
 #endif
+#if CFG_TLS_SESSION_RESUME
+    int resume_offered;
+    int resumed;                        /* last handshake was abbreviated */
+    unsigned int resume_uses;
+    unsigned char resume_check[8];      /* digest of the offered master secret */
+#endif
 }MbedTLSSession;
  
  extern int mbedtls_client_init(MbedTLSSession *session, void *entropy, size_t entropyLen);
@@ -85,6 +85,16 @@ extern void tls_mbedtls_mem_free(void *ptr);
 // If wpa3 feature is enabled and use cryto_mbedtls, use ecp and ecp_curves alternative
 // to choose the right ecc curves (especially the A parameter of curve.).
 #define MBEDTLS_ECP_ALT
+// m * G for p-256 and p-384 runs on comb tables kept in flash, see
+// ecp_comb_alt.c, instead of building a w = 2 table on every call.
+#define MBEDTLS_ECP_ROM_TABLES
+#endif
+#if (CFG_SOC_NAME == SOC_BK7221U) && CFG_MBEDTLS_AES_HW
+// aes blocks run on the security engine, see aes_alt.c. gcm and ccm
+// go through the cipher layer's ecb, so they get the engine as well.
+#define MBEDTLS_AES_ALT
+#define MBEDTLS_GCM_C
+#define MBEDTLS_CCM_C
 #endif
 #if 0
 #define MBEDTLS_SSL_CIPHERSUITES                        \
@@ -158,7 +168,9 @@ extern void tls_mbedtls_mem_free(void *ptr);
 // #define MBEDTLS_SSL_DTLS_HELLO_VERIFY
 // #define MBEDTLS_SSL_DTLS_CLIENT_PORT_REUSE
 // #define MBEDTLS_SSL_DTLS_BADMAC_LIMIT
-// #define MBEDTLS_SSL_SESSION_TICKETS
+#if CFG_TLS_SESSION_RESUME
+#define MBEDTLS_SSL_SESSION_TICKETS
+#endif
 // #define MBEDTLS_SSL_EXPORT_KEYS
 // #define MBEDTLS_SSL_SERVER_NAME_INDICATION
 // #define MBEDTLS_SSL_TRUNCATED_HMAC
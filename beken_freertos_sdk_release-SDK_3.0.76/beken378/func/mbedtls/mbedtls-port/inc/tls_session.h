@@ -0,0 +1,43 @@
+/*
+ *  Copyright (C) 2006-2015, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+#ifndef MBEDTLS_SESSION_H
+#define MBEDTLS_SESSION_H
+
+#include "tls_client.h"
+
+#if CFG_TLS_SESSION_RESUME
+/* client session resumption, one stored session per host:port. with
+ * CFG_EASY_FLASH the session is kept encrypted in easyflash and survives
+ * deep sleep and reboot, otherwise it lives in ram until reboot */
+
+#define TLS_SESSION_TICKET_MAX                 1024
+
+/* offer the stored session for session->host:port before the handshake,
+ * return 1 when one was offered */
+int tls_session_offer(MbedTLSSession *session);
+
+/* after a good handshake: store a new session, or count a resumed one */
+void tls_session_update(MbedTLSSession *session);
+
+/* drop the stored session, e.g. after a failed resumed handshake */
+void tls_session_forget(const char *host, const char *port);
+#endif
+
+#endif
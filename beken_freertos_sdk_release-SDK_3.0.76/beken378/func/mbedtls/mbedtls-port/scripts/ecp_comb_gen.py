@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+#
+# Generate src/ecp_comb_alt.c, the comb tables for R = m * G that
+# ecp_mul_comb() in ecp_alt.c reads from flash.
+#
+# The table of width w holds the 2^(w-1) points exactly as
+# ecp_precompute_comb() would build them, in affine form:
+#   T[i] = i_{w-1} 2^((w-1)d) G + ... + i_1 2^d G + G,  d = ceil(nbits / w)
+# w is at most 7, ecp_comb_fixed() keeps a sign in the 8th bit.
+#
+# usage: ecp_comb_gen.py [out.c]
+
+import os
+import sys
+
+CURVES = [
+    # name, group id, nbits, p, a, gx, gy, w
+    ('secp256r1', 'MBEDTLS_ECP_DP_SECP256R1', 256,
+     int('FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF', 16),
+     -3,
+     int('6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296', 16),
+     int('4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5', 16),
+     7),
+    ('secp384r1', 'MBEDTLS_ECP_DP_SECP384R1', 384,
+     int('FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE'
+         'FFFFFFFF0000000000000000FFFFFFFF', 16),
+     -3,
+     int('AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A38'
+         '5502F25DBF55296C3A545E3872760AB7', 16),
+     int('3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C0'
+         '0A60B1CE1D7E819D7A431D7C90EA0E5F', 16),
+     6),
+]
+
+HEAD = '''/*
+ *  Comb tables for R = m * G, kept in flash
+ *
+ *  Generated by scripts/ecp_comb_gen.py, do not edit.
+ *
+ *  SPDX-License-Identifier: Apache-2.0
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_ALT) && defined(MBEDTLS_ECP_ROM_TABLES)
+
+#include "mbedtls/ecp.h"
+
+#include <stddef.h>
+
+#if defined(MBEDTLS_HAVE_INT32)
+
+#define BYTES_TO_T_UINT_4( a, b, c, d )             \\
+    ( (mbedtls_mpi_uint) a <<  0 ) |                          \\
+    ( (mbedtls_mpi_uint) b <<  8 ) |                          \\
+    ( (mbedtls_mpi_uint) c << 16 ) |                          \\
+    ( (mbedtls_mpi_uint) d << 24 )
+
+#define BYTES_TO_T_UINT_8( a, b, c, d, e, f, g, h ) \\
+    BYTES_TO_T_UINT_4( a, b, c, d ),                \\
+    BYTES_TO_T_UINT_4( e, f, g, h )
+
+#else /* 64-bits */
+
+#define BYTES_TO_T_UINT_8( a, b, c, d, e, f, g, h ) \\
+    ( (mbedtls_mpi_uint) a <<  0 ) |                          \\
+    ( (mbedtls_mpi_uint) b <<  8 ) |                          \\
+    ( (mbedtls_mpi_uint) c << 16 ) |                          \\
+    ( (mbedtls_mpi_uint) d << 24 ) |                          \\
+    ( (mbedtls_mpi_uint) e << 32 ) |                          \\
+    ( (mbedtls_mpi_uint) f << 40 ) |                          \\
+    ( (mbedtls_mpi_uint) g << 48 ) |                          \\
+    ( (mbedtls_mpi_uint) h << 56 )
+
+#endif /* bits in mbedtls_mpi_uint */
+
+/* limbs of one coordinate of a curve of b bits */
+#define COMB_LIMBS( b )     ( ( b ) / 8 / sizeof( mbedtls_mpi_uint ) )
+
+/* point i of table t: X and Y point into flash, Z is left empty, which
+ * ecp_add_mixed() takes as Z == 1 */
+#define COMB_POINT( t, i )                                              \\
+    { { 1, sizeof( t[0] ) / sizeof( mbedtls_mpi_uint ),                 \\
+        (mbedtls_mpi_uint *) t[2 * ( i )] },                            \\
+      { 1, sizeof( t[0] ) / sizeof( mbedtls_mpi_uint ),                 \\
+        (mbedtls_mpi_uint *) t[2 * ( i ) + 1] },                        \\
+      { 0, 0, NULL } }
+'''
+
+TAIL = '''
+/* cleared to time or check m * G on the tables built at run time */
+int mbedtls_ecp_comb_rom_enabled = 1;
+
+const mbedtls_ecp_point *mbedtls_ecp_comb_rom( const mbedtls_ecp_group *grp,
+                                               const mbedtls_ecp_point *P,
+                                               unsigned char *w )
+{
+    const mbedtls_ecp_point *T;
+    unsigned char t_w;
+
+    if( !mbedtls_ecp_comb_rom_enabled )
+        return( NULL );
+
+    switch( grp->id )
+    {
+%(cases)s
+        default:
+            return( NULL );
+    }
+
+    /* T[0] is G itself, only use the table when P is that point */
+    if( mbedtls_mpi_cmp_int( &P->Z, 1 ) != 0 ||
+        mbedtls_mpi_cmp_mpi( &P->X, &T[0].X ) != 0 ||
+        mbedtls_mpi_cmp_mpi( &P->Y, &T[0].Y ) != 0 )
+        return( NULL );
+
+    *w = t_w;
+
+    return( T );
+}
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_ALT && MBEDTLS_ECP_ROM_TABLES */
+'''
+
+
+def inv(x, p):
+    return pow(x, p - 2, p)
+
+
+def add(P, Q, p, a):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0:
+            return None
+        lam = (3 * P[0] * P[0] + a) * inv(2 * P[1], p) % p
+    else:
+        lam = (Q[1] - P[1]) * inv(Q[0] - P[0], p) % p
+    x = (lam * lam - P[0] - Q[0]) % p
+    return (x, (lam * (P[0] - x) - P[1]) % p)
+
+
+def double_n(P, n, p, a):
+    for _ in range(n):
+        P = add(P, P, p, a)
+    return P
+
+
+def comb_table(nbits, p, a, g, w):
+    d = (nbits + w - 1) // w
+    base = [g]
+    for _ in range(1, w):
+        base.append(double_n(base[-1], d, p, a))
+    T = []
+    for i in range(1 << (w - 1)):
+        pt = g
+        for l in range(1, w):
+            if (i >> (l - 1)) & 1:
+                pt = add(pt, base[l], p, a)
+        T.append(pt)
+    return T
+
+
+def limbs(v, nbytes):
+    b = v.to_bytes(nbytes, 'little')
+    rows = []
+    for k in range(0, nbytes, 8):
+        rows.append('    BYTES_TO_T_UINT_8( %s ),' %
+                    ', '.join('0x%02X' % c for c in b[k:k + 8]))
+    return rows
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    out = sys.argv[1] if len(sys.argv) > 1 else \
+        os.path.join(here, '..', 'src', 'ecp_comb_alt.c')
+
+    lines = [HEAD]
+    cases = []
+    for name, gid, nbits, p, a, gx, gy, w in CURVES:
+        T = comb_table(nbits, p, a % p, (gx, gy), w)
+        n = len(T)
+        d = (nbits + w - 1) // w
+        guard = gid + '_ENABLED'
+        lines.append('#if defined(%s)' % guard)
+        lines.append('/* w = %d, d = %d: %d points */' % (w, d, n))
+        lines.append('#define %s_COMB_W    %d' % (name.upper(), w))
+        lines.append('static const mbedtls_mpi_uint %s_comb[%d][COMB_LIMBS( %d )] = {'
+                     % (name, 2 * n, nbits))
+        for i, (x, y) in enumerate(T):
+            for c in (x, y):
+                lines.append('  {')
+                lines.extend(limbs(c, nbits // 8))
+                lines.append('  },')
+        lines.append('};')
+        lines.append('')
+        lines.append('static const mbedtls_ecp_point %s_comb_T[%d] = {' % (name, n))
+        for i in range(n):
+            lines.append('    COMB_POINT( %s_comb, %d ),' % (name, i))
+        lines.append('};')
+        lines.append('#endif /* %s */' % guard)
+        lines.append('')
+        cases.append('#if defined(%s)\n'
+                     '        case %s:\n'
+                     '            T = %s_comb_T;\n'
+                     '            t_w = %s_COMB_W;\n'
+                     '            break;\n'
+                     '#endif' % (guard, gid, name, name.upper()))
+
+    text = '\n'.join(lines) + TAIL % {'cases': '\n'.join(cases)}
+    with open(out, 'w', newline='\n') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
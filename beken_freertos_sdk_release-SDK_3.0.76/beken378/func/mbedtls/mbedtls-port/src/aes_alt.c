@@ -0,0 +1,588 @@
+/*
+ *  AES on the bk7221u security engine
+ *
+ *  Copyright (C) 2006-2015, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_AES_ALT)
+
+#include "mbedtls/aes.h"
+
+#include <string.h>
+
+#include "include.h"
+#include "arm_arch.h"
+#include "rtos_pub.h"
+#include "mem_pub.h"
+#include "uart_pub.h"
+#include "security_reg.h"
+#include "security.h"
+#include "hal_aes.h"
+
+/* one engine, one key register set, shared by every context */
+static beken_mutex_t aes_alt_mutex = NULL;
+static int aes_alt_ready = 0;
+
+/* Implementation that should never be optimized out by the compiler */
+static void mbedtls_zeroize( void *v, size_t n ) {
+    volatile unsigned char *p = (unsigned char*)v; while( n-- ) *p++ = 0;
+}
+
+static void aes_alt_lock( void )
+{
+    beken_mutex_t mutex = NULL;
+    GLOBAL_INT_DECLARATION();
+
+    if( aes_alt_mutex == NULL )
+    {
+        rtos_init_mutex( &mutex );
+
+        GLOBAL_INT_DISABLE();
+        if( aes_alt_mutex == NULL )
+        {
+            aes_alt_mutex = mutex;
+            mutex = NULL;
+        }
+        GLOBAL_INT_RESTORE();
+
+        if( mutex != NULL )
+            rtos_deinit_mutex( &mutex );
+    }
+
+    rtos_lock_mutex( &aes_alt_mutex );
+
+    if( !aes_alt_ready )
+    {
+        security_aes_init( NULL, NULL );
+        aes_alt_ready = 1;
+    }
+}
+
+static void aes_alt_unlock( void )
+{
+    rtos_unlock_mutex( &aes_alt_mutex );
+}
+
+/* load the key and set the direction once for the whole call. The key is
+ * not cached: hal_aes writes the key registers without this lock, and they
+ * do not survive a power down of the security block */
+static void aes_alt_prepare( const mbedtls_aes_context *ctx, int mode )
+{
+    UINT32 reg;
+
+    security_aes_set_key( ctx->key, ctx->keybits );
+
+    reg = REG_READ( SECURITY_AES_CONFIG );
+    if( mode == MBEDTLS_AES_ENCRYPT )
+        reg |= SECURITY_AES_ENCODE_BIT;
+    else
+        reg &= ~SECURITY_AES_ENCODE_BIT;
+    REG_WRITE( SECURITY_AES_CONFIG, reg );
+}
+
+/* one block with the key and direction already set */
+static void aes_alt_block( const unsigned char input[16], unsigned char output[16] )
+{
+    security_aes_set_block_data( input );
+
+    REG_WRITE( SECURITY_AES_CTRL, REG_READ( SECURITY_AES_CTRL ) | SECURITY_AES_AUTEO_BIT );
+    while( ( REG_READ( SECURITY_AES_STATUS ) & SECURITY_AES_VALID ) == 0 );
+
+    security_aes_get_result_data( output );
+}
+
+void mbedtls_aes_init( mbedtls_aes_context *ctx )
+{
+    memset( ctx, 0, sizeof( mbedtls_aes_context ) );
+}
+
+void mbedtls_aes_free( mbedtls_aes_context *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_zeroize( ctx, sizeof( mbedtls_aes_context ) );
+}
+
+int mbedtls_aes_setkey_enc( mbedtls_aes_context *ctx, const unsigned char *key,
+                    unsigned int keybits )
+{
+    if( keybits != 128 && keybits != 192 && keybits != 256 )
+        return( MBEDTLS_ERR_AES_INVALID_KEY_LENGTH );
+
+    memset( ctx->key, 0, sizeof( ctx->key ) );
+    memcpy( ctx->key, key, keybits / 8 );
+    ctx->keybits = keybits;
+
+    return( 0 );
+}
+
+/* the engine expands the key for both directions itself */
+int mbedtls_aes_setkey_dec( mbedtls_aes_context *ctx, const unsigned char *key,
+                    unsigned int keybits )
+{
+    return( mbedtls_aes_setkey_enc( ctx, key, keybits ) );
+}
+
+int mbedtls_internal_aes_encrypt( mbedtls_aes_context *ctx,
+                                  const unsigned char input[16],
+                                  unsigned char output[16] )
+{
+    aes_alt_lock();
+    aes_alt_prepare( ctx, MBEDTLS_AES_ENCRYPT );
+    aes_alt_block( input, output );
+    aes_alt_unlock();
+
+    return( 0 );
+}
+
+int mbedtls_internal_aes_decrypt( mbedtls_aes_context *ctx,
+                                  const unsigned char input[16],
+                                  unsigned char output[16] )
+{
+    aes_alt_lock();
+    aes_alt_prepare( ctx, MBEDTLS_AES_DECRYPT );
+    aes_alt_block( input, output );
+    aes_alt_unlock();
+
+    return( 0 );
+}
+
+#if !defined(MBEDTLS_DEPRECATED_REMOVED)
+void mbedtls_aes_encrypt( mbedtls_aes_context *ctx,
+                          const unsigned char input[16],
+                          unsigned char output[16] )
+{
+    mbedtls_internal_aes_encrypt( ctx, input, output );
+}
+
+void mbedtls_aes_decrypt( mbedtls_aes_context *ctx,
+                          const unsigned char input[16],
+                          unsigned char output[16] )
+{
+    mbedtls_internal_aes_decrypt( ctx, input, output );
+}
+#endif
+
+int mbedtls_aes_crypt_ecb( mbedtls_aes_context *ctx,
+                    int mode,
+                    const unsigned char input[16],
+                    unsigned char output[16] )
+{
+    if( mode == MBEDTLS_AES_ENCRYPT )
+        return( mbedtls_internal_aes_encrypt( ctx, input, output ) );
+    else
+        return( mbedtls_internal_aes_decrypt( ctx, input, output ) );
+}
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+int mbedtls_aes_crypt_cbc( mbedtls_aes_context *ctx,
+                    int mode,
+                    size_t length,
+                    unsigned char iv[16],
+                    const unsigned char *input,
+                    unsigned char *output )
+{
+    int i;
+    unsigned char temp[16];
+
+    if( length % 16 )
+        return( MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH );
+
+    aes_alt_lock();
+    aes_alt_prepare( ctx, mode );
+
+    if( mode == MBEDTLS_AES_DECRYPT )
+    {
+        while( length > 0 )
+        {
+            memcpy( temp, input, 16 );
+            aes_alt_block( input, output );
+
+            for( i = 0; i < 16; i++ )
+                output[i] = (unsigned char)( output[i] ^ iv[i] );
+
+            memcpy( iv, temp, 16 );
+
+            input  += 16;
+            output += 16;
+            length -= 16;
+        }
+    }
+    else
+    {
+        while( length > 0 )
+        {
+            for( i = 0; i < 16; i++ )
+                temp[i] = (unsigned char)( input[i] ^ iv[i] );
+
+            aes_alt_block( temp, output );
+            memcpy( iv, output, 16 );
+
+            input  += 16;
+            output += 16;
+            length -= 16;
+        }
+    }
+
+    aes_alt_unlock();
+
+    return( 0 );
+}
+#endif /* MBEDTLS_CIPHER_MODE_CBC */
+
+#if defined(MBEDTLS_CIPHER_MODE_CFB)
+int mbedtls_aes_crypt_cfb128( mbedtls_aes_context *ctx,
+                       int mode,
+                       size_t length,
+                       size_t *iv_off,
+                       unsigned char iv[16],
+                       const unsigned char *input,
+                       unsigned char *output )
+{
+    int c;
+    size_t n = *iv_off;
+
+    aes_alt_lock();
+    aes_alt_prepare( ctx, MBEDTLS_AES_ENCRYPT );
+
+    if( mode == MBEDTLS_AES_DECRYPT )
+    {
+        while( length-- )
+        {
+            if( n == 0 )
+                aes_alt_block( iv, iv );
+
+            c = *input++;
+            *output++ = (unsigned char)( c ^ iv[n] );
+            iv[n] = (unsigned char) c;
+
+            n = ( n + 1 ) & 0x0F;
+        }
+    }
+    else
+    {
+        while( length-- )
+        {
+            if( n == 0 )
+                aes_alt_block( iv, iv );
+
+            iv[n] = *output++ = (unsigned char)( iv[n] ^ *input++ );
+
+            n = ( n + 1 ) & 0x0F;
+        }
+    }
+
+    aes_alt_unlock();
+    *iv_off = n;
+
+    return( 0 );
+}
+
+int mbedtls_aes_crypt_cfb8( mbedtls_aes_context *ctx,
+                       int mode,
+                       size_t length,
+                       unsigned char iv[16],
+                       const unsigned char *input,
+                       unsigned char *output )
+{
+    unsigned char c;
+    unsigned char ov[17];
+
+    aes_alt_lock();
+    aes_alt_prepare( ctx, MBEDTLS_AES_ENCRYPT );
+
+    while( length-- )
+    {
+        memcpy( ov, iv, 16 );
+        aes_alt_block( iv, iv );
+
+        if( mode == MBEDTLS_AES_DECRYPT )
+            ov[16] = *input;
+
+        c = *output++ = (unsigned char)( iv[0] ^ *input++ );
+
+        if( mode == MBEDTLS_AES_ENCRYPT )
+            ov[16] = c;
+
+        memcpy( iv, ov + 1, 16 );
+    }
+
+    aes_alt_unlock();
+
+    return( 0 );
+}
+#endif /* MBEDTLS_CIPHER_MODE_CFB */
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+int mbedtls_aes_crypt_ctr( mbedtls_aes_context *ctx,
+                       size_t length,
+                       size_t *nc_off,
+                       unsigned char nonce_counter[16],
+                       unsigned char stream_block[16],
+                       const unsigned char *input,
+                       unsigned char *output )
+{
+    int c, i;
+    size_t n = *nc_off;
+
+    aes_alt_lock();
+    aes_alt_prepare( ctx, MBEDTLS_AES_ENCRYPT );
+
+    while( length-- )
+    {
+        if( n == 0 )
+        {
+            aes_alt_block( nonce_counter, stream_block );
+
+            for( i = 16; i > 0; i-- )
+                if( ++nonce_counter[i - 1] != 0 )
+                    break;
+        }
+        c = *input++;
+        *output++ = (unsigned char)( c ^ stream_block[n] );
+
+        n = ( n + 1 ) & 0x0F;
+    }
+
+    aes_alt_unlock();
+    *nc_off = n;
+
+    return( 0 );
+}
+#endif /* MBEDTLS_CIPHER_MODE_CTR */
+
+/* FIPS-197 appendix C and SP 800-38A F.2.1/F.5.1 */
+static const unsigned char aes_alt_test_pt[16] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+
+static const unsigned char aes_alt_test_ecb_ct[3][16] =
+{
+    { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+      0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+    { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+      0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+    { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+      0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 }
+};
+
+static const unsigned char aes_alt_test_key[16] =
+{
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const unsigned char aes_alt_test_msg[32] =
+{
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+    0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+    0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51
+};
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+static const unsigned char aes_alt_test_cbc_ct[32] =
+{
+    0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46,
+    0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+    0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee,
+    0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2
+};
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+static const unsigned char aes_alt_test_ctr_ct[32] =
+{
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+    0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+    0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff
+};
+#endif
+
+static int aes_alt_check( int verbose, const char *name,
+                          const unsigned char *got, const unsigned char *expect, size_t len )
+{
+    int fail = ( memcmp( got, expect, len ) != 0 );
+
+    if( verbose != 0 )
+        os_printf( "  AES-HW %s: %s\r\n", name, fail ? "failed" : "passed" );
+
+    return( fail );
+}
+
+int mbedtls_aes_alt_self_test( int verbose )
+{
+    int i, j, fail = 0;
+    unsigned char key[32];
+    unsigned char iv[16];
+    unsigned char buf[32];
+    mbedtls_aes_context ctx;
+
+    mbedtls_aes_init( &ctx );
+
+    for( i = 0; i < 3; i++ )
+    {
+        for( j = 0; j < 32; j++ )
+            key[j] = (unsigned char) j;
+
+        mbedtls_aes_setkey_enc( &ctx, key, 128 + i * 64 );
+        mbedtls_aes_crypt_ecb( &ctx, MBEDTLS_AES_ENCRYPT, aes_alt_test_pt, buf );
+        fail |= aes_alt_check( verbose, i == 0 ? "ECB-128 enc" : i == 1 ? "ECB-192 enc" : "ECB-256 enc",
+                               buf, aes_alt_test_ecb_ct[i], 16 );
+
+        mbedtls_aes_setkey_dec( &ctx, key, 128 + i * 64 );
+        mbedtls_aes_crypt_ecb( &ctx, MBEDTLS_AES_DECRYPT, aes_alt_test_ecb_ct[i], buf );
+        fail |= aes_alt_check( verbose, i == 0 ? "ECB-128 dec" : i == 1 ? "ECB-192 dec" : "ECB-256 dec",
+                               buf, aes_alt_test_pt, 16 );
+    }
+
+    mbedtls_aes_setkey_enc( &ctx, aes_alt_test_key, 128 );
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+    for( j = 0; j < 16; j++ )
+        iv[j] = (unsigned char) j;
+    mbedtls_aes_crypt_cbc( &ctx, MBEDTLS_AES_ENCRYPT, 32, iv, aes_alt_test_msg, buf );
+    fail |= aes_alt_check( verbose, "CBC-128 enc", buf, aes_alt_test_cbc_ct, 32 );
+
+    for( j = 0; j < 16; j++ )
+        iv[j] = (unsigned char) j;
+    mbedtls_aes_crypt_cbc( &ctx, MBEDTLS_AES_DECRYPT, 32, iv, buf, buf );
+    fail |= aes_alt_check( verbose, "CBC-128 dec", buf, aes_alt_test_msg, 32 );
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+    {
+        size_t off = 0;
+        unsigned char stream[16];
+
+        /* split the message so the stream block carries across calls */
+        for( j = 0; j < 16; j++ )
+            iv[j] = (unsigned char)( 0xf0 + j );
+        mbedtls_aes_crypt_ctr( &ctx, 5, &off, iv, stream, aes_alt_test_msg, buf );
+        mbedtls_aes_crypt_ctr( &ctx, 27, &off, iv, stream, aes_alt_test_msg + 5, buf + 5 );
+        fail |= aes_alt_check( verbose, "CTR-128", buf, aes_alt_test_ctr_ct, 32 );
+    }
+#endif
+
+    mbedtls_aes_free( &ctx );
+
+    if( verbose != 0 )
+        os_printf( "  AES-HW self test %s\r\n", fail ? "failed" : "passed" );
+
+    return( fail );
+}
+
+#define AES_ALT_BENCH_ROUNDS        8
+
+#if (CFG_USE_MBEDTLS == 0)
+extern void *aes_encrypt_init(const u8 *key, size_t len);
+extern void aes_encrypt(void *ctx, const u8 *plain, u8 *crypt);
+extern void aes_encrypt_deinit(void *ctx);
+#endif
+
+static void aes_alt_bench_print( const char *name, size_t len, UINT32 ms )
+{
+    if( ms == 0 )
+        ms = 1;
+
+    os_printf( "  %s: %d bytes x %d in %d ms, %d KB/s\r\n", name, len, AES_ALT_BENCH_ROUNDS,
+               ms, ( len * AES_ALT_BENCH_ROUNDS * 1000 / ms ) >> 10 );
+}
+
+void mbedtls_aes_alt_bench( size_t len )
+{
+    int i;
+    size_t off;
+    UINT32 start;
+    unsigned char iv[16], stream[16];
+    unsigned char *buf;
+    mbedtls_aes_context ctx;
+#if (CFG_USE_MBEDTLS == 0)
+    void *sw;
+#endif
+
+    len &= ~0x0F;
+    if( len == 0 )
+        return;
+
+    buf = (unsigned char *)os_malloc( len );
+    if( buf == NULL )
+        return;
+
+    memset( buf, 0x5a, len );
+    memset( iv, 0, sizeof( iv ) );
+
+    mbedtls_aes_init( &ctx );
+    mbedtls_aes_setkey_enc( &ctx, aes_alt_test_key, 128 );
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+    start = rtos_get_time();
+    for( i = 0; i < AES_ALT_BENCH_ROUNDS; i++ )
+        mbedtls_aes_crypt_cbc( &ctx, MBEDTLS_AES_ENCRYPT, len, iv, buf, buf );
+    aes_alt_bench_print( "hw cbc", len, rtos_get_time() - start );
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+    start = rtos_get_time();
+    for( i = 0; i < AES_ALT_BENCH_ROUNDS; i++ )
+    {
+        off = 0;
+        mbedtls_aes_crypt_ctr( &ctx, len, &off, iv, stream, buf, buf );
+    }
+    aes_alt_bench_print( "hw ctr", len, rtos_get_time() - start );
+#endif
+
+    mbedtls_aes_free( &ctx );
+
+#if (CFG_USE_MBEDTLS == 0)
+    /* the software aes in the supplicant, chained the same way as cbc */
+    sw = aes_encrypt_init( aes_alt_test_key, 16 );
+    if( sw != NULL )
+    {
+        start = rtos_get_time();
+        for( i = 0; i < AES_ALT_BENCH_ROUNDS; i++ )
+        {
+            for( off = 0; off < len; off += 16 )
+            {
+                int j;
+
+                for( j = 0; j < 16; j++ )
+                    buf[off + j] ^= iv[j];
+                aes_encrypt( sw, buf + off, buf + off );
+                memcpy( iv, buf + off, 16 );
+            }
+        }
+        aes_alt_bench_print( "sw cbc", len, rtos_get_time() - start );
+        aes_encrypt_deinit( sw );
+    }
+#endif
+
+    os_free( buf );
+}
+
+#endif /* MBEDTLS_AES_ALT */
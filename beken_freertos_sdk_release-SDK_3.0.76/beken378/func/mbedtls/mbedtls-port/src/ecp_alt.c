@@ -1359,6 +1359,9 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     unsigned char k[COMB_MAX_D + 1];
     mbedtls_ecp_point *T;
     mbedtls_mpi M, mm;
+#if defined(MBEDTLS_ECP_ROM_TABLES)
+    const mbedtls_ecp_point *T_rom;
+#endif
 
     mbedtls_mpi_init( &M );
     mbedtls_mpi_init( &mm );
@@ -1397,6 +1400,16 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     if( w >= grp->nbits )
         w = 2;
 
+#if defined(MBEDTLS_ECP_ROM_TABLES)
+    /*
+     * If P == G and the curve has a table in flash, use it with its own
+     * (wider) w. It is never freed, like grp->T.
+     */
+    T_rom = mbedtls_ecp_comb_rom( grp, P, &w );
+    if( T_rom != NULL )
+        p_eq_g = 1;
+#endif
+
     /* Other sizes that depend on w */
     pre_len = 1U << ( w - 1 );
     d = ( grp->nbits + w - 1 ) / w;
@@ -1406,6 +1419,10 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
      * use grp->T if already initialized, or initialize it.
      */
     T = p_eq_g ? grp->T : NULL;
+#if defined(MBEDTLS_ECP_ROM_TABLES)
+    if( T_rom != NULL )
+        T = (mbedtls_ecp_point *) T_rom;
+#endif
 
     if( T == NULL )
     {
@@ -0,0 +1,1497 @@
+/*
+ *  Comb tables for R = m * G, kept in flash
+ *
+ *  Generated by scripts/ecp_comb_gen.py, do not edit.
+ *
+ *  SPDX-License-Identifier: Apache-2.0
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_ALT) && defined(MBEDTLS_ECP_ROM_TABLES)
+
+#include "mbedtls/ecp.h"
+
+#include <stddef.h>
+
+#if defined(MBEDTLS_HAVE_INT32)
+
+#define BYTES_TO_T_UINT_4( a, b, c, d )             \
+    ( (mbedtls_mpi_uint) a <<  0 ) |                          \
+    ( (mbedtls_mpi_uint) b <<  8 ) |                          \
+    ( (mbedtls_mpi_uint) c << 16 ) |                          \
+    ( (mbedtls_mpi_uint) d << 24 )
+
+#define BYTES_TO_T_UINT_8( a, b, c, d, e, f, g, h ) \
+    BYTES_TO_T_UINT_4( a, b, c, d ),                \
+    BYTES_TO_T_UINT_4( e, f, g, h )
+
+#else /* 64-bits */
+
+#define BYTES_TO_T_UINT_8( a, b, c, d, e, f, g, h ) \
+    ( (mbedtls_mpi_uint) a <<  0 ) |                          \
+    ( (mbedtls_mpi_uint) b <<  8 ) |                          \
+    ( (mbedtls_mpi_uint) c << 16 ) |                          \
+    ( (mbedtls_mpi_uint) d << 24 ) |                          \
+    ( (mbedtls_mpi_uint) e << 32 ) |                          \
+    ( (mbedtls_mpi_uint) f << 40 ) |                          \
+    ( (mbedtls_mpi_uint) g << 48 ) |                          \
+    ( (mbedtls_mpi_uint) h << 56 )
+
+#endif /* bits in mbedtls_mpi_uint */
+
+/* limbs of one coordinate of a curve of b bits */
+#define COMB_LIMBS( b )     ( ( b ) / 8 / sizeof( mbedtls_mpi_uint ) )
+
+/* point i of table t: X and Y point into flash, Z is left empty, which
+ * ecp_add_mixed() takes as Z == 1 */
+#define COMB_POINT( t, i )                                              \
+    { { 1, sizeof( t[0] ) / sizeof( mbedtls_mpi_uint ),                 \
+        (mbedtls_mpi_uint *) t[2 * ( i )] },                            \
+      { 1, sizeof( t[0] ) / sizeof( mbedtls_mpi_uint ),                 \
+        (mbedtls_mpi_uint *) t[2 * ( i ) + 1] },                        \
+      { 0, 0, NULL } }
+
+#if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+/* w = 7, d = 37: 64 points */
+#define SECP256R1_COMB_W    7
+static const mbedtls_mpi_uint secp256r1_comb[128][COMB_LIMBS( 256 )] = {
+  {
+    BYTES_TO_T_UINT_8( 0x96, 0xC2, 0x98, 0xD8, 0x45, 0x39, 0xA1, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0xA0, 0x33, 0xEB, 0x2D, 0x81, 0x7D, 0x03, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x40, 0xA4, 0x63, 0xE5, 0xE6, 0xBC, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x47, 0x42, 0x2C, 0xE1, 0xF2, 0xD1, 0x17, 0x6B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xF5, 0x51, 0xBF, 0x37, 0x68, 0x40, 0xB6, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x5E, 0x31, 0x6B, 0x57, 0x33, 0xCE, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x16, 0x9E, 0x0F, 0x7C, 0x4A, 0xEB, 0xE7, 0x8E ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x7F, 0x1A, 0xFE, 0xE2, 0x42, 0xE3, 0x4F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBC, 0xE2, 0xD4, 0x66, 0x8E, 0xFA, 0xBD, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x8B, 0x85, 0x1F, 0x9B, 0x69, 0xA5, 0x77, 0x8F ),
+    BYTES_TO_T_UINT_8( 0x70, 0x10, 0xFB, 0xB6, 0x05, 0x58, 0xEC, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x1F, 0x35, 0x64, 0x9D, 0x1E, 0x70, 0xDF, 0x1C ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x45, 0xBA, 0x83, 0x27, 0x42, 0x70, 0x42, 0xBA ),
+    BYTES_TO_T_UINT_8( 0x19, 0x5B, 0x66, 0xF7, 0xE3, 0x9C, 0xB0, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x62, 0x68, 0x65, 0x8C, 0xAA, 0x94, 0xCA, 0x0B ),
+    BYTES_TO_T_UINT_8( 0x76, 0x6B, 0x3C, 0xC4, 0x62, 0x7F, 0x7D, 0xC3 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x11, 0x06, 0x7A, 0x71, 0x19, 0x89, 0xF6, 0x49 ),
+    BYTES_TO_T_UINT_8( 0x01, 0x77, 0xF1, 0x28, 0x96, 0xA2, 0x76, 0x39 ),
+    BYTES_TO_T_UINT_8( 0x83, 0xCB, 0xF3, 0x5D, 0x9D, 0xEB, 0xCD, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0x44, 0xB6, 0xCF, 0xCC, 0x55, 0x3C, 0x18 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xE8, 0xBC, 0xEF, 0x70, 0x3F, 0x1B, 0x6D, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x28, 0x62, 0x7E, 0x16, 0x84, 0x44, 0xFF, 0x79 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x0B, 0x29, 0xF6, 0x6F, 0xC3, 0x41, 0xFA ),
+    BYTES_TO_T_UINT_8( 0x65, 0x6B, 0xB7, 0xE5, 0x49, 0x12, 0xEF, 0xEA ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xEC, 0xB1, 0x7A, 0xA9, 0x2D, 0x1D, 0x1B, 0xB4 ),
+    BYTES_TO_T_UINT_8( 0x2B, 0xBA, 0xCE, 0x83, 0x84, 0x77, 0x91, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0xDE, 0x50, 0x28, 0x8D, 0x0D, 0xEC, 0xFB, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xB1, 0x76, 0x63, 0x3A, 0xFD, 0xB5, 0x20, 0x7A ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x97, 0x8D, 0x5F, 0x68, 0x22, 0x17, 0xD2, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x21, 0xEE, 0x22, 0xD6, 0xF8, 0x73, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0x74, 0xA3, 0x46, 0x3F, 0x51, 0x89, 0xCC, 0x97 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0xAD, 0x5F, 0x17, 0x41, 0x1D, 0x7F, 0x47 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x27, 0x28, 0x60, 0xFC, 0x32, 0x58, 0x30, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x72, 0xB3, 0xC1, 0x55, 0x79, 0xB3, 0xE0, 0x08 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0xA6, 0xA3, 0x2A, 0xF7, 0x57, 0xCB, 0x7D ),
+    BYTES_TO_T_UINT_8( 0x9A, 0xF0, 0xB0, 0x4F, 0x3D, 0xB6, 0xF1, 0x5F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x7F, 0x4F, 0x85, 0x1C, 0x36, 0x46, 0x0A, 0x37 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xF4, 0x30, 0x28, 0xA7, 0xF9, 0x37, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x8A, 0xD5, 0xA2, 0xF2, 0x33, 0x0D, 0xAA ),
+    BYTES_TO_T_UINT_8( 0xF0, 0xB3, 0x90, 0xC4, 0x57, 0x47, 0x2E, 0x56 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x63, 0x3D, 0x02, 0x79, 0x7F, 0xFD, 0x57, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x8B, 0xE7, 0x6D, 0x05, 0xBF, 0x03, 0x96, 0x7F ),
+    BYTES_TO_T_UINT_8( 0x21, 0xF9, 0x4D, 0x21, 0x89, 0xA8, 0x90, 0x37 ),
+    BYTES_TO_T_UINT_8( 0x1A, 0x5A, 0x3A, 0x9A, 0x8E, 0xCB, 0x0C, 0xA2 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB1, 0x87, 0x57, 0xF7, 0x4B, 0x59, 0xEB, 0x9B ),
+    BYTES_TO_T_UINT_8( 0x08, 0x9C, 0x11, 0x86, 0x4F, 0x6F, 0x80, 0xDD ),
+    BYTES_TO_T_UINT_8( 0x64, 0x13, 0x07, 0xD8, 0xE8, 0x51, 0x3A, 0x6D ),
+    BYTES_TO_T_UINT_8( 0xAA, 0x43, 0x7A, 0x15, 0x16, 0x56, 0xAA, 0xFC ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xEB, 0x4A, 0x5C, 0x37, 0x57, 0xAC, 0x7C, 0x51 ),
+    BYTES_TO_T_UINT_8( 0xD2, 0x6B, 0xF1, 0x4F, 0xBC, 0x99, 0x24, 0x35 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x65, 0xD2, 0xB0, 0x32, 0x10, 0x1B, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x4E, 0x17, 0xF4, 0x6B, 0xB3, 0xB3, 0x2D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA4, 0xC1, 0x15, 0x33, 0x0D, 0x82, 0x6C, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xC4, 0xDC, 0x51, 0xF8, 0x26, 0xCE, 0xE3, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0xE4, 0x9E, 0x8E, 0xFC, 0x1D, 0x4F, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x6E, 0x9E, 0x03, 0xE6, 0x4E, 0xE7, 0x30, 0x30 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x5F, 0x88, 0x88, 0x34, 0x96, 0x0D, 0xBB, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xF8, 0x05, 0xD5, 0xEF, 0x4B, 0x03, 0xBE ),
+    BYTES_TO_T_UINT_8( 0xCC, 0xF6, 0xAC, 0x32, 0x6E, 0x8F, 0xCD, 0x64 ),
+    BYTES_TO_T_UINT_8( 0x0F, 0xB5, 0x84, 0xAB, 0x4C, 0x8E, 0x5F, 0x91 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD4, 0x1B, 0xC9, 0x2D, 0x38, 0xAE, 0x42, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x9E, 0xAC, 0x59, 0xAA, 0x9E, 0x98, 0x6C, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x71, 0xC5, 0x41, 0xFC, 0xC1, 0xAD, 0x5E, 0x2D ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x42, 0x9D, 0xEF, 0x79, 0xDA, 0xF8, 0x43 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xAD, 0x59, 0x5E, 0xCA, 0x6D, 0xB2, 0x6C, 0x27 ),
+    BYTES_TO_T_UINT_8( 0xE1, 0x1D, 0x04, 0x13, 0xFB, 0xAA, 0x88, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x73, 0xCF, 0x3B, 0x14, 0x35, 0x22, 0x7D, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x74, 0xE7, 0x77, 0x59, 0x97, 0x74, 0x1C, 0xA9 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xC9, 0x1A, 0x9D, 0x2F, 0x81, 0xEF, 0x0D, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x6E, 0xE1, 0x86, 0xEA, 0xD5, 0x67, 0x0C ),
+    BYTES_TO_T_UINT_8( 0xD1, 0xF8, 0x30, 0x47, 0xD9, 0x2D, 0xDD, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0xEF, 0x61, 0x3B, 0xD7, 0x5D, 0x9A, 0xF5 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xCF, 0xEF, 0x95, 0x75, 0x03, 0x89, 0xC4, 0xAC ),
+    BYTES_TO_T_UINT_8( 0xD4, 0xCF, 0x99, 0x6A, 0x71, 0x71, 0x5B, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x78, 0x05, 0xDC, 0xFE, 0xED, 0xF7, 0xBB, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x6B, 0x25, 0xEC, 0xF5, 0x27, 0xD2, 0xB5, 0x1D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x30, 0x4B, 0xE4, 0xFF, 0x54, 0xBE, 0xD1, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x75, 0x5A, 0x5E, 0x7C, 0x20, 0x68, 0x4D, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x51, 0xEF, 0x2A, 0xCA, 0x90, 0xFA, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x66, 0x9A, 0x23, 0x30, 0x1D, 0xC3, 0x26, 0x9F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB9, 0xC3, 0xA1, 0x80, 0x18, 0x36, 0xE8, 0xFB ),
+    BYTES_TO_T_UINT_8( 0x6D, 0xC4, 0x01, 0x14, 0xAE, 0xB0, 0x95, 0x9F ),
+    BYTES_TO_T_UINT_8( 0xF7, 0xB0, 0x76, 0x4A, 0xD0, 0x8C, 0x6A, 0x6C ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x9B, 0x15, 0x99, 0x29, 0x6B, 0x24, 0x5B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x3D, 0x0D, 0xFF, 0x3A, 0x1A, 0x97, 0x68, 0x6E ),
+    BYTES_TO_T_UINT_8( 0xF9, 0xD2, 0xB6, 0xFB, 0x07, 0x64, 0x04, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x26, 0x7A, 0xAB, 0x73, 0xF4, 0x3F, 0x8E, 0xED ),
+    BYTES_TO_T_UINT_8( 0x2E, 0xA1, 0x05, 0x9F, 0x23, 0x06, 0xCD, 0xB1 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB4, 0xB2, 0x40, 0x44, 0xC3, 0x0A, 0x0D, 0x0F ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x66, 0x24, 0xBC, 0xC4, 0xAB, 0x5B, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xAE, 0x87, 0x6E, 0xE5, 0x97, 0xD9, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x97, 0x3D, 0x35, 0xCA, 0x07, 0x37, 0x2A, 0x7B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x0D, 0x2F, 0xEF, 0xD2, 0xE7, 0x39, 0x80, 0x42 ),
+    BYTES_TO_T_UINT_8( 0x14, 0xE5, 0x91, 0xCC, 0xF6, 0x0C, 0xDB, 0x48 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xB5, 0x85, 0xA6, 0xE7, 0xAA, 0x5F, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0xCC, 0x52, 0x27, 0xA4, 0x9E, 0x3B, 0x50, 0x71 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA1, 0x1A, 0x26, 0xFB, 0xA5, 0xAF, 0x69, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x2C, 0xA5, 0xC7, 0xD0, 0xFE, 0xEB, 0xD7, 0xEA ),
+    BYTES_TO_T_UINT_8( 0x17, 0xAA, 0x46, 0xB6, 0x8C, 0x5F, 0xAA, 0x3D ),
+    BYTES_TO_T_UINT_8( 0xFE, 0x29, 0xA7, 0x57, 0x51, 0x6B, 0xF2, 0xD1 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x5F, 0x59, 0x4A, 0x4F, 0x34, 0x2A, 0x8C, 0x2A ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xF6, 0x69, 0x93, 0xCE, 0xE8, 0xC3, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xB3, 0xC3, 0xD4, 0x03, 0x09, 0x71, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x23, 0x14, 0xFC, 0x48, 0x72, 0x09, 0xF6, 0x48 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x57, 0x83, 0x8F, 0xA2, 0x4D, 0x75, 0xA6, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0xC1, 0xE5, 0xB1, 0xCD, 0xDB, 0x88, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x33, 0xBC, 0x14, 0xB1, 0xD9, 0xF6, 0x04 ),
+    BYTES_TO_T_UINT_8( 0x2E, 0x88, 0xF0, 0xDD, 0x6F, 0xE3, 0xF6, 0x33 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x5C, 0x39, 0x7F, 0xAE, 0xB5, 0xAF, 0xF4, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x58, 0x0C, 0x72, 0x52, 0x52, 0xCF, 0x0E, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x52, 0x99, 0x7E, 0xDF, 0x4F, 0x1E, 0x31, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0x77, 0x89, 0x4F, 0xDF, 0xA7, 0x3A, 0x19, 0x9E ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x45, 0xD0, 0xBC, 0x7D, 0x5C, 0x71, 0x5C, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x08, 0xBE, 0xC5, 0x6A, 0x2F, 0x44, 0x2A, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x4F, 0x30, 0x1A, 0xA4, 0x37, 0xC3, 0x6F ),
+    BYTES_TO_T_UINT_8( 0x01, 0x14, 0x39, 0xDE, 0xDE, 0x31, 0x2B, 0xBE ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA8, 0x27, 0x3D, 0x4D, 0x0D, 0x39, 0x04, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x27, 0xB5, 0x70, 0x8E, 0xAB, 0x9A, 0xFC, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xDF, 0x79, 0xDF, 0xC7, 0x92, 0x73, 0x9B, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x70, 0x79, 0x66, 0x2C, 0xBE, 0xA9, 0xEB, 0x90 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xCC, 0x12, 0x6A, 0xE7, 0xC4, 0x77, 0xA2, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x4C, 0xC4, 0x3E, 0x84, 0xED, 0xBF, 0x53 ),
+    BYTES_TO_T_UINT_8( 0x86, 0x92, 0x35, 0x20, 0x11, 0x68, 0xED, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x2E, 0x01, 0x2E, 0x75, 0xA5, 0x2C, 0x1D, 0x04 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xE9, 0x76, 0x74, 0x71, 0xB2, 0x23, 0x17, 0x88 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x3F, 0x4A, 0xA6, 0x6E, 0xEF, 0xC9, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xE9, 0x41, 0xDD, 0x62, 0x6E, 0xA2, 0xF0, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x79, 0xBF, 0x4F, 0xB7, 0x8C, 0x2E, 0xD4, 0x19 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBD, 0x50, 0xD8, 0xA0, 0x2A, 0x98, 0x1D, 0x02 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x68, 0x4F, 0x68, 0x31, 0x79, 0x60, 0xAD ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xFD, 0xF6, 0xDD, 0x69, 0x4C, 0xC8, 0x17 ),
+    BYTES_TO_T_UINT_8( 0x58, 0x47, 0x3F, 0xEB, 0xF9, 0xAE, 0x3D, 0x65 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x37, 0x2B, 0x15, 0xEF, 0xAB, 0xA6, 0xEA, 0x3D ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x2D, 0x9B, 0xF6, 0xBE, 0xDA, 0x7F, 0xDE ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x4F, 0x75, 0x41, 0xB0, 0x06, 0x72, 0xDD ),
+    BYTES_TO_T_UINT_8( 0x0C, 0x18, 0xE0, 0xF9, 0xF8, 0x79, 0xC9, 0x2D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x22, 0x8D, 0x8F, 0xB9, 0x0D, 0x30, 0xA9, 0xCA ),
+    BYTES_TO_T_UINT_8( 0xEC, 0x88, 0x4F, 0xB2, 0x7B, 0xD4, 0x1D, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x93, 0x2A, 0x2A, 0xB7, 0x50, 0xFF, 0xDB, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x71, 0x52, 0x9D, 0x5D, 0xD5, 0xF0, 0x70, 0x89 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x45, 0xA3, 0x42, 0x7C, 0xCC, 0x3B, 0x8F, 0x26 ),
+    BYTES_TO_T_UINT_8( 0x24, 0x72, 0x9F, 0xDF, 0x79, 0x11, 0xCC, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0x51, 0xD0, 0xAB, 0x56, 0xCA, 0xA8, 0x9C, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x53, 0x53, 0xB9, 0x85, 0x99, 0xE5, 0xB9, 0x2F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x9A, 0x6B, 0x38, 0x31, 0x68, 0xA5, 0x32, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x4B, 0xF4, 0x22, 0x6B, 0x28, 0x5D, 0xAA, 0x5E ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x4D, 0xEC, 0xBC, 0x49, 0xAA, 0x2F, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x2C, 0xB6, 0x93, 0x30, 0x13, 0x79, 0x3D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x85, 0x63, 0xAA, 0x7C, 0x54, 0xC0, 0x1C, 0x21 ),
+    BYTES_TO_T_UINT_8( 0x94, 0x42, 0x14, 0xC3, 0xB4, 0xD9, 0x56, 0x7E ),
+    BYTES_TO_T_UINT_8( 0xB8, 0xEB, 0xD5, 0x6E, 0x13, 0x2E, 0x79, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x04, 0x84, 0xCA, 0x6E, 0xDF, 0x2F, 0x69 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x08, 0xEC, 0x47, 0xC0, 0xB8, 0xA7, 0xFA, 0x93 ),
+    BYTES_TO_T_UINT_8( 0x48, 0x4E, 0x56, 0x2A, 0x3C, 0x3A, 0xD9, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0x78, 0x40, 0x8E, 0x50, 0x58, 0x5A, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x39, 0x3C, 0x72, 0xA5, 0x40, 0xD5, 0xE8, 0x0E ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x72, 0xF6, 0x05, 0xAD, 0x0E, 0xC6, 0x5A, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x52, 0xDA, 0x2A, 0x2F, 0x01, 0x84, 0x14, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x5D, 0x93, 0xA1, 0x4F, 0x75, 0x4C, 0xFD ),
+    BYTES_TO_T_UINT_8( 0x82, 0x7C, 0x1A, 0x06, 0xD5, 0x4B, 0xAC, 0xFF ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBE, 0xB1, 0x6F, 0x1A, 0xC0, 0x81, 0x9D, 0x3E ),
+    BYTES_TO_T_UINT_8( 0xE3, 0xC8, 0x53, 0x86, 0xED, 0x03, 0xA8, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xEF, 0x49, 0x8E, 0x5A, 0x7E, 0xC6, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xAC, 0xF2, 0xB9, 0xF7, 0x25, 0x3D, 0x9B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x50, 0x0E, 0xA9, 0xA2, 0x3D, 0xA2, 0x3B, 0x31 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0x90, 0x06, 0x81, 0x7E, 0xA3, 0x09, 0x1C ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x3E, 0xB6, 0x18, 0x45, 0x03, 0xBE, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x6C, 0xF2, 0x96, 0x64, 0x08, 0xE3, 0xD4, 0x36 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xED, 0xC3, 0xEB, 0x49, 0x90, 0xD8, 0x45, 0x12 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x1A, 0xD9, 0xBF, 0x94, 0xC9, 0x98, 0x3B ),
+    BYTES_TO_T_UINT_8( 0x35, 0x8B, 0xFF, 0x64, 0x5E, 0x88, 0x5B, 0xF3 ),
+    BYTES_TO_T_UINT_8( 0xEC, 0xFF, 0x55, 0xF3, 0x48, 0x0A, 0x66, 0x96 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x99, 0xF8, 0xBB, 0x51, 0xAE, 0x9D, 0x7A, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x40, 0x36, 0x4F, 0x8B, 0x66, 0xB0, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x18, 0x6D, 0xFC, 0x8B, 0xC8, 0x13, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x07, 0x55, 0x32, 0x7D, 0xE4, 0xF3, 0x01, 0x55 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD2, 0x8D, 0x7D, 0x7B, 0x0F, 0xEB, 0xD4, 0xDD ),
+    BYTES_TO_T_UINT_8( 0xD0, 0xDF, 0x47, 0x55, 0xBE, 0xF6, 0x78, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x2E, 0x7C, 0x4C, 0x60, 0x41, 0xB5, 0x6D, 0x3A ),
+    BYTES_TO_T_UINT_8( 0x36, 0x1D, 0x2F, 0x6F, 0x6F, 0x9A, 0xCA, 0x10 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x48, 0xC8, 0xAF, 0x27, 0x35, 0xE2, 0x4D, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xD7, 0x9C, 0xE8, 0x85, 0x4F, 0x04, 0x7A, 0x7D ),
+    BYTES_TO_T_UINT_8( 0x18, 0x21, 0x53, 0xED, 0xB8, 0x42, 0x80, 0x37 ),
+    BYTES_TO_T_UINT_8( 0x9F, 0xFA, 0x51, 0x1F, 0x38, 0x9A, 0x11, 0x1D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xF6, 0xC3, 0x45, 0x25, 0x79, 0x7C, 0x95, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0x90, 0xCC, 0x59, 0xBE, 0x1B, 0xD1, 0x4D ),
+    BYTES_TO_T_UINT_8( 0x2B, 0x36, 0xAC, 0x61, 0x77, 0x60, 0x52, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x2D, 0xA7, 0xC0, 0xCD, 0xC5, 0xD0, 0x0C, 0x0D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD7, 0x47, 0x49, 0x9E, 0xC9, 0x41, 0xC8, 0x71 ),
+    BYTES_TO_T_UINT_8( 0x86, 0x76, 0x5A, 0xE0, 0x1A, 0xEA, 0xB7, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x1E, 0xDA, 0xBB, 0x88, 0x53, 0x17, 0xD5, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x6D, 0x0C, 0x11, 0xAA, 0xA9, 0x0D, 0xDD ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x2E, 0x4F, 0x5D, 0x1F, 0xE1, 0x92, 0xBD, 0x24 ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x7F, 0x3A, 0xED, 0x3D, 0xD2, 0xEE, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xAA, 0xBC, 0x21, 0x99, 0x76, 0x32, 0xEF, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x83, 0x07, 0x19, 0x6A, 0x20, 0x17, 0x1E, 0xFE ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xC1, 0x8F, 0xB3, 0xD0, 0xCA, 0xBF, 0x4B, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x85, 0x23, 0x26, 0xBD, 0x6F, 0xD5, 0x6A ),
+    BYTES_TO_T_UINT_8( 0x0D, 0xCE, 0x4D, 0xA2, 0x3F, 0xC5, 0x53, 0x14 ),
+    BYTES_TO_T_UINT_8( 0xF3, 0x13, 0x2E, 0x57, 0x8D, 0x6F, 0xD6, 0xB8 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x5B, 0xA3, 0xDB, 0x6D, 0xA9, 0x5F, 0x13, 0x55 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xFE, 0x99, 0x0C, 0xC2, 0x93, 0x47, 0x3C ),
+    BYTES_TO_T_UINT_8( 0x61, 0x53, 0xCD, 0x65, 0xED, 0x4D, 0x98, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0xFE, 0x04, 0xF8, 0x23, 0x72, 0xDF, 0xE9, 0xC1 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6F, 0x2A, 0x78, 0x34, 0x4D, 0xA4, 0x61, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x0E, 0x58, 0x8F, 0x96, 0x42, 0xB4, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x24, 0x7F, 0x67, 0xCA, 0x56, 0x24, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x73, 0x8A, 0xCD, 0x6B, 0x3F, 0x09, 0xD4, 0xF8 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xC5, 0x58, 0xC6, 0x80, 0x62, 0xF2, 0xD5, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x04, 0xA7, 0xED, 0x50, 0x57, 0xC1, 0x71 ),
+    BYTES_TO_T_UINT_8( 0xF3, 0x5F, 0x2A, 0xC9, 0x9B, 0x29, 0xF4, 0x54 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x3B, 0xFE, 0xE7, 0x03, 0x7C, 0x7D, 0x60 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x62, 0x40, 0x35, 0xE3, 0xFE, 0x84, 0xA1, 0x1E ),
+    BYTES_TO_T_UINT_8( 0xB1, 0x39, 0x5A, 0x66, 0x38, 0x62, 0x67, 0x7D ),
+    BYTES_TO_T_UINT_8( 0xB1, 0x92, 0x62, 0x70, 0x43, 0x08, 0x28, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x7F, 0xD7, 0xDA, 0x12, 0x00, 0x02, 0xFB, 0xF5 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x57, 0x67, 0xA8, 0x75, 0xF7, 0x1B, 0x10, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x80, 0x87, 0xC5, 0x1C, 0xB0, 0x34, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x2E, 0x31, 0x62, 0x8A, 0xF8, 0x80, 0xD0, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x40, 0xCB, 0x3B, 0x69, 0x7E, 0xCC, 0xD3, 0xB0 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBB, 0x47, 0x02, 0x99, 0xC1, 0xA9, 0x3B, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x05, 0x1A, 0x6F, 0x03, 0xD0, 0x7D, 0x09 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0xCD, 0xA1, 0x4B, 0x48, 0x4A, 0x8E, 0xBA ),
+    BYTES_TO_T_UINT_8( 0x47, 0xF2, 0x38, 0x7E, 0x26, 0xEB, 0xE2, 0xB8 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA8, 0x9C, 0x92, 0x3E, 0x87, 0xAE, 0xFC, 0x9C ),
+    BYTES_TO_T_UINT_8( 0x23, 0x2F, 0xBD, 0xE8, 0x1F, 0x27, 0xDA, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x7E, 0x1D, 0x96, 0xE3, 0x9F, 0x53, 0x04 ),
+    BYTES_TO_T_UINT_8( 0x2F, 0x49, 0xD3, 0x67, 0xBF, 0xE7, 0x20, 0x0A ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xC2, 0x57, 0x66, 0xAE, 0x24, 0xEA, 0x14, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x8F, 0x21, 0x9A, 0xCF, 0x0E, 0xCE, 0x9C ),
+    BYTES_TO_T_UINT_8( 0x17, 0xC3, 0x5F, 0x74, 0x8D, 0x58, 0x49, 0xA5 ),
+    BYTES_TO_T_UINT_8( 0x73, 0xFC, 0x34, 0x8F, 0x64, 0x43, 0x34, 0xB3 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xEC, 0x8B, 0x11, 0xAE, 0x84, 0xB3, 0x0B, 0xCA ),
+    BYTES_TO_T_UINT_8( 0x71, 0xC3, 0x6E, 0x2D, 0x7A, 0xFC, 0x5E, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x75, 0x7A, 0x1F, 0x93, 0x70, 0x3D, 0xCA, 0x35 ),
+    BYTES_TO_T_UINT_8( 0x93, 0x29, 0x15, 0x11, 0xEC, 0x1C, 0x2B, 0x97 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x50, 0x6B, 0x63, 0xFE, 0x14, 0xE0, 0x03, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x7D, 0xF7, 0x38, 0xBC, 0xCB, 0x9B, 0x51, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0xED, 0x81, 0xEA, 0x7B, 0x29, 0xA8, 0x75, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x60, 0x0F, 0x4B, 0xDA, 0xE5, 0x43, 0x20, 0x3F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x17, 0x67, 0x20, 0x2C, 0xAD, 0xF2, 0xB3, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x71, 0xD0, 0xAB, 0x75, 0x26, 0x2C, 0x69, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x9C, 0xC1, 0x94, 0x73, 0xDE, 0x53, 0xD1, 0xBD ),
+    BYTES_TO_T_UINT_8( 0x04, 0x57, 0x28, 0x89, 0x3B, 0xCD, 0x7B, 0x44 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x7F, 0x1E, 0x64, 0x34, 0x1D, 0x03, 0xDA, 0x78 ),
+    BYTES_TO_T_UINT_8( 0xD0, 0xC2, 0x0B, 0xA8, 0x3B, 0xE1, 0x6A, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x42, 0x19, 0x34, 0x72, 0x84, 0x64, 0x72 ),
+    BYTES_TO_T_UINT_8( 0x89, 0x4F, 0x8B, 0xD7, 0x3E, 0xCE, 0xC7, 0x57 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x22, 0x1B, 0xFC, 0xD9, 0xA4, 0x31, 0xBA, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x72, 0xB3, 0x13, 0x4C, 0xAE, 0xA1, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x45, 0x88, 0x79, 0xCC, 0x76, 0xDD, 0x34, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x73, 0x8A, 0x03, 0xBF, 0x88, 0xE3, 0xA7 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x7D, 0xBC, 0x05, 0x34, 0x4E, 0xE4, 0x24, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x41, 0x79, 0x3B, 0x5F, 0xFE, 0x86, 0x43 ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x44, 0x45, 0xF5, 0xFF, 0xC6, 0x3D, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0x80, 0x53, 0x0F, 0x31, 0x06, 0x7B, 0xCA, 0x73 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x65, 0x54, 0x0E, 0xF4, 0x01, 0x48, 0xA2, 0x90 ),
+    BYTES_TO_T_UINT_8( 0x9E, 0xB9, 0x1D, 0x5D, 0x36, 0x55, 0x5A, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x4B, 0x4E, 0xD5, 0x3B, 0x71, 0xA4, 0x76, 0x25 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x8E, 0xF7, 0xD2, 0x14, 0xCF, 0x7D, 0xE8 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x79, 0xFB, 0xDA, 0x66, 0x3D, 0x8D, 0x27, 0x31 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xC8, 0x91, 0x90, 0x12, 0xCF, 0x42, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0xB2, 0xB5, 0x84, 0xB3, 0xD2, 0xC2, 0x55 ),
+    BYTES_TO_T_UINT_8( 0xE1, 0x9F, 0x57, 0xAB, 0xE6, 0xCE, 0xD5, 0x52 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD1, 0x85, 0x65, 0x6D, 0xD4, 0xFF, 0xA8, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x72, 0xA1, 0xAF, 0xAB, 0x28, 0xE1, 0x49, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0x71, 0xD9, 0x78, 0xDE, 0x3A, 0x5B, 0x8F ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x62, 0x28, 0x0C, 0x7C, 0x16, 0x70, 0x9C ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xEC, 0x4A, 0x58, 0xE2, 0x42, 0x69, 0x63, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x4E, 0xDD, 0xC5, 0x93, 0x1F, 0xAA, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x4B, 0x17, 0x2D, 0x23, 0x87, 0xFA, 0x5B ),
+    BYTES_TO_T_UINT_8( 0xE4, 0x96, 0x2A, 0x52, 0x36, 0x6D, 0xCE, 0x64 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x29, 0xA7, 0x85, 0xD3, 0x3C, 0x55, 0x71, 0x61 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0xC6, 0x64, 0x51, 0xA5, 0x2D, 0xF9, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x5C, 0x4A, 0x14, 0x39, 0xE4, 0xD0, 0xFB ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x76, 0x15, 0x29, 0x7A, 0xF2, 0x44, 0x97 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD1, 0x5E, 0x95, 0x5D, 0x18, 0x63, 0x7C, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x6B, 0x23, 0xCE, 0x3A, 0x11, 0x77, 0x53 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x09, 0xF9, 0x2C, 0x8D, 0x34, 0x19, 0x9B ),
+    BYTES_TO_T_UINT_8( 0x8E, 0xC1, 0x5E, 0x4F, 0xDD, 0x0C, 0x52, 0x71 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x5D, 0xBB, 0xB3, 0xD1, 0x75, 0x1E, 0x26, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x10, 0xDF, 0xDB, 0x8D, 0xFE, 0x27, 0x06, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x32, 0x7E, 0xA5, 0x18, 0xC3, 0x7A, 0x19, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x6C, 0x32, 0x2D, 0xD8, 0x36, 0xE6, 0xFC ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x61, 0x00, 0xA4, 0x2E, 0x2A, 0xC1, 0x4A, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0x18, 0xF3, 0x12, 0x85, 0xD8, 0xFA, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0x05, 0x7D, 0x4F, 0xEE, 0xAF, 0x8B, 0xEA ),
+    BYTES_TO_T_UINT_8( 0xA6, 0x5B, 0xCD, 0x76, 0x14, 0xB7, 0x33, 0xF4 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x80, 0x2E, 0x70, 0x7D, 0xC7, 0x5C, 0x5E, 0xEC ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x02, 0xEF, 0xA8, 0xC5, 0xEF, 0x0E, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x7B, 0xF0, 0x64, 0xAC, 0x55, 0x84, 0xFC ),
+    BYTES_TO_T_UINT_8( 0x54, 0xA2, 0x40, 0x8C, 0x26, 0xD8, 0xE1, 0x49 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x1E, 0x9D, 0x87, 0xA0, 0xE2, 0x6A, 0x57, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x98, 0xC0, 0x5E, 0xA2, 0xDA, 0x52, 0x4E, 0xEC ),
+    BYTES_TO_T_UINT_8( 0x80, 0x6E, 0xDB, 0x9A, 0xDD, 0xD3, 0xCE, 0xBB ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x08, 0xC4, 0x23, 0xA2, 0xDF, 0x41, 0xBD ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x1B, 0x68, 0xF0, 0x30, 0x6B, 0x87, 0x8B, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x43, 0x35, 0x76, 0x1B, 0xE9, 0x5A, 0x63, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x2C, 0xC1, 0x25, 0xC1, 0x05, 0x86, 0x6C, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0x11, 0xEA, 0xA1, 0xBC, 0x70, 0x10, 0xCD, 0x90 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x70, 0x74, 0x41, 0x32, 0xB8, 0xCD, 0xAD, 0xBB ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x27, 0xF5, 0x67, 0x5A, 0x18, 0xDD, 0x0C ),
+    BYTES_TO_T_UINT_8( 0x54, 0x00, 0xB5, 0xA5, 0xBF, 0x72, 0xF9, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x19, 0xEE, 0x5B, 0x87, 0xE9, 0x06, 0x60 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x29, 0xFF, 0xB1, 0x58, 0x6E, 0xC4, 0xC6, 0x92 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x50, 0xB0, 0x05, 0x89, 0xD9, 0x30, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x69, 0x02, 0x9A, 0x3A, 0x2B, 0xB8, 0x8C, 0x26 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0xDD, 0x43, 0x07, 0xD4, 0xF1, 0x20, 0xCB ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x55, 0x9A, 0x8F, 0xF1, 0x4A, 0x22, 0x44, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x29, 0x2B, 0xC7, 0xBF, 0x32, 0x6E, 0x03 ),
+    BYTES_TO_T_UINT_8( 0x8E, 0x8E, 0x89, 0x56, 0xE2, 0x32, 0xB0, 0x35 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xE0, 0xAE, 0xBB, 0xDF, 0x17, 0x3C, 0x6C ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x2C, 0x9D, 0xA9, 0x12, 0xAE, 0xFC, 0x38, 0x57 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0xEF, 0xA6, 0xF9, 0x45, 0xF6, 0xCB, 0x4D ),
+    BYTES_TO_T_UINT_8( 0x26, 0xF1, 0x52, 0xE4, 0xEB, 0xD4, 0x3D, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x10, 0xF1, 0xD2, 0x1B, 0xCF, 0xB8, 0x2C, 0x46 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xF6, 0xCB, 0x85, 0xDF, 0x15, 0xB2, 0xFD, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x59, 0xD9, 0x4C, 0xF2, 0xC5, 0x7F, 0x23, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0xA5, 0x20, 0x57, 0x41, 0x8F, 0x15, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xA0, 0x70, 0xA2, 0x7B, 0xFA, 0x68, 0xC7, 0xC5 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x16, 0x6A, 0x8C, 0x7F, 0xC7, 0x93, 0x3B, 0xBE ),
+    BYTES_TO_T_UINT_8( 0x97, 0xEB, 0x7E, 0x1E, 0x1C, 0x69, 0x11, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x43, 0xC1, 0x31, 0xF8, 0xA7, 0x62, 0x06, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x54, 0xAD, 0x4B, 0x28, 0xB1, 0xD5, 0xA8 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB3, 0x00, 0xE9, 0x26, 0xC2, 0xD4, 0xE1, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0xB6, 0x31, 0x02, 0x2E, 0x48, 0x58, 0x8F ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x2F, 0x3C, 0x0B, 0x7B, 0x73, 0x6F, 0xFF ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x20, 0xF5, 0x1A, 0xBA, 0xDE, 0x92, 0x35 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x96, 0x00, 0xC6, 0x48, 0x15, 0x3B, 0x9A, 0x92 ),
+    BYTES_TO_T_UINT_8( 0x04, 0xF6, 0xD1, 0x1E, 0x45, 0x28, 0x5E, 0x3A ),
+    BYTES_TO_T_UINT_8( 0xA7, 0x9E, 0x88, 0xF6, 0x3E, 0x71, 0x6A, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x79, 0xB5, 0xE7, 0x57, 0x40, 0x54, 0x44 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x24, 0xA5, 0xDC, 0x4C, 0x8C, 0x0F, 0x13, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0xC0, 0xE8, 0xAA, 0x6C, 0xC9, 0xD1, 0x41 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x3D, 0x03, 0xA6, 0x5D, 0x41, 0x1F, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xD3, 0xDB, 0xE7, 0x5A, 0x0B, 0x94, 0xD2, 0xFC ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6A, 0x65, 0xB3, 0x35, 0x76, 0x02, 0x3F, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x10, 0x9A, 0xBC, 0xE6, 0xC7, 0x0C, 0x63, 0x74 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0xAD, 0x32, 0xB9, 0xC5, 0x25, 0x23, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0x70, 0x07, 0x42, 0xD9, 0x31, 0x2F, 0xD8 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x8C, 0xE0, 0xEC, 0xA5, 0x4B, 0xDF, 0xB4, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x4A, 0xAA, 0xF2, 0x32, 0x1E, 0xB5, 0xB3, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0x9A, 0x24, 0x17, 0x08, 0x34, 0x3A, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x40, 0xFD, 0xE6, 0xA1, 0x3A, 0x16, 0x8F, 0x03 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB7, 0x49, 0x19, 0x5A, 0x68, 0x83, 0x21, 0x42 ),
+    BYTES_TO_T_UINT_8( 0x56, 0x2C, 0xA8, 0xFF, 0x8E, 0xF7, 0x74, 0xBF ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xDB, 0x45, 0x45, 0xAE, 0x3F, 0xD6, 0x57 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0xF9, 0x0C, 0x6B, 0x92, 0x58, 0xCF, 0xF1 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x01, 0x7C, 0x08, 0x26, 0x34, 0xAD, 0xA0, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x0F, 0x93, 0x0C, 0xFE, 0xD1, 0xE4, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x28, 0x63, 0xF7, 0x72, 0x05, 0xE6, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x7F, 0x66, 0xA3, 0xBA, 0x06, 0x9E, 0x93 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xCB, 0x0E, 0xD8, 0x78, 0xA0, 0x1C, 0xCF, 0x95 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x27, 0x11, 0xD1, 0x59, 0x1D, 0xEA, 0x27 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x0F, 0x30, 0x99, 0x5A, 0x9C, 0xC8, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0xD5, 0xB3, 0x02, 0xE0, 0x00, 0x9E, 0xA9 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x72, 0xC0, 0xE7, 0x84, 0xFE, 0x66, 0xE7, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0xAB, 0x72, 0xBF, 0x67, 0x4F, 0x5F, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x7D, 0x09, 0x33, 0xFB, 0x7D, 0x05, 0x29, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x85, 0x83, 0x58, 0x24, 0xE7, 0x79, 0xF3, 0xDF ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xEF, 0x70, 0xA3, 0xA8, 0x40, 0x60, 0x22, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x95, 0x8B, 0x7A, 0xEC, 0x4C, 0x10, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0x79, 0x44, 0x12, 0x97, 0x5F, 0xCF, 0xB4, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x99, 0xD4, 0xCF, 0x73, 0x9C, 0x46, 0x0B, 0xCE ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x7B, 0xE0, 0x33, 0xE4, 0xC8, 0x56, 0x10, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x72, 0xE6, 0xD6, 0xA1, 0x9C, 0x37, 0xA6, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0x1D, 0x81, 0x45, 0xEA, 0xFC, 0x21, 0x99 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0x10, 0xDB, 0xE2, 0x13, 0x7E, 0x99, 0x23 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x33, 0x71, 0xB7, 0x57, 0xD4, 0x87, 0x68, 0x3C ),
+    BYTES_TO_T_UINT_8( 0x43, 0xF7, 0x24, 0x13, 0xC3, 0x26, 0xC7, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x49, 0x6B, 0x41, 0xB4, 0x60, 0x2B, 0xE0, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0xD4, 0x51, 0xF4, 0xE8, 0xCC, 0x9E, 0xAD ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x68, 0xF7, 0x9A, 0x4D, 0xAF, 0x52, 0x8D, 0x7D ),
+    BYTES_TO_T_UINT_8( 0x82, 0x64, 0x62, 0x33, 0x4C, 0x62, 0x1B, 0x12 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0xA7, 0x05, 0x1F, 0x13, 0xCE, 0xBA, 0xBF ),
+    BYTES_TO_T_UINT_8( 0xF6, 0x13, 0x15, 0x08, 0x1E, 0xDB, 0x8C, 0x4C ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x18, 0x70, 0x5E, 0x4B, 0x89, 0x5C, 0x18, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x4C, 0x6C, 0x03, 0xF8, 0x6E, 0xD5, 0x41 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0xA6, 0xF6, 0xB9, 0xBD, 0xF0, 0x78, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x35, 0x1D, 0x1E, 0xBF, 0xE4, 0x4F, 0x39, 0x81 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x27, 0xA8, 0x3C, 0x31, 0x88, 0x64, 0xEB, 0x39 ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x97, 0xB3, 0x89, 0x6D, 0x54, 0x42, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x2C, 0x92, 0x0C, 0xAB, 0x02, 0x0B, 0xA5 ),
+    BYTES_TO_T_UINT_8( 0xC0, 0x67, 0x10, 0x60, 0xCA, 0xE7, 0xC0, 0x46 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x65, 0x06, 0xA6, 0xD5, 0x8A, 0xC3, 0x17, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0xA6, 0x8E, 0xE8, 0x75, 0x05, 0x7B, 0x46, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0xF8, 0x75, 0x78, 0x6F, 0x0F, 0x0D, 0xF3, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x01, 0x26, 0xD5, 0xD4, 0x86, 0x92, 0x50, 0x6C ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xF0, 0x45, 0x2E, 0x1F, 0x7C, 0xFB, 0xA5, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x39, 0x17, 0x40, 0x13, 0x6B, 0x9A, 0xF4, 0x5F ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x69, 0xFA, 0x87, 0xBB, 0x26, 0x4C, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x99, 0xCC, 0x6A, 0x6B, 0xCB, 0xAC, 0x4E, 0x21 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xCF, 0x1B, 0x5F, 0x92, 0x86, 0x27, 0xC0, 0x99 ),
+    BYTES_TO_T_UINT_8( 0x7F, 0x19, 0xE1, 0x5B, 0xF3, 0x91, 0x4F, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x40, 0x74, 0x64, 0x65, 0x77, 0x53, 0x0A, 0x4D ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x8B, 0x5A, 0x22, 0xEE, 0x7B, 0x91, 0xF4 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xC2, 0x67, 0x97, 0x75, 0x6B, 0x5A, 0x75, 0xFA ),
+    BYTES_TO_T_UINT_8( 0x04, 0x48, 0x6F, 0xD4, 0x12, 0x78, 0xFF, 0x74 ),
+    BYTES_TO_T_UINT_8( 0xD4, 0xDF, 0xEE, 0xCD, 0xC7, 0x40, 0x11, 0x95 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0xF1, 0x80, 0x93, 0x98, 0xE5, 0x00, 0x6D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x79, 0x67, 0xB7, 0x0B, 0x70, 0xA3, 0x20, 0x1A ),
+    BYTES_TO_T_UINT_8( 0xED, 0x78, 0x69, 0x30, 0xE1, 0xE0, 0x1C, 0x11 ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x22, 0xC0, 0x4A, 0x97, 0x80, 0x94, 0x75 ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x5C, 0x65, 0x43, 0x1B, 0xF9, 0x45, 0xB6 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB0, 0x92, 0xCD, 0x12, 0x9F, 0x53, 0xCF, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x38, 0x73, 0x75, 0x3A, 0x37, 0xA9, 0x37, 0x21 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0xE9, 0x6A, 0xE3, 0xA2, 0x61, 0xD4, 0xEA ),
+    BYTES_TO_T_UINT_8( 0x0E, 0x53, 0xCF, 0x12, 0xDA, 0x01, 0xA1, 0xE1 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x04, 0x8B, 0x52, 0xCD, 0x9A, 0xBC, 0xDE, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0x69, 0x65, 0x78, 0x1B, 0xB8, 0x31, 0x5F, 0x62 ),
+    BYTES_TO_T_UINT_8( 0x4D, 0x2B, 0xA4, 0x9F, 0x67, 0x79, 0x31, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x0D, 0x9B, 0xBC, 0xAE, 0xAB, 0xC4, 0xDD, 0xC7 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x38, 0xBC, 0x3C, 0xB5, 0xE7, 0x18, 0x59, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x0E, 0x55, 0xD2, 0xCC, 0xDD, 0x18, 0xC5, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x73, 0xAA, 0xE5, 0xCB, 0x7C, 0xF4, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x17, 0x8E, 0xC2, 0xDE, 0xD8, 0x00, 0xF3 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x8D, 0x5C, 0xC9, 0xD5, 0x64, 0x07, 0x5C, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x03, 0xDA, 0x21, 0x17, 0x21, 0x88, 0x1F, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x99, 0x07, 0x76, 0xB9, 0x19, 0xCD, 0x9E, 0x4E ),
+    BYTES_TO_T_UINT_8( 0x31, 0x54, 0x5E, 0x46, 0xD8, 0x4A, 0xB9, 0x06 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xE0, 0x72, 0xEA, 0x1B, 0xDF, 0x4D, 0x76, 0xEE ),
+    BYTES_TO_T_UINT_8( 0xE1, 0xAE, 0x11, 0xB2, 0xD1, 0x2B, 0x46, 0x36 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0xFB, 0x36, 0x2F, 0x52, 0x7A, 0x6D, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x7F, 0x2E, 0x65, 0x60, 0xF6, 0x55, 0xF7 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x94, 0x90, 0x76, 0x2E, 0x57, 0x6C, 0xAD, 0x51 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0x0F, 0xB2, 0x28, 0x8F, 0x63, 0x90, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x8D, 0xB6, 0xB9, 0x89, 0xF5, 0xBA, 0x5F, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0x39, 0xF7, 0x05, 0x74, 0xC1, 0x4F, 0xBB, 0x31 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x7E, 0x05, 0x6F, 0x68, 0x61, 0x74, 0x15, 0xAA ),
+    BYTES_TO_T_UINT_8( 0xDF, 0x6A, 0xE1, 0x4A, 0xB5, 0xA8, 0x10, 0x3B ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x5F, 0x60, 0x07, 0xB1, 0x83, 0xE9, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x39, 0x41, 0x8D, 0x08, 0x3E, 0xB1, 0xE3 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA8, 0x42, 0xD9, 0xA2, 0x48, 0x76, 0x83, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x50, 0xBE, 0x2A, 0xA2, 0x3F, 0xFA, 0xE0, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x71, 0x89, 0x3F, 0x7B, 0xA9, 0xB2, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x18, 0x63, 0xC7, 0xC6, 0x07, 0xFB, 0x6B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x8F, 0x6C, 0x68, 0xB1, 0xC6, 0x95, 0x58, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0xF0, 0x79, 0x52, 0x6C, 0x32, 0x14, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0xC4, 0x51, 0x70, 0x41, 0x51, 0xE7, 0x76 ),
+    BYTES_TO_T_UINT_8( 0x22, 0x50, 0xF2, 0x13, 0x36, 0x8A, 0x9C, 0xE6 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x78, 0x36, 0x05, 0x18, 0xB0, 0xE4, 0xBB, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x86, 0xF7, 0x26, 0xF4, 0x10, 0x7C, 0x29, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xF3, 0x1E, 0xEA, 0x38, 0xA2, 0x1F, 0x84, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x22, 0x40, 0xB3, 0x4B, 0xB4, 0x6C, 0x1B, 0xAC ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x23, 0xE1, 0x18, 0x46, 0x9F, 0xF0, 0x59, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x93, 0xF1, 0x6B, 0xA6, 0x92, 0x51, 0x57, 0x62 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xD7, 0xF6, 0x9A, 0x79, 0xCF, 0x29, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0xFB, 0x66, 0x4B, 0x1A, 0xED, 0x19, 0xB8, 0xCA ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD6, 0xB1, 0xA1, 0x1D, 0x2E, 0x8B, 0xD8, 0xCB ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x1E, 0x7B, 0xC2, 0x4B, 0xD2, 0x87, 0x7B ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x0B, 0x3B, 0x0C, 0x98, 0x43, 0x77, 0x3D ),
+    BYTES_TO_T_UINT_8( 0x31, 0x77, 0x6A, 0xF8, 0x0A, 0xD0, 0x10, 0x69 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xAC, 0x50, 0x8A, 0xDD, 0xBC, 0xC0, 0x22, 0xAB ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xB8, 0xD5, 0x86, 0x11, 0x16, 0x11, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0x2D, 0x44, 0xFB, 0xCC, 0xB2, 0x16, 0x8E, 0x99 ),
+    BYTES_TO_T_UINT_8( 0x72, 0xA7, 0x29, 0x1F, 0x3C, 0x6A, 0xE4, 0x45 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB7, 0xBC, 0x16, 0x2D, 0x0D, 0x24, 0x58, 0x7A ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x06, 0x54, 0x73, 0xC3, 0x9F, 0x91, 0x1E ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x2D, 0xF4, 0x66, 0xFE, 0xF8, 0xF9, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0xBD, 0x32, 0x9A, 0x26, 0xDF, 0xB9, 0x8B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x1E, 0x70, 0xE5, 0x2E, 0x2E, 0xB3, 0xCE, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x2A, 0x6D, 0x3E, 0xFC, 0x63, 0x1C, 0x0B ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x11, 0x41, 0xA8, 0x7B, 0xBF, 0x9A, 0x91 ),
+    BYTES_TO_T_UINT_8( 0x63, 0x0C, 0xB2, 0x45, 0x20, 0x63, 0xC1, 0x1F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x1C, 0xC8, 0xAD, 0x70, 0x80, 0x09, 0xD2, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x85, 0x65, 0x0A, 0x96, 0xA7, 0xDD, 0xB2, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x4D, 0x7B, 0x2E, 0x83, 0x3C, 0x18, 0xDD ),
+    BYTES_TO_T_UINT_8( 0x88, 0x4C, 0x66, 0xA4, 0x4F, 0x14, 0x56, 0xF6 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x2B, 0x24, 0x99, 0x4E, 0x86, 0x8D, 0xDD, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x46, 0xDD, 0xE0, 0x78, 0x9D, 0xEE, 0x9D, 0x9C ),
+    BYTES_TO_T_UINT_8( 0x73, 0x00, 0x76, 0x66, 0x36, 0x94, 0xA7, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x38, 0xD6, 0x20, 0xB8, 0x38, 0x7E, 0xE9 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x1A, 0x15, 0xFB, 0xC6, 0x0E, 0x0C, 0xD3, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xB9, 0x1A, 0x97, 0x48, 0x5E, 0x9F, 0x44 ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x22, 0x3D, 0xE8, 0x05, 0x84, 0x74, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x75, 0xA2, 0x4C, 0xB2, 0x79, 0xB3, 0x62, 0x91 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x36, 0xFD, 0x19, 0x4B, 0x39, 0x31, 0x27, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0x01, 0x2A, 0xA8, 0xBD, 0xB6, 0xC4, 0x0C, 0x07 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x7B, 0x74, 0xC9, 0x9A, 0xEB, 0x9F, 0x66 ),
+    BYTES_TO_T_UINT_8( 0xC0, 0x91, 0x9F, 0xAB, 0x67, 0x69, 0x3A, 0x72 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x53, 0xF5, 0x3C, 0xB3, 0x7D, 0xF8, 0x2C, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x7C, 0xC2, 0xB4, 0xA6, 0xDA, 0xAD, 0x0C, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0xEC, 0x0D, 0x5E, 0xE9, 0x87, 0xB8, 0x34, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0xCE, 0x82, 0xBD, 0x57, 0x41, 0x07, 0xA2 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xFA, 0xB7, 0x47, 0xE2, 0x24, 0x6D, 0xC9, 0xF3 ),
+    BYTES_TO_T_UINT_8( 0x2E, 0xCB, 0x7D, 0xFD, 0x64, 0xFB, 0xF4, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x6E, 0x28, 0x7D, 0x3E, 0x3A, 0xBA, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x19, 0xA9, 0x91, 0xF2, 0x8D, 0x27, 0x2A ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x03, 0xD4, 0x25, 0x9B, 0xA8, 0x40, 0xC3, 0x6A ),
+    BYTES_TO_T_UINT_8( 0x6E, 0xF3, 0x72, 0x04, 0xF6, 0xCE, 0x2F, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0x04, 0xEA, 0xFA, 0xDC, 0xCD, 0x37, 0x06, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0x1A, 0x17, 0x12, 0x79, 0x97, 0xFE, 0x07, 0xA3 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6F, 0x39, 0xCD, 0x2F, 0x73, 0x5A, 0x97, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0x79, 0x99, 0x01, 0xA9, 0x67, 0x16, 0x5E, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x92, 0x6A, 0x73, 0x0E, 0x94, 0x49, 0xE8, 0x7B ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x89, 0xC9, 0x86, 0x13, 0x81, 0xAC, 0xD5 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6F, 0x6E, 0xDE, 0xA9, 0xCC, 0xE5, 0x4A, 0xE9 ),
+    BYTES_TO_T_UINT_8( 0x2B, 0x00, 0x2C, 0xE0, 0x30, 0xC5, 0x09, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0x0C, 0xBF, 0xD0, 0x85, 0x3A, 0x61, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x6A, 0x05, 0xB5, 0x49, 0xA0, 0xB3, 0xBB, 0x07 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x89, 0xC2, 0xC0, 0x1C, 0xDC, 0x4B, 0x38, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x94, 0x64, 0x77, 0x51, 0xAD, 0x08, 0x7E, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0x51, 0x0F, 0x9C, 0x97, 0x98, 0xB5, 0x44, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x90, 0x2D, 0x12, 0x24, 0x40, 0x40, 0x20 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA3, 0xC9, 0x03, 0xF3, 0x7D, 0xF2, 0x2E, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x4E, 0x52, 0xD7, 0x3D, 0xC2, 0x11, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x48, 0x98, 0x1E, 0x6C, 0xC2, 0xCE, 0x02, 0x5E ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x3F, 0x45, 0x60, 0x1F, 0x29, 0x32, 0xD0 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD9, 0x66, 0x62, 0x8B, 0x55, 0xDE, 0xE2, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x0E, 0xCF, 0x2B, 0x5D, 0x23, 0xE4, 0xFB, 0x36 ),
+    BYTES_TO_T_UINT_8( 0xD4, 0x76, 0x99, 0xA7, 0x29, 0x0F, 0x82, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0x08, 0x08, 0xE3, 0xF6, 0x9E, 0x11, 0xDA, 0x9E ),
+  },
+};
+
+static const mbedtls_ecp_point secp256r1_comb_T[64] = {
+    COMB_POINT( secp256r1_comb, 0 ),
+    COMB_POINT( secp256r1_comb, 1 ),
+    COMB_POINT( secp256r1_comb, 2 ),
+    COMB_POINT( secp256r1_comb, 3 ),
+    COMB_POINT( secp256r1_comb, 4 ),
+    COMB_POINT( secp256r1_comb, 5 ),
+    COMB_POINT( secp256r1_comb, 6 ),
+    COMB_POINT( secp256r1_comb, 7 ),
+    COMB_POINT( secp256r1_comb, 8 ),
+    COMB_POINT( secp256r1_comb, 9 ),
+    COMB_POINT( secp256r1_comb, 10 ),
+    COMB_POINT( secp256r1_comb, 11 ),
+    COMB_POINT( secp256r1_comb, 12 ),
+    COMB_POINT( secp256r1_comb, 13 ),
+    COMB_POINT( secp256r1_comb, 14 ),
+    COMB_POINT( secp256r1_comb, 15 ),
+    COMB_POINT( secp256r1_comb, 16 ),
+    COMB_POINT( secp256r1_comb, 17 ),
+    COMB_POINT( secp256r1_comb, 18 ),
+    COMB_POINT( secp256r1_comb, 19 ),
+    COMB_POINT( secp256r1_comb, 20 ),
+    COMB_POINT( secp256r1_comb, 21 ),
+    COMB_POINT( secp256r1_comb, 22 ),
+    COMB_POINT( secp256r1_comb, 23 ),
+    COMB_POINT( secp256r1_comb, 24 ),
+    COMB_POINT( secp256r1_comb, 25 ),
+    COMB_POINT( secp256r1_comb, 26 ),
+    COMB_POINT( secp256r1_comb, 27 ),
+    COMB_POINT( secp256r1_comb, 28 ),
+    COMB_POINT( secp256r1_comb, 29 ),
+    COMB_POINT( secp256r1_comb, 30 ),
+    COMB_POINT( secp256r1_comb, 31 ),
+    COMB_POINT( secp256r1_comb, 32 ),
+    COMB_POINT( secp256r1_comb, 33 ),
+    COMB_POINT( secp256r1_comb, 34 ),
+    COMB_POINT( secp256r1_comb, 35 ),
+    COMB_POINT( secp256r1_comb, 36 ),
+    COMB_POINT( secp256r1_comb, 37 ),
+    COMB_POINT( secp256r1_comb, 38 ),
+    COMB_POINT( secp256r1_comb, 39 ),
+    COMB_POINT( secp256r1_comb, 40 ),
+    COMB_POINT( secp256r1_comb, 41 ),
+    COMB_POINT( secp256r1_comb, 42 ),
+    COMB_POINT( secp256r1_comb, 43 ),
+    COMB_POINT( secp256r1_comb, 44 ),
+    COMB_POINT( secp256r1_comb, 45 ),
+    COMB_POINT( secp256r1_comb, 46 ),
+    COMB_POINT( secp256r1_comb, 47 ),
+    COMB_POINT( secp256r1_comb, 48 ),
+    COMB_POINT( secp256r1_comb, 49 ),
+    COMB_POINT( secp256r1_comb, 50 ),
+    COMB_POINT( secp256r1_comb, 51 ),
+    COMB_POINT( secp256r1_comb, 52 ),
+    COMB_POINT( secp256r1_comb, 53 ),
+    COMB_POINT( secp256r1_comb, 54 ),
+    COMB_POINT( secp256r1_comb, 55 ),
+    COMB_POINT( secp256r1_comb, 56 ),
+    COMB_POINT( secp256r1_comb, 57 ),
+    COMB_POINT( secp256r1_comb, 58 ),
+    COMB_POINT( secp256r1_comb, 59 ),
+    COMB_POINT( secp256r1_comb, 60 ),
+    COMB_POINT( secp256r1_comb, 61 ),
+    COMB_POINT( secp256r1_comb, 62 ),
+    COMB_POINT( secp256r1_comb, 63 ),
+};
+#endif /* MBEDTLS_ECP_DP_SECP256R1_ENABLED */
+
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+/* w = 6, d = 64: 32 points */
+#define SECP384R1_COMB_W    6
+static const mbedtls_mpi_uint secp384r1_comb[64][COMB_LIMBS( 384 )] = {
+  {
+    BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E ),
+    BYTES_TO_T_UINT_8( 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A ),
+    BYTES_TO_T_UINT_8( 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x46, 0x92, 0x00, 0x2C, 0x78, 0xDB, 0x1F, 0x37 ),
+    BYTES_TO_T_UINT_8( 0x17, 0xF3, 0xEB, 0xB7, 0x06, 0xF7, 0xB6, 0xBC ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xBC, 0x2C, 0xCF, 0xD8, 0xED, 0x53, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x52, 0x75, 0x7B, 0xA3, 0xAB, 0xC3, 0x2C, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0x9D, 0x78, 0x41, 0xF6, 0x76, 0x84, 0xAC ),
+    BYTES_TO_T_UINT_8( 0x54, 0x56, 0xE8, 0x52, 0xB3, 0xCB, 0xA8, 0xBD ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6D, 0xF2, 0xAE, 0xA4, 0xB6, 0x89, 0x1B, 0xDA ),
+    BYTES_TO_T_UINT_8( 0x01, 0x0F, 0xCE, 0x1C, 0x7C, 0xF6, 0x50, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x4C, 0xEB, 0x90, 0xE6, 0x4D, 0xC7, 0xD4, 0x7A ),
+    BYTES_TO_T_UINT_8( 0xD1, 0x49, 0x2D, 0x8A, 0x01, 0x99, 0x60, 0x94 ),
+    BYTES_TO_T_UINT_8( 0x5F, 0x80, 0x9B, 0x9B, 0x6A, 0xB0, 0x07, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0xA2, 0xEE, 0x59, 0xBE, 0x95, 0xBC, 0x23 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xE6, 0x9D, 0x56, 0xAE, 0x59, 0xFB, 0x1F, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xCF, 0xAC, 0x91, 0x80, 0x87, 0xA8, 0x6E, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x08, 0xA7, 0x08, 0x94, 0x32, 0xFC, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x9F, 0x29, 0x9E, 0x84, 0xF4, 0xE5, 0x6E, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x55, 0x21, 0xB9, 0x50, 0x24, 0xF8, 0x9C, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x04, 0x01, 0xC2, 0xFB, 0x77, 0x3E, 0xDE ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x00, 0x38, 0xEE, 0xE3, 0xC7, 0x9D, 0xEC, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x88, 0xCF, 0x43, 0xFA, 0x92, 0x5E, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xE9, 0xCA, 0x43, 0xF8, 0x3B, 0x49, 0x7E, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0xE7, 0xEB, 0x17, 0x45, 0x86, 0xC2, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x92, 0x69, 0x57, 0x32, 0xE0, 0x9C, 0xD1, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x10, 0xB8, 0x4D, 0xB8, 0xF4, 0x0D, 0xE3 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x60, 0xDC, 0x9A, 0xB2, 0x79, 0x39, 0x27, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x71, 0xE4, 0x3B, 0x4D, 0x60, 0x0C, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xBD, 0x19, 0x40, 0xFA, 0x19, 0x2A, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x4D, 0xF8, 0x1E, 0x43, 0xA1, 0x50, 0x8D, 0xEF ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x18, 0x7C, 0x41, 0xFA, 0x7C, 0x1B, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x59, 0x24, 0xC4, 0xE9, 0xB7, 0xD3, 0xAD ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBB, 0x01, 0x3D, 0x63, 0x54, 0x45, 0x6F, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0xB2, 0x19, 0xA3, 0x86, 0x1D, 0x42, 0x34 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x02, 0x87, 0x18, 0x92, 0x52, 0x1A, 0x71 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x18, 0xB1, 0x5D, 0x18, 0x1B, 0x37, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x74, 0x61, 0xBA, 0x18, 0xAF, 0x40, 0x30 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x7D, 0x3C, 0x52, 0x0F, 0x07, 0xB0, 0x6F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x09, 0x39, 0x13, 0xAA, 0x60, 0x15, 0x99, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x00, 0xCB, 0xC6, 0xB1, 0xDB, 0x97, 0x90 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xFA, 0x60, 0xB8, 0x24, 0xE4, 0x7D, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x75, 0xB3, 0x70, 0xB2, 0x83, 0xB1, 0x9B ),
+    BYTES_TO_T_UINT_8( 0xA3, 0xE3, 0x6C, 0xCD, 0x33, 0x62, 0x7A, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x88, 0x30, 0xDC, 0x0F, 0x9F, 0xBB, 0xB8, 0xAA ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA6, 0xD5, 0x0A, 0x60, 0x81, 0xB9, 0xC5, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x44, 0xAA, 0x2F, 0xD6, 0xF2, 0x73, 0xDF, 0xEB ),
+    BYTES_TO_T_UINT_8( 0xF3, 0x7B, 0x74, 0xC9, 0xB3, 0x5B, 0x95, 0x6D ),
+    BYTES_TO_T_UINT_8( 0xAC, 0x04, 0xEB, 0x15, 0xC8, 0x5F, 0x00, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x50, 0x20, 0x28, 0xD1, 0x01, 0xAF, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0x28, 0x6D, 0x4F, 0x31, 0x81, 0x2F, 0x94, 0x48 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x46, 0x2F, 0xD8, 0xB6, 0x63, 0x7C, 0xE9, 0x50 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x8C, 0xB9, 0x14, 0xD9, 0x37, 0x63, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x10, 0x02, 0xB8, 0x46, 0xAD, 0xCE, 0x7B, 0x38 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x47, 0x2D, 0x66, 0xA7, 0xE9, 0x33, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x92, 0xF9, 0x93, 0x94, 0xA8, 0x48, 0xB3, 0x4F ),
+    BYTES_TO_T_UINT_8( 0xE9, 0x4A, 0xAC, 0x51, 0x08, 0x72, 0x2F, 0x1A ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xDA, 0xAD, 0xA0, 0xF9, 0x81, 0xE1, 0x78, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0x9A, 0x63, 0xD8, 0xBA, 0x79, 0x1A, 0x17 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x31, 0x7B, 0x7A, 0x5A, 0x5D, 0x7D, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x83, 0x96, 0x12, 0x4B, 0x19, 0x09, 0xE0, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x55, 0x8A, 0x57, 0xEE, 0x4E, 0x6E, 0x7E, 0xEC ),
+    BYTES_TO_T_UINT_8( 0x11, 0x9D, 0x69, 0xDC, 0xB3, 0xDA, 0xD8, 0x08 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x68, 0x49, 0x03, 0x03, 0x33, 0x6F, 0x28, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xDB, 0xA7, 0x05, 0x8C, 0xF3, 0x4D, 0xFB ),
+    BYTES_TO_T_UINT_8( 0x8E, 0x92, 0xB1, 0xA8, 0xEC, 0x0D, 0x64, 0x3B ),
+    BYTES_TO_T_UINT_8( 0x4E, 0xFC, 0xFD, 0xD0, 0x4B, 0x88, 0x1B, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x83, 0x9C, 0x51, 0x69, 0xCE, 0x71, 0x73, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x5A, 0x14, 0x23, 0x1A, 0x46, 0x63, 0x5F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBC, 0x4C, 0x70, 0x44, 0x18, 0xCD, 0xEF, 0xED ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x49, 0xDD, 0x64, 0x7E, 0x7E, 0x4D, 0x92 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0x32, 0x7C, 0x09, 0xD0, 0x3F, 0xD6, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x6D, 0xE0, 0x4F, 0x65, 0x0C, 0x7A, 0x54, 0x3E ),
+    BYTES_TO_T_UINT_8( 0x16, 0xFA, 0xFB, 0x4A, 0xB4, 0x79, 0x5A, 0x8C ),
+    BYTES_TO_T_UINT_8( 0x04, 0x5D, 0x1B, 0x2B, 0xDA, 0xBC, 0x9A, 0x74 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x51, 0xAC, 0x56, 0xF7, 0x5F, 0x51, 0x68, 0x0B ),
+    BYTES_TO_T_UINT_8( 0xC6, 0xE0, 0x1D, 0xBC, 0x13, 0x4E, 0xAC, 0x03 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xF5, 0xC5, 0xE6, 0xD2, 0x88, 0xBA, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x0E, 0x28, 0x23, 0x58, 0x67, 0xFA, 0xEE ),
+    BYTES_TO_T_UINT_8( 0x9E, 0x80, 0x4B, 0xD8, 0xC4, 0xDF, 0x15, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x0E, 0x58, 0xE6, 0x2C, 0x59, 0xC2, 0x03 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x9B, 0x26, 0x27, 0x99, 0x16, 0x2B, 0x22, 0x0B ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xF3, 0x8F, 0xC3, 0x2A, 0x9B, 0xFC, 0x38 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x2E, 0x83, 0x3D, 0xFE, 0x9E, 0x3C, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x08, 0x57, 0xCD, 0x2D, 0xC1, 0x49, 0x38, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x42, 0x8B, 0x33, 0x89, 0x1F, 0xEA, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xAA, 0x1D, 0x13, 0xD7, 0x50, 0xBB, 0x3E, 0xEB ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD2, 0x9A, 0x52, 0xD2, 0x54, 0x7C, 0x97, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x33, 0x6E, 0xED, 0xD9, 0x87, 0x50, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x35, 0x7E, 0x16, 0x40, 0x15, 0x83, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0x33, 0x2B, 0xA4, 0xAB, 0x03, 0x91, 0xEA, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x47, 0x39, 0xEF, 0x05, 0x59, 0xD0, 0x90 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x24, 0x0D, 0x76, 0x11, 0x53, 0x08, 0xAF ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x1F, 0x2F, 0xDD, 0xBD, 0x50, 0x48, 0xB1, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0x80, 0x1C, 0x84, 0x55, 0x78, 0x14, 0xEB, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x5E, 0x3E, 0xA6, 0xAF, 0xF6, 0xC7, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x11, 0xE2, 0x65, 0xCA, 0x41, 0x95, 0x3B ),
+    BYTES_TO_T_UINT_8( 0xAE, 0x83, 0xD8, 0xE6, 0x4D, 0x22, 0x06, 0x2D ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x7F, 0x25, 0x2A, 0xAA, 0x28, 0x46, 0x97 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x79, 0xDB, 0x15, 0x56, 0x84, 0xCB, 0xC0, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x56, 0xDB, 0x0E, 0x08, 0xC9, 0xF5, 0xD4, 0x9E ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x62, 0xD0, 0x1A, 0x7C, 0x13, 0xD5, 0x07 ),
+    BYTES_TO_T_UINT_8( 0x7D, 0xAD, 0x53, 0xE0, 0x32, 0x21, 0xA0, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0x38, 0x81, 0x21, 0x23, 0x0E, 0xD2, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x51, 0x05, 0xD0, 0x1E, 0x82, 0xA9, 0x71 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA7, 0xC3, 0x27, 0xBF, 0xC6, 0xAA, 0xB7, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x65, 0x45, 0xDF, 0xB9, 0x46, 0x17, 0x46 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x38, 0x3F, 0xB2, 0xB1, 0x5D, 0xCA, 0x1C ),
+    BYTES_TO_T_UINT_8( 0x88, 0x29, 0x6C, 0x63, 0xE9, 0xD7, 0x48, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0xF1, 0xD7, 0x99, 0x8C, 0xC2, 0x05, 0x99 ),
+    BYTES_TO_T_UINT_8( 0x6D, 0xE6, 0x5E, 0x82, 0x6D, 0xE5, 0x7E, 0xD5 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x7B, 0x61, 0xFA, 0x7D, 0x01, 0xDB, 0xB6, 0x63 ),
+    BYTES_TO_T_UINT_8( 0x11, 0xC6, 0x58, 0x39, 0xF4, 0xC6, 0x82, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x47, 0x5A, 0x7A, 0x80, 0x08, 0xCD, 0xAA, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x8C, 0xC6, 0x3F, 0x3C, 0xA5, 0x68, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0xF5, 0xD5, 0x17, 0xAE, 0x36, 0xD8, 0x8A ),
+    BYTES_TO_T_UINT_8( 0xC7, 0xAD, 0x92, 0xC5, 0x57, 0x6C, 0xDA, 0x91 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xE8, 0x67, 0x17, 0xC0, 0x40, 0x78, 0x8C, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x9F, 0xF4, 0xAA, 0xDA, 0x5C, 0x7E, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x96, 0xDB, 0x42, 0x3E, 0x72, 0x64, 0xA0, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x27, 0xF9, 0x41, 0x17, 0x43, 0xE3, 0xE8, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x66, 0xDD, 0xCC, 0x43, 0x7E, 0x16, 0x05, 0x03 ),
+    BYTES_TO_T_UINT_8( 0x36, 0x4B, 0xCF, 0x48, 0x8F, 0x41, 0x90, 0xE5 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x98, 0x0C, 0x6B, 0x9D, 0x22, 0x04, 0xBC, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x86, 0x63, 0x79, 0x2F, 0x6A, 0x0E, 0x8A, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x29, 0x67, 0x3F, 0x02, 0xB8, 0x91, 0x7F, 0x74 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x14, 0x64, 0xA0, 0x33, 0xF4, 0x6B, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x44, 0x71, 0x87, 0xB8, 0x88, 0x3F, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x2B, 0x85, 0x05, 0xC5, 0x44, 0x53, 0x15 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x3E, 0x2B, 0xFE, 0xD1, 0x1C, 0x73, 0xE3, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x66, 0x33, 0xA1, 0xD3, 0x69, 0x1C, 0x9D, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x5A, 0xBA, 0xB6, 0xAE, 0x1B, 0x94, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0x74, 0x90, 0x5C, 0x57, 0xB0, 0x3A, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x2F, 0x93, 0x20, 0x24, 0x54, 0x1D, 0x8D ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x78, 0x9D, 0x71, 0x67, 0x5D, 0x49, 0x98 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x12, 0xC8, 0x0E, 0x11, 0x8D, 0xE0, 0x8F, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x59, 0x7F, 0x79, 0x6C, 0x5F, 0xB7, 0xBC, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0x88, 0xE1, 0x83, 0x3C, 0x12, 0xBB, 0xEE, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0xC2, 0xC4, 0x1B, 0x41, 0x71, 0xB9, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xB0, 0xEE, 0xBB, 0x1D, 0x89, 0x50, 0x88, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x1C, 0x55, 0x74, 0xEB, 0xDE, 0x92, 0x3F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x9C, 0x38, 0x92, 0x06, 0x19, 0xD0, 0xB3, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0x99, 0x26, 0xA3, 0x5F, 0xE2, 0xC1, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x75, 0xFC, 0xFD, 0xC3, 0xB6, 0x26, 0x24, 0x8F ),
+    BYTES_TO_T_UINT_8( 0xAF, 0xAD, 0xE7, 0x49, 0xB7, 0x64, 0x4B, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x4E, 0x95, 0xAD, 0x07, 0xFE, 0xB6, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x15, 0xE7, 0x2D, 0x19, 0xA9, 0x08, 0x10 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBE, 0xBD, 0xAC, 0x0A, 0x3F, 0x6B, 0xFF, 0xFA ),
+    BYTES_TO_T_UINT_8( 0xE0, 0xE4, 0x74, 0x14, 0xD9, 0x70, 0x1D, 0x71 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0xB0, 0x71, 0xBB, 0xD8, 0x18, 0x96, 0x2B ),
+    BYTES_TO_T_UINT_8( 0xDA, 0xB8, 0x19, 0x90, 0x80, 0xB5, 0xEE, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x91, 0x21, 0x20, 0xA6, 0x17, 0x48, 0x03, 0x6F ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x1D, 0xBB, 0x6D, 0x94, 0x20, 0x34, 0xF1 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x59, 0x82, 0x67, 0x4B, 0x8E, 0x4E, 0xBE, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0xBE, 0xDA, 0x77, 0xF8, 0x23, 0x55, 0x2B, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x02, 0xDE, 0x25, 0x35, 0x2D, 0x74, 0x51 ),
+    BYTES_TO_T_UINT_8( 0xD0, 0x0C, 0xB8, 0x0B, 0x39, 0xBA, 0xAD, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xA6, 0x0E, 0x28, 0x4D, 0xE1, 0x3D, 0xE4, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xEC, 0x0A, 0xD4, 0xB8, 0xC4, 0x8D, 0xB0 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x3E, 0x68, 0xCE, 0xC2, 0x55, 0x4D, 0x0C, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x20, 0x93, 0x32, 0x90, 0xD6, 0xAE, 0x47 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x78, 0xAB, 0x43, 0x9E, 0xEB, 0x73, 0xAE ),
+    BYTES_TO_T_UINT_8( 0xED, 0x97, 0xC3, 0x83, 0xA6, 0x3C, 0xF1, 0xBF ),
+    BYTES_TO_T_UINT_8( 0x0F, 0x25, 0x25, 0x66, 0x08, 0x26, 0xFA, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x41, 0xFB, 0x44, 0x5D, 0x82, 0xEC, 0x3B, 0xAC ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x58, 0x90, 0xEA, 0xB5, 0x04, 0x99, 0xD0, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x4A, 0xF2, 0x22, 0xA0, 0xEB, 0xFD, 0x45, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xA4, 0x81, 0x32, 0xFC, 0xFA, 0xEE, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x27, 0xBB, 0xA4, 0x6A, 0x77, 0x41, 0x5C, 0x1D ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x1E, 0xAA, 0x4F, 0xF0, 0x10, 0xB3, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x09, 0x74, 0x13, 0x14, 0x9E, 0x90, 0xD7, 0xE6 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xDB, 0xBD, 0x70, 0x4F, 0xA8, 0xD1, 0x06, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x19, 0x4E, 0x2E, 0x68, 0xFC, 0x35, 0xFA, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x60, 0x53, 0x75, 0xED, 0xF2, 0x5F, 0xC2, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x39, 0x87, 0x6B, 0x9F, 0x05, 0xE2, 0x22, 0x93 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x1A, 0xA8, 0xB7, 0x03, 0x9E, 0x6D, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xCB, 0xD0, 0x69, 0x88, 0xA8, 0x39, 0x9E, 0x3A ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xF8, 0xEF, 0x68, 0xFE, 0xEC, 0x24, 0x08, 0x15 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x06, 0x4B, 0x92, 0x0D, 0xB7, 0x34, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0xF4, 0xDD, 0x1A, 0xA0, 0x4A, 0xE4, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xC3, 0x63, 0x4F, 0x4F, 0xCE, 0xBB, 0xD6, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xEE, 0x8D, 0xDF, 0x3F, 0x73, 0xB7, 0xAC ),
+    BYTES_TO_T_UINT_8( 0xDF, 0x06, 0xB6, 0x80, 0x4D, 0x81, 0xD9, 0x53 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x15, 0xF5, 0x13, 0xDF, 0x13, 0x19, 0x97, 0x94 ),
+    BYTES_TO_T_UINT_8( 0x08, 0xF9, 0xB3, 0x33, 0x66, 0x82, 0x21, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xFC, 0x39, 0x16, 0x23, 0x43, 0x76, 0x0E ),
+    BYTES_TO_T_UINT_8( 0x09, 0x48, 0x25, 0xA1, 0x64, 0x95, 0x1C, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x43, 0xAC, 0x15, 0x57, 0xD9, 0xDE, 0xA0, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x16, 0x5F, 0xB8, 0x3D, 0x48, 0x91, 0x24, 0xCC ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x2D, 0xF2, 0xC8, 0x54, 0xD1, 0x32, 0xBD, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x3B, 0xF0, 0xAA, 0x9D, 0xD8, 0xF4, 0x20 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0xC3, 0xBB, 0x6C, 0x66, 0xAC, 0x25, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x25, 0x10, 0xB2, 0xE1, 0x41, 0xDE, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x3C, 0xE8, 0x30, 0xB8, 0x37, 0xBC, 0x2A, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x57, 0x01, 0x4A, 0x1E, 0x78, 0x9F, 0x85 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBD, 0x19, 0xCD, 0x12, 0x0B, 0x51, 0x4F, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x4B, 0x3D, 0x24, 0xA4, 0x16, 0x59, 0x05 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xEB, 0xD3, 0x59, 0x2E, 0x75, 0x7C, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x8C, 0xB9, 0xB4, 0xA5, 0xD9, 0x2E, 0x29, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x86, 0x16, 0x05, 0x75, 0x02, 0xB3, 0x06, 0xEE ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x7C, 0x9F, 0x79, 0x91, 0xF1, 0x4F, 0x23 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x65, 0x98, 0x7C, 0x84, 0xE1, 0xFF, 0x30, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x71, 0xE2, 0xC2, 0x5F, 0x55, 0x40, 0xBD, 0xCD ),
+    BYTES_TO_T_UINT_8( 0x69, 0x65, 0x87, 0x3F, 0xC4, 0xC2, 0x24, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x0E, 0x30, 0x0A, 0x60, 0x15, 0xD1, 0x24, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x57, 0x99, 0xD9, 0xB6, 0xAE, 0xB1, 0xAF, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x80, 0xEE, 0xA2, 0x0F, 0x74, 0xB9, 0xF3 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x03, 0xE6, 0x0F, 0x37, 0xC1, 0x10, 0x99, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x61, 0xAD, 0x9D, 0x5D, 0x80, 0x01, 0xA6, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x0F, 0x10, 0x2A, 0x9D, 0x20, 0x38, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x60, 0xCB, 0xCE, 0x5A, 0xA0, 0xA7, 0x32 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xCF, 0x14, 0xDF, 0xBF, 0xE5, 0x74, 0x2D ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x12, 0x1A, 0xDD, 0x59, 0x02, 0x5D, 0xC6 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xC8, 0xC9, 0xF8, 0xF5, 0xB6, 0x13, 0x4D, 0x7B ),
+    BYTES_TO_T_UINT_8( 0xED, 0x45, 0xB1, 0x93, 0xB3, 0xA2, 0x79, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x74, 0xF6, 0xCF, 0xF7, 0xE6, 0x29, 0x9C, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x87, 0x50, 0x65, 0x80, 0xBC, 0x59, 0x0A, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x0E, 0xF0, 0x24, 0x35, 0xA2, 0x46, 0xF0, 0x0C ),
+    BYTES_TO_T_UINT_8( 0xBD, 0x26, 0xC0, 0x9D, 0x61, 0x56, 0x62, 0x67 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x10, 0xBB, 0xC2, 0x24, 0x43, 0x2E, 0x37, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0xF7, 0xCE, 0x35, 0xFC, 0x77, 0xF3, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x75, 0x34, 0x96, 0xD5, 0x4A, 0x76, 0x9D, 0x6B ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x3B, 0x0F, 0xEA, 0xA8, 0x12, 0x0B, 0x22 ),
+    BYTES_TO_T_UINT_8( 0x66, 0x3F, 0x5D, 0x2D, 0x1C, 0xD4, 0x9E, 0xFB ),
+    BYTES_TO_T_UINT_8( 0x7D, 0x2E, 0xDD, 0xC7, 0x6E, 0xAB, 0xAF, 0xDC ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x8C, 0xB2, 0x7B, 0x0C, 0x9A, 0x83, 0x8E, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x51, 0x90, 0x92, 0x79, 0x32, 0x19, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0x89, 0xF9, 0xD0, 0xCF, 0x2C, 0xA5, 0x8F ),
+    BYTES_TO_T_UINT_8( 0x7B, 0x50, 0x21, 0xDE, 0x50, 0x41, 0x9D, 0x81 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x7D, 0x2B, 0x9E, 0x9D, 0x95, 0xA8, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0xA5, 0x20, 0x87, 0x88, 0x97, 0x5F, 0xAA ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x64, 0x59, 0xB4, 0x66, 0x7E, 0xE8, 0x5A, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x5C, 0x7E, 0xB2, 0xAD, 0xD9, 0xC9, 0xDA ),
+    BYTES_TO_T_UINT_8( 0x82, 0x97, 0x49, 0xA3, 0x13, 0x83, 0x07, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x26, 0xC7, 0x13, 0x35, 0x0D, 0xB0, 0x6B ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x60, 0xAB, 0xFA, 0x4B, 0x93, 0x18, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x54, 0x2D, 0x1C, 0x31, 0x4C, 0xE4, 0x61, 0xAE ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xDE, 0x4D, 0x1E, 0x51, 0x59, 0x6E, 0x91, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x38, 0x54, 0x4D, 0x51, 0xED, 0x36, 0xCC, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x18, 0xA8, 0x56, 0xC7, 0x78, 0x27, 0x33, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x42, 0xB7, 0x95, 0xC9, 0x8B, 0xC8, 0x6A, 0xBC ),
+    BYTES_TO_T_UINT_8( 0x5E, 0xE9, 0x13, 0x96, 0xB3, 0xE1, 0xF9, 0xEE ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x46, 0xB0, 0x5E, 0xC3, 0x94, 0x03, 0x05 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6D, 0x5B, 0x29, 0x30, 0x41, 0x1A, 0x9E, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x76, 0xCA, 0x83, 0x31, 0x5B, 0xA7, 0xCB, 0x42 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x41, 0x50, 0x44, 0x4D, 0x64, 0x31, 0x89 ),
+    BYTES_TO_T_UINT_8( 0xCF, 0x84, 0xC2, 0x5D, 0x97, 0xA5, 0x3C, 0x18 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0x0F, 0xA5, 0xFD, 0x8E, 0x5A, 0x47, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x58, 0x02, 0x2D, 0x40, 0xB1, 0x0B, 0xBA ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xDA, 0x33, 0x8C, 0x67, 0xCE, 0x23, 0x43, 0x99 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x53, 0x47, 0x72, 0x44, 0x1F, 0x5B, 0x2A ),
+    BYTES_TO_T_UINT_8( 0xAE, 0xC1, 0xD9, 0xA4, 0x50, 0x88, 0x63, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0xF2, 0x75, 0x69, 0x73, 0x00, 0xC4, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x4B, 0x90, 0x1D, 0xDF, 0x1A, 0x00, 0xD8, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x05, 0xB1, 0x89, 0x48, 0xA8, 0x70, 0x62, 0xEF ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x7E, 0x8A, 0x55, 0x50, 0x7B, 0xEF, 0x8A, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xFE, 0x1B, 0x23, 0x48, 0x23, 0x63, 0x91, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x0D, 0x04, 0x54, 0x3C, 0x24, 0x9B, 0xC7, 0x9A ),
+    BYTES_TO_T_UINT_8( 0x25, 0x38, 0xC3, 0x84, 0xFB, 0xFF, 0x9F, 0x49 ),
+    BYTES_TO_T_UINT_8( 0x66, 0x2A, 0xE0, 0x6D, 0x68, 0x8A, 0x5C, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x93, 0x53, 0x85, 0xA1, 0x0D, 0xAF, 0x63 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x1B, 0x88, 0x95, 0x4C, 0x0B, 0xD0, 0x06, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x92, 0xAF, 0x8D, 0x49, 0xA2, 0xC8, 0xB4, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x75, 0x76, 0x53, 0x09, 0x88, 0x43, 0x87, 0xCA ),
+    BYTES_TO_T_UINT_8( 0x90, 0xA4, 0x77, 0x3F, 0x5E, 0x21, 0xB4, 0x0A ),
+    BYTES_TO_T_UINT_8( 0x35, 0x9E, 0x86, 0x64, 0xCC, 0x91, 0xC1, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x17, 0x56, 0xCB, 0xC3, 0x7D, 0x5B, 0xB1 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x64, 0x74, 0x9F, 0xB5, 0x91, 0x21, 0xB1, 0x1C ),
+    BYTES_TO_T_UINT_8( 0x1E, 0xED, 0xE1, 0x11, 0xEF, 0x45, 0xAF, 0xC1 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x31, 0xBE, 0xB2, 0xBC, 0x72, 0x65, 0x1F ),
+    BYTES_TO_T_UINT_8( 0xB1, 0x4B, 0x8C, 0x77, 0xCE, 0x1E, 0x42, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0xFF, 0xC9, 0xAA, 0xB9, 0xD9, 0x86, 0x99, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x23, 0x80, 0xC6, 0x4E, 0x35, 0x0B, 0x6D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x47, 0xD8, 0xA2, 0x0A, 0x39, 0x32, 0x1D, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x61, 0xC8, 0x86, 0xF1, 0x12, 0x9A, 0x4A, 0x05 ),
+    BYTES_TO_T_UINT_8( 0x8D, 0xF1, 0x7C, 0xAA, 0x70, 0x8E, 0xBC, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x62, 0x01, 0x47, 0x8F, 0xDD, 0x8B, 0xA5, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x08, 0x21, 0xF4, 0xAB, 0xC7, 0xF5, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x76, 0xA5, 0x95, 0xC4, 0x0F, 0x88, 0x1D ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x3F, 0x42, 0x2A, 0x52, 0xCD, 0x75, 0x51, 0x49 ),
+    BYTES_TO_T_UINT_8( 0x90, 0x36, 0xE5, 0x04, 0x2B, 0x44, 0xC6, 0xEF ),
+    BYTES_TO_T_UINT_8( 0x5C, 0xEE, 0x16, 0x13, 0x07, 0x83, 0xB5, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x59, 0xC6, 0xA2, 0x19, 0x05, 0xD3, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x8B, 0xA8, 0x16, 0x09, 0xB7, 0xEA, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x70, 0xEE, 0x14, 0xAF, 0xB5, 0xFD, 0xD0, 0xEF ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x18, 0x7C, 0xCA, 0x71, 0x3E, 0x6E, 0x66, 0x75 ),
+    BYTES_TO_T_UINT_8( 0xBE, 0x31, 0x0E, 0x3F, 0xE5, 0x91, 0xC4, 0x7F ),
+    BYTES_TO_T_UINT_8( 0x8E, 0x3D, 0xC2, 0x3E, 0x95, 0x37, 0x58, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x01, 0x1F, 0x02, 0x03, 0xF3, 0xEF, 0xEE, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x28, 0x5B, 0x1A, 0xFC, 0x38, 0xCD, 0xE8, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x12, 0x57, 0x42, 0x85, 0xC6, 0x21, 0x68, 0x71 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x8D, 0xA2, 0x4A, 0x66, 0xB1, 0x0A, 0xE6, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0x86, 0x0C, 0x94, 0x9D, 0x5E, 0x99, 0xB2, 0xCE ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x03, 0x40, 0xCA, 0xB2, 0xB3, 0x30, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x78, 0x48, 0x27, 0x34, 0x1E, 0xE2, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xAE, 0x72, 0x5B, 0xAC, 0xC1, 0x6D, 0xE3, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x57, 0xAB, 0x46, 0xCB, 0xEA, 0x5E, 0x4B, 0x0B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xFC, 0x08, 0xAD, 0x4E, 0x51, 0x9F, 0x2A, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x5C, 0x7D, 0x4C, 0xD6, 0xCF, 0xDD, 0x02 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x76, 0x26, 0xE0, 0x8B, 0x10, 0xD9, 0x7C ),
+    BYTES_TO_T_UINT_8( 0x30, 0xA7, 0x23, 0x4E, 0x5F, 0xD2, 0x42, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xD1, 0xE5, 0xA4, 0xEC, 0x77, 0x21, 0x34, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x14, 0x65, 0xEA, 0x4A, 0x85, 0xC3, 0x2F ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x19, 0xD8, 0x40, 0x27, 0x73, 0x15, 0x7E, 0x65 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xBB, 0x53, 0x7E, 0x0F, 0x40, 0xC8, 0xD4 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x37, 0x19, 0x73, 0xEF, 0x5A, 0x5E, 0x04 ),
+    BYTES_TO_T_UINT_8( 0x9C, 0x73, 0x2B, 0x49, 0x7E, 0xAC, 0x97, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x15, 0xB2, 0xC3, 0x1E, 0x0E, 0xE7, 0xD2, 0x21 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x08, 0xD6, 0xDD, 0xAC, 0x21, 0xD6, 0x3E ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA9, 0x26, 0xBE, 0x6D, 0x6D, 0xF2, 0x38, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x08, 0x6C, 0x31, 0xA7, 0x49, 0x50, 0x3A, 0x89 ),
+    BYTES_TO_T_UINT_8( 0xC3, 0x99, 0xC6, 0xF5, 0xD2, 0xC2, 0x30, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x2A, 0xE4, 0xF6, 0x8B, 0x8B, 0x97, 0xE9, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x21, 0xB7, 0x0D, 0xFC, 0x15, 0x54, 0x0B ),
+    BYTES_TO_T_UINT_8( 0x65, 0x83, 0x1C, 0xA4, 0xCD, 0x6B, 0x9D, 0xF2 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xD6, 0xE8, 0x4C, 0x48, 0xE4, 0xAA, 0x69, 0x93 ),
+    BYTES_TO_T_UINT_8( 0x27, 0x7A, 0x27, 0xFC, 0x37, 0x96, 0x1A, 0x7B ),
+    BYTES_TO_T_UINT_8( 0x6F, 0xE7, 0x30, 0xA5, 0xCF, 0x13, 0x46, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x8C, 0xD8, 0xAF, 0x74, 0x23, 0x4D, 0x56, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x3D, 0x44, 0x14, 0x1B, 0x97, 0x83, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x47, 0xD7, 0x5F, 0xFD, 0x98, 0x38, 0xF7 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xA3, 0x73, 0x64, 0x36, 0xFD, 0x7B, 0xC1, 0x15 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x5D, 0x32, 0xD2, 0x47, 0x94, 0x89, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x51, 0xE9, 0x30, 0xAC, 0x06, 0xC8, 0x65, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x6C, 0xB9, 0x1B, 0xF7, 0x61, 0x49, 0x53 ),
+    BYTES_TO_T_UINT_8( 0xD7, 0xFF, 0x32, 0x43, 0x80, 0xDA, 0xA6, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xF8, 0x04, 0x01, 0x95, 0x35, 0xCE, 0x21 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6D, 0x06, 0x46, 0x0D, 0x51, 0xE2, 0xD8, 0xAC ),
+    BYTES_TO_T_UINT_8( 0x14, 0x57, 0x1D, 0x6F, 0x79, 0xA0, 0xCD, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0xDF, 0xFB, 0x36, 0xCA, 0xAD, 0xF5, 0x9E, 0x41 ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x7A, 0x1D, 0x9E, 0x1D, 0x95, 0x48, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x81, 0x26, 0xA5, 0xB7, 0x15, 0x2C, 0xC2, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x86, 0x42, 0x72, 0xAA, 0x11, 0xDC, 0xC9, 0xB6 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x3F, 0x6C, 0x64, 0xA7, 0x62, 0x3C, 0xAB, 0xD4 ),
+    BYTES_TO_T_UINT_8( 0x48, 0x6A, 0x44, 0xD8, 0x60, 0xC0, 0xA8, 0x80 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x76, 0x58, 0x12, 0x57, 0x3C, 0x89, 0x46 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x4F, 0x83, 0xCE, 0xCB, 0xB8, 0xD0, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x84, 0x04, 0xB0, 0xAD, 0xEB, 0xFA, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x34, 0xA4, 0xC3, 0x41, 0x44, 0x4E, 0x65, 0x3E ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xB6, 0x16, 0xA9, 0x1C, 0xE7, 0x65, 0x20, 0xC1 ),
+    BYTES_TO_T_UINT_8( 0x58, 0x53, 0x32, 0xF8, 0xC0, 0xA6, 0xBD, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xF0, 0xE6, 0x57, 0x31, 0xCC, 0x26, 0x6F ),
+    BYTES_TO_T_UINT_8( 0x27, 0xE3, 0x54, 0x1C, 0x34, 0xD3, 0x17, 0xBC ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xAE, 0xED, 0xFB, 0xCD, 0xE7, 0x1E, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x16, 0x1C, 0x34, 0x40, 0x00, 0x1F, 0xB6 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x6A, 0x32, 0x00, 0xC2, 0xD4, 0x3B, 0x1A, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x34, 0xE0, 0x99, 0x8F, 0x0C, 0x4A, 0x16, 0x44 ),
+    BYTES_TO_T_UINT_8( 0x83, 0x73, 0x18, 0x1B, 0xD4, 0x94, 0x29, 0x62 ),
+    BYTES_TO_T_UINT_8( 0x29, 0xA4, 0x2D, 0xB1, 0x9D, 0x74, 0x32, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0xF4, 0xB1, 0x0C, 0x37, 0x62, 0x8B, 0x66 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0xFF, 0xDA, 0xE2, 0x35, 0xA3, 0xB6, 0x42 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x91, 0x49, 0x99, 0x65, 0xC5, 0xED, 0x16, 0xEF ),
+    BYTES_TO_T_UINT_8( 0x79, 0x42, 0x9A, 0xF3, 0xA7, 0x4E, 0x6F, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x7B, 0x0A, 0x7E, 0xC0, 0xD7, 0x4E, 0x07, 0x55 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0x7A, 0x31, 0x69, 0xA6, 0xB9, 0x15, 0x34 ),
+    BYTES_TO_T_UINT_8( 0xA8, 0xE0, 0x72, 0xA4, 0x3F, 0xB9, 0xF8, 0x0C ),
+    BYTES_TO_T_UINT_8( 0x2B, 0x75, 0x32, 0x85, 0xA2, 0xDE, 0x37, 0x12 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0xBC, 0xC0, 0x0D, 0xCF, 0x25, 0x41, 0xA4, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0xFC, 0xB2, 0x48, 0xC3, 0x85, 0x83, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x2B, 0xBE, 0x0B, 0x58, 0x2D, 0x7A, 0x9A, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0xF3, 0x81, 0x18, 0x1B, 0x74, 0x4F, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x43, 0xA3, 0x0A, 0x16, 0x8B, 0xA3, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x18, 0x81, 0x7B, 0x8D, 0xA2, 0x35, 0x77 ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x86, 0xC4, 0x3F, 0x2C, 0xE7, 0x5F, 0x99, 0x03 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0x2B, 0xB7, 0xB6, 0xAD, 0x5A, 0x56, 0xFF ),
+    BYTES_TO_T_UINT_8( 0x04, 0x00, 0xA4, 0x48, 0xC8, 0xE8, 0xBA, 0xBF ),
+    BYTES_TO_T_UINT_8( 0xE8, 0xA1, 0xB5, 0x13, 0x5A, 0xCD, 0x99, 0x9C ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x95, 0xAD, 0xFC, 0xE2, 0x7E, 0xE7, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x96, 0x6B, 0xD1, 0x34, 0x99, 0x53, 0x63, 0x0B ),
+  },
+  {
+    BYTES_TO_T_UINT_8( 0x19, 0x8A, 0x77, 0x5D, 0x2B, 0xAB, 0x01, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0x85, 0xD0, 0xD5, 0x49, 0x83, 0x4D, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x81, 0xC6, 0x91, 0x30, 0x3B, 0x00, 0xAF, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x3A, 0xAE, 0x61, 0x07, 0xE1, 0xB6, 0xE2, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x43, 0x41, 0xFE, 0x9B, 0xB6, 0xF0, 0xA5 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x97, 0xAE, 0xAD, 0x89, 0x88, 0x9E, 0x41 ),
+  },
+};
+
+static const mbedtls_ecp_point secp384r1_comb_T[32] = {
+    COMB_POINT( secp384r1_comb, 0 ),
+    COMB_POINT( secp384r1_comb, 1 ),
+    COMB_POINT( secp384r1_comb, 2 ),
+    COMB_POINT( secp384r1_comb, 3 ),
+    COMB_POINT( secp384r1_comb, 4 ),
+    COMB_POINT( secp384r1_comb, 5 ),
+    COMB_POINT( secp384r1_comb, 6 ),
+    COMB_POINT( secp384r1_comb, 7 ),
+    COMB_POINT( secp384r1_comb, 8 ),
+    COMB_POINT( secp384r1_comb, 9 ),
+    COMB_POINT( secp384r1_comb, 10 ),
+    COMB_POINT( secp384r1_comb, 11 ),
+    COMB_POINT( secp384r1_comb, 12 ),
+    COMB_POINT( secp384r1_comb, 13 ),
+    COMB_POINT( secp384r1_comb, 14 ),
+    COMB_POINT( secp384r1_comb, 15 ),
+    COMB_POINT( secp384r1_comb, 16 ),
+    COMB_POINT( secp384r1_comb, 17 ),
+    COMB_POINT( secp384r1_comb, 18 ),
+    COMB_POINT( secp384r1_comb, 19 ),
+    COMB_POINT( secp384r1_comb, 20 ),
+    COMB_POINT( secp384r1_comb, 21 ),
+    COMB_POINT( secp384r1_comb, 22 ),
+    COMB_POINT( secp384r1_comb, 23 ),
+    COMB_POINT( secp384r1_comb, 24 ),
+    COMB_POINT( secp384r1_comb, 25 ),
+    COMB_POINT( secp384r1_comb, 26 ),
+    COMB_POINT( secp384r1_comb, 27 ),
+    COMB_POINT( secp384r1_comb, 28 ),
+    COMB_POINT( secp384r1_comb, 29 ),
+    COMB_POINT( secp384r1_comb, 30 ),
+    COMB_POINT( secp384r1_comb, 31 ),
+};
+#endif /* MBEDTLS_ECP_DP_SECP384R1_ENABLED */
+
+/* cleared to time or check m * G on the tables built at run time */
+int mbedtls_ecp_comb_rom_enabled = 1;
+
+const mbedtls_ecp_point *mbedtls_ecp_comb_rom( const mbedtls_ecp_group *grp,
+                                               const mbedtls_ecp_point *P,
+                                               unsigned char *w )
+{
+    const mbedtls_ecp_point *T;
+    unsigned char t_w;
+
+    if( !mbedtls_ecp_comb_rom_enabled )
+        return( NULL );
+
+    switch( grp->id )
+    {
+#if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+        case MBEDTLS_ECP_DP_SECP256R1:
+            T = secp256r1_comb_T;
+            t_w = SECP256R1_COMB_W;
+            break;
+#endif
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+        case MBEDTLS_ECP_DP_SECP384R1:
+            T = secp384r1_comb_T;
+            t_w = SECP384R1_COMB_W;
+            break;
+#endif
+        default:
+            return( NULL );
+    }
+
+    /* T[0] is G itself, only use the table when P is that point */
+    if( mbedtls_mpi_cmp_int( &P->Z, 1 ) != 0 ||
+        mbedtls_mpi_cmp_mpi( &P->X, &T[0].X ) != 0 ||
+        mbedtls_mpi_cmp_mpi( &P->Y, &T[0].Y ) != 0 )
+        return( NULL );
+
+    *w = t_w;
+
+    return( T );
+}
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_ALT && MBEDTLS_ECP_ROM_TABLES */
@@ -26,6 +26,7 @@
 
 #include "tls_client.h"
 #include "tls_certificate.h"
+#include "tls_session.h"
 
 #if !defined(MBEDTLS_CONFIG_FILE)
 #include "mbedtls/config.h"
@@ -176,6 +177,11 @@ int mbedtls_client_context(MbedTLSSession *session)
 int mbedtls_client_connect(MbedTLSSession *session)
 {
     int ret = 0;
+#if CFG_TLS_SESSION_RESUME
+    int offered;
+
+__retry:
+#endif
 
     if ((ret = mbedtls_net_connect(&session->server_fd, session->host,
                                   session->port, MBEDTLS_NET_PROTO_TCP)) != 0)
@@ -187,12 +193,26 @@ int mbedtls_client_connect(MbedTLSSession *session)
     tls_printf("Connected %s:%s success...\r\n", session->host, session->port);
 
     mbedtls_ssl_set_bio(&session->ssl, &session->server_fd, mbedtls_net_send, mbedtls_net_recv, NULL);
+#if CFG_TLS_SESSION_RESUME
+    offered = tls_session_offer(session);
+#endif
 
     while ((ret = mbedtls_ssl_handshake(&session->ssl)) != 0)
     {
         if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
         {
             tls_printf("mbedtls_ssl_handshake returned -0x%x\r\n", -ret);
+#if CFG_TLS_SESSION_RESUME
+            /* the stored session may be what broke it: drop it and
+             * try once more with a full handshake */
+            if (offered)
+            {
+                tls_session_forget(session->host, session->port);
+                mbedtls_net_free(&session->server_fd);
+                if (mbedtls_ssl_session_reset(&session->ssl) == 0)
+                    goto __retry;
+            }
+#endif
             return ret;
         }
     }
@@ -207,6 +227,10 @@ int mbedtls_client_connect(MbedTLSSession *session)
     else 
     {
         tls_printf("Certificate verified success...\r\n");
+#if CFG_TLS_SESSION_RESUME
+        /* only a verified peer gets its session stored */
+        tls_session_update(session);
+#endif
     }
 #endif
     return TLS_EOK;
@@ -0,0 +1,462 @@
+/*
+ *  Copyright (C) 2006-2015, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tls_rtos.h"
+
+#include "tls_client.h"
+#include "tls_session.h"
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if CFG_TLS_SESSION_RESUME
+#include "mbedtls/aes.h"
+#include "mbedtls/md.h"
+#include "mbedtls/sha256.h"
+#include "param_config.h"
+#if CFG_EASY_FLASH
+#include "easyflash.h"
+#endif
+
+#define tls_printf bk_printf("[TLS]");bk_printf
+
+#define TLS_SESSION_MAGIC                      0x31535354  /* "TSS1" */
+#define TLS_SESSION_NONCE_LEN                  16
+#define TLS_SESSION_TAG_LEN                    16
+#define TLS_SESSION_SALT                       "bk tls session v1"
+
+/* the plain record, followed by ticket_len bytes of ticket. the blob is
+ * nonce | aes-128-ctr(record) | hmac-sha256(nonce | ciphertext)[0..15] */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t host_hash;         /* catches a name collision */
+    uint16_t uses;              /* resumed handshakes since the full one */
+    uint16_t ticket_len;
+    int32_t ciphersuite;
+    int32_t compression;
+    uint32_t verify_result;
+    uint32_t ticket_lifetime;
+    uint8_t id_len;
+    uint8_t mfl_code;
+    uint8_t trunc_hmac;
+    uint8_t encrypt_then_mac;
+    uint8_t id[32];
+    uint8_t master[48];
+} TLS_SESSION_REC_T;
+
+#define TLS_SESSION_BLOB_MAX                   (TLS_SESSION_NONCE_LEN + sizeof(TLS_SESSION_REC_T) \
+                                                + TLS_SESSION_TICKET_MAX + TLS_SESSION_TAG_LEN)
+
+#if !CFG_EASY_FLASH
+typedef struct
+{
+    uint32_t host_hash;
+    size_t len;
+    unsigned char *blob;
+} TLS_SESSION_SLOT_T;
+
+static TLS_SESSION_SLOT_T tls_session_slot[CFG_TLS_SESSION_RAM_SLOTS];
+static uint32_t tls_session_slot_next;
+#endif
+
+static void tls_session_zeroize(void *v, size_t n)
+{
+    volatile unsigned char *p = v;
+
+    while(n--)
+        *p++ = 0;
+}
+
+/* compare in a time that does not depend on where the bytes differ */
+static int tls_session_tag_equal(const unsigned char *a, const unsigned char *b, size_t n)
+{
+    unsigned char diff = 0;
+
+    while(n--)
+        diff |= *a++ ^ *b++;
+
+    return diff == 0;
+}
+
+static uint32_t tls_session_hash(const char *host, const char *port)
+{
+    uint32_t h = 2166136261UL;
+
+    while(*host)
+        h = (h ^ (unsigned char)*host++) * 16777619UL;
+    h = (h ^ ':') * 16777619UL;
+    while(*port)
+        h = (h ^ (unsigned char)*port++) * 16777619UL;
+
+    return h;
+}
+
+/* bound to this device: sha256(sta mac | salt), aes key then hmac key */
+static void tls_session_keys(unsigned char key[32])
+{
+    unsigned char seed[6 + sizeof(TLS_SESSION_SALT)];
+
+    wifi_get_mac_address((char *)seed, CONFIG_ROLE_STA);
+    memcpy(seed + 6, TLS_SESSION_SALT, sizeof(TLS_SESSION_SALT));
+    mbedtls_sha256(seed, sizeof(seed), key, 0);
+}
+
+static int tls_session_tag(const unsigned char key[32], const unsigned char *buf,
+                           size_t len, unsigned char tag[32])
+{
+    return mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+                           key + 16, 16, buf, len, tag);
+}
+
+/* ctr both ways, the nonce is the initial counter block */
+static int tls_session_crypt(const unsigned char key[32], const unsigned char *nonce,
+                             unsigned char *buf, size_t len)
+{
+    mbedtls_aes_context aes;
+    unsigned char counter[16], stream[16];
+    size_t off = 0;
+    int ret;
+
+    memcpy(counter, nonce, sizeof(counter));
+    mbedtls_aes_init(&aes);
+    ret = mbedtls_aes_setkey_enc(&aes, key, 128);
+    if(ret == 0)
+        ret = mbedtls_aes_crypt_ctr(&aes, len, &off, counter, stream, buf, buf);
+    mbedtls_aes_free(&aes);
+    tls_session_zeroize(stream, sizeof(stream));
+
+    return ret;
+}
+
+static void tls_session_name(char name[16], uint32_t host_hash)
+{
+    snprintf(name, 16, "tls_%08x", (unsigned int)host_hash);
+}
+
+static size_t tls_session_blob_get(uint32_t host_hash, unsigned char *blob, size_t len)
+{
+#if CFG_EASY_FLASH
+    char name[16];
+    size_t saved = 0;
+
+    tls_session_name(name, host_hash);
+    if(ef_get_env_blob(name, blob, len, &saved) != saved)
+        return 0;
+
+    return saved;
+#else
+    int i;
+
+    for(i = 0; i < CFG_TLS_SESSION_RAM_SLOTS; i++)
+    {
+        if(tls_session_slot[i].blob && (tls_session_slot[i].host_hash == host_hash)
+            && (tls_session_slot[i].len <= len))
+        {
+            memcpy(blob, tls_session_slot[i].blob, tls_session_slot[i].len);
+            return tls_session_slot[i].len;
+        }
+    }
+
+    return 0;
+#endif
+}
+
+static void tls_session_blob_del(uint32_t host_hash)
+{
+#if CFG_EASY_FLASH
+    char name[16];
+
+    tls_session_name(name, host_hash);
+    ef_del_env(name);
+#else
+    int i;
+
+    for(i = 0; i < CFG_TLS_SESSION_RAM_SLOTS; i++)
+    {
+        if(tls_session_slot[i].blob && (tls_session_slot[i].host_hash == host_hash))
+        {
+            tls_free(tls_session_slot[i].blob);
+            tls_session_slot[i].blob = TLS_NULL;
+        }
+    }
+#endif
+}
+
+static void tls_session_blob_put(uint32_t host_hash, const unsigned char *blob, size_t len)
+{
+#if CFG_EASY_FLASH
+    char name[16];
+
+    tls_session_name(name, host_hash);
+    if(ef_set_env_blob(name, blob, len) != EF_NO_ERR)
+    {
+        tls_printf("session save failed\r\n");
+    }
+#else
+    unsigned char *copy;
+    int i;
+
+    copy = tls_malloc(len);
+    if(copy == TLS_NULL)
+        return;
+    memcpy(copy, blob, len);
+
+    tls_session_blob_del(host_hash);
+    for(i = 0; i < CFG_TLS_SESSION_RAM_SLOTS; i++)
+    {
+        if(tls_session_slot[i].blob == TLS_NULL)
+            break;
+    }
+    if(i == CFG_TLS_SESSION_RAM_SLOTS)
+    {
+        i = tls_session_slot_next++ % CFG_TLS_SESSION_RAM_SLOTS;
+        tls_free(tls_session_slot[i].blob);
+    }
+
+    tls_session_slot[i].host_hash = host_hash;
+    tls_session_slot[i].len = len;
+    tls_session_slot[i].blob = copy;
+#endif
+}
+
+/* decrypt and check the stored record, return it in a tls_malloc buffer */
+static TLS_SESSION_REC_T *tls_session_load(uint32_t host_hash)
+{
+    unsigned char key[32], tag[32];
+    unsigned char *blob;
+    TLS_SESSION_REC_T *rec = TLS_NULL;
+    size_t len, body;
+
+    blob = tls_malloc(TLS_SESSION_BLOB_MAX);
+    if(blob == TLS_NULL)
+        return TLS_NULL;
+
+    len = tls_session_blob_get(host_hash, blob, TLS_SESSION_BLOB_MAX);
+    if(len < TLS_SESSION_NONCE_LEN + sizeof(TLS_SESSION_REC_T) + TLS_SESSION_TAG_LEN)
+        goto exit;
+
+    body = len - TLS_SESSION_NONCE_LEN - TLS_SESSION_TAG_LEN;
+    tls_session_keys(key);
+    if((tls_session_tag(key, blob, len - TLS_SESSION_TAG_LEN, tag) != 0)
+        || !tls_session_tag_equal(tag, blob + len - TLS_SESSION_TAG_LEN, TLS_SESSION_TAG_LEN))
+    {
+        tls_printf("stored session rejected\r\n");
+        goto exit;
+    }
+
+    if(tls_session_crypt(key, blob, blob + TLS_SESSION_NONCE_LEN, body) != 0)
+        goto exit;
+
+    rec = (TLS_SESSION_REC_T *)blob;
+    memmove(rec, blob + TLS_SESSION_NONCE_LEN, body);
+    if((rec->magic != TLS_SESSION_MAGIC) || (rec->host_hash != host_hash)
+        || (sizeof(TLS_SESSION_REC_T) + rec->ticket_len != body)
+        || (rec->id_len > sizeof(rec->id)))
+    {
+        rec = TLS_NULL;
+    }
+
+exit:
+    tls_session_zeroize(key, sizeof(key));
+    if(rec == TLS_NULL)
+    {
+        tls_session_zeroize(blob, TLS_SESSION_BLOB_MAX);
+        tls_free(blob);
+    }
+
+    return rec;
+}
+
+static void tls_session_store(MbedTLSSession *session, TLS_SESSION_REC_T *rec)
+{
+    unsigned char key[32], tag[32];
+    unsigned char *blob;
+    size_t body = sizeof(TLS_SESSION_REC_T) + rec->ticket_len;
+    size_t len = TLS_SESSION_NONCE_LEN + body + TLS_SESSION_TAG_LEN;
+
+    blob = tls_malloc(len);
+    if(blob == TLS_NULL)
+        return;
+
+    tls_session_keys(key);
+    if(mbedtls_ctr_drbg_random(&session->ctr_drbg, blob, TLS_SESSION_NONCE_LEN) == 0)
+    {
+        memcpy(blob + TLS_SESSION_NONCE_LEN, rec, body);
+        if((tls_session_crypt(key, blob, blob + TLS_SESSION_NONCE_LEN, body) == 0)
+            && (tls_session_tag(key, blob, len - TLS_SESSION_TAG_LEN, tag) == 0))
+        {
+            memcpy(blob + len - TLS_SESSION_TAG_LEN, tag, TLS_SESSION_TAG_LEN);
+            tls_session_blob_put(rec->host_hash, blob, len);
+        }
+    }
+
+    tls_session_zeroize(key, sizeof(key));
+    tls_session_zeroize(blob, len);
+    tls_free(blob);
+}
+
+static void tls_session_check(const unsigned char master[48], unsigned char check[8])
+{
+    unsigned char digest[32];
+
+    mbedtls_sha256(master, 48, digest, 0);
+    memcpy(check, digest, 8);
+}
+
+int tls_session_offer(MbedTLSSession *session)
+{
+    uint32_t host_hash = tls_session_hash(session->host, session->port);
+    TLS_SESSION_REC_T *rec;
+    mbedtls_ssl_session ssn;
+    int ret;
+
+    session->resume_offered = 0;
+
+    rec = tls_session_load(host_hash);
+    if(rec == TLS_NULL)
+        return 0;
+
+    /* no clock survives deep sleep, so freshness is a use count; servers
+     * enforce their own lifetime and answer a stale offer with a full
+     * handshake */
+    if(rec->uses >= CFG_TLS_SESSION_MAX_USES)
+    {
+        tls_printf("stored session used %d times, full handshake\r\n", rec->uses);
+        tls_session_blob_del(host_hash);
+        ret = -1;
+        goto exit;
+    }
+
+    mbedtls_ssl_session_init(&ssn);
+    ssn.ciphersuite = rec->ciphersuite;
+    ssn.compression = rec->compression;
+    ssn.id_len = rec->id_len;
+    memcpy(ssn.id, rec->id, sizeof(ssn.id));
+    memcpy(ssn.master, rec->master, sizeof(ssn.master));
+    ssn.verify_result = rec->verify_result;
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    if(rec->ticket_len)
+    {
+        ssn.ticket = (unsigned char *)&rec[1];
+        ssn.ticket_len = rec->ticket_len;
+        ssn.ticket_lifetime = rec->ticket_lifetime;
+    }
+#endif
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+    ssn.mfl_code = rec->mfl_code;
+#endif
+#if defined(MBEDTLS_SSL_TRUNCATED_HMAC)
+    ssn.trunc_hmac = rec->trunc_hmac;
+#endif
+#if defined(MBEDTLS_SSL_ENCRYPT_THEN_MAC)
+    ssn.encrypt_then_mac = rec->encrypt_then_mac;
+#endif
+
+    /* set_session copies, the ticket stays ours */
+    ret = mbedtls_ssl_set_session(&session->ssl, &ssn);
+    if(ret == 0)
+    {
+        tls_session_check(rec->master, session->resume_check);
+        session->resume_offered = 1;
+        session->resume_uses = rec->uses;
+    }
+    tls_session_zeroize(&ssn, sizeof(ssn));
+
+exit:
+    tls_session_zeroize(rec, sizeof(TLS_SESSION_REC_T) + rec->ticket_len);
+    tls_free(rec);
+
+    return (ret == 0);
+}
+
+void tls_session_update(MbedTLSSession *session)
+{
+    const mbedtls_ssl_session *ssn = session->ssl.session;
+    TLS_SESSION_REC_T *rec;
+    unsigned char check[8];
+    size_t ticket_len = 0;
+
+    if(ssn == TLS_NULL)
+        return;
+
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    if(ssn->ticket && (ssn->ticket_len <= TLS_SESSION_TICKET_MAX))
+        ticket_len = ssn->ticket_len;
+#endif
+    /* nothing to resume with */
+    if((ssn->id_len == 0) && (ticket_len == 0))
+        return;
+
+    rec = tls_malloc(sizeof(TLS_SESSION_REC_T) + ticket_len);
+    if(rec == TLS_NULL)
+        return;
+    memset(rec, 0, sizeof(TLS_SESSION_REC_T));
+
+    /* an abbreviated handshake keeps the master secret */
+    tls_session_check(ssn->master, check);
+    session->resumed = session->resume_offered
+                       && (memcmp(check, session->resume_check, sizeof(check)) == 0);
+
+    rec->magic = TLS_SESSION_MAGIC;
+    rec->host_hash = tls_session_hash(session->host, session->port);
+    rec->uses = session->resumed ? (session->resume_uses + 1) : 0;
+    rec->ticket_len = ticket_len;
+    rec->ciphersuite = ssn->ciphersuite;
+    rec->compression = ssn->compression;
+    rec->verify_result = ssn->verify_result;
+    rec->id_len = ssn->id_len;
+    memcpy(rec->id, ssn->id, sizeof(rec->id));
+    memcpy(rec->master, ssn->master, sizeof(rec->master));
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    if(ticket_len)
+    {
+        memcpy(&rec[1], ssn->ticket, ticket_len);
+        rec->ticket_lifetime = ssn->ticket_lifetime;
+    }
+#endif
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+    rec->mfl_code = ssn->mfl_code;
+#endif
+#if defined(MBEDTLS_SSL_TRUNCATED_HMAC)
+    rec->trunc_hmac = ssn->trunc_hmac;
+#endif
+#if defined(MBEDTLS_SSL_ENCRYPT_THEN_MAC)
+    rec->encrypt_then_mac = ssn->encrypt_then_mac;
+#endif
+
+    tls_printf("%s handshake, session stored\r\n", session->resumed ? "resumed" : "full");
+    tls_session_store(session, rec);
+
+    tls_session_zeroize(rec, sizeof(TLS_SESSION_REC_T) + ticket_len);
+    tls_free(rec);
+    tls_session_zeroize(session->resume_check, sizeof(session->resume_check));
+}
+
+void tls_session_forget(const char *host, const char *port)
+{
+    tls_session_blob_del(tls_session_hash(host, port));
+}
+#endif
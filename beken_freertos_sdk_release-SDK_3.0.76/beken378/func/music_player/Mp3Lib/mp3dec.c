@@ -322,6 +322,7 @@ static void  MP3ClearBadFrame(MP3DecInfo *mp3DecInfo, short *outbuf)
 
 
 #include "ff.h"
+#include "mp3_pipe.h"
 extern FIL *newFatfs;
 
 #define   BUF_CUTDOWN_DEBUG    os_printf
@@ -349,6 +350,10 @@ int  MP3_Get_ID3_Offset(unsigned char *buf, int nBytes)
 
 static int   file_read(unsigned char *buf, int size)
 {
+#if (CFG_MP3_PIPELINE == 1)
+	/* the reader task has the file, take the bytes it buffered */
+	return mp3_pipe_read(buf, size);
+#else
 	unsigned int readbytes=0;
 	int ret;
     if (newFatfs == NULL)
@@ -368,10 +373,14 @@ static int   file_read(unsigned char *buf, int size)
 		return FR_DISK_ERR;
 	
 	return FR_OK;
+#endif
 }
 
 static int  file_seek(int pos)
 {
+#if (CFG_MP3_PIPELINE == 1)
+	return mp3_pipe_seek(pos);
+#else
 	int ret;
 	if (newFatfs == NULL)
         return FR_NO_FILE;
@@ -381,6 +390,7 @@ static int  file_seek(int pos)
 		return ret;
 	
 	return(f_EOF(newFatfs));
+#endif
 }
 
 /**************************************************************************************
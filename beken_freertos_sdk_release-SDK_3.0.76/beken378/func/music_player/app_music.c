@@ -16,6 +16,7 @@
 #include "mp3common.h"
 #include "coder.h"
 #include "layer21.h"
+#include "mp3_pipe.h"
 
 MEDIA_CORE_T g_media_core = {0};
 
@@ -53,6 +54,10 @@ UINT8 play_derect = 0;   // 1:next, 0 :previous
 UINT8 appPlayerPlayMode=0;
 UINT8 media_playing_flag = 0;//current meida playing status
 FIL *newFatfs;
+#if (CFG_MP3_PIPELINE == 1)
+static MP3_PIPE_FRAME_T *pipe_frame = NULL;
+static UINT8 pipe_wait = 0;
+#endif
 
 static void app_player_mp3_file_end( void );
 static void app_player_process_file_end( void );
@@ -242,7 +247,21 @@ static int app_player_play_mp3_file( void )
 	if(aud_buff_full)
 		goto fill_aud_buff;
 
+#if (CFG_MP3_PIPELINE == 1)
+	/* the decoder task works ahead, only take what it has finished */
+	pipe_frame = mp3_pipe_get_frame();
+	pipe_wait = (pipe_frame == NULL);
+	if(pipe_frame == NULL)
+		return ERR_MP3_NONE;
+
+	err = pipe_frame->err;
+	pcm_size = pipe_frame->samples;
+	mp3FrameInfo = pipe_frame->info;
+	if(err != ERR_MP3_NONE)
+		mp3_pipe_put_frame();
+#else
 	err = MP3Decode(hMP3Decoder, mp3_pcm_ptr, &pcm_size);
+#endif
 	
 	if(err != ERR_MP3_NONE)
 	{	
@@ -251,7 +270,11 @@ static int app_player_play_mp3_file( void )
 
 			case ERR_MP3_INDATA_UNDERFLOW:
 			{
+#if (CFG_MP3_PIPELINE == 1)
+				if(mp3_pipe_eof())
+#else
 				if(f_EOF(newFatfs) == FR_FILE_END)
+#endif
 				{
 					APP_MUSIC_PRT("===file end====\r\n");
 					app_player_mp3_file_end();
@@ -293,6 +316,11 @@ static int app_player_play_mp3_file( void )
 			break;
 
 		}
+#if (CFG_MP3_PIPELINE == 1)
+		/* the decoder waited for the recovery above */
+		if(mp3_play_flag)
+			mp3_pipe_resume();
+#endif
 		APP_MUSIC_PRT("mp3 error retrun:%x,%x\r\n",app_player.player_flag & APP_PLAYER_FLAG_PLAY_PAUSE,app_player.schedule_cmd & 0xFFFF );
 		return err;
 	}
@@ -303,12 +331,19 @@ static int app_player_play_mp3_file( void )
 	{
 		if(t <= APP_PLAYER_AUDIO_INITION_BEGIN)
 		{
+#if (CFG_MP3_PIPELINE == 1)
+			t++;
+			mp3_pipe_put_frame();
+#else
 			if(mp3decinfo->decode_state == MP3_DECODE_FIND_SYNC_WORD)
 				t++;
+#endif
 			return ERR_MP3_NONE;
 		}
 		
+#if (CFG_MP3_PIPELINE == 0)
 		MP3GetLastFrameInfo(hMP3Decoder, &mp3FrameInfo); //ý
+#endif
 		APP_MUSIC_PRT("%dkb/s, ԭ%dHZ\r\n",
 		(mp3FrameInfo.bitrate)/1000,mp3FrameInfo.samprate);
 		APP_MUSIC_PRT("ԭ%d, MPAG:%d,:%d\r\n",
@@ -319,21 +354,32 @@ static int app_player_play_mp3_file( void )
 		aud_initial(mp3FrameInfo.samprate, 2, 16 );
 		init=1;	
 	}
+#if (CFG_MP3_PIPELINE == 1)
+	mp3_pcm_ptr_tmp = (UINT16 *)pipe_frame->pcm;
+#else
 	mp3_pcm_ptr_tmp = mp3_pcm_ptr;
 	MP3GetLastFrameInfo(hMP3Decoder, &mp3FrameInfo);
+#endif
 	if(mp3FrameInfo.nChans == 1)
 	{
-		Convert_Mono(mp3_pcm_ptr,pcm_size);
+		Convert_Mono((short *)mp3_pcm_ptr_tmp,pcm_size);
 		pcm_size <<= 1;
 	}
 	
 fill_aud_buff:
+#if (CFG_MP3_PIPELINE == 1)
+	if(is_aud_opened() && (aud_get_fill_size() == 0))
+		mp3_pipe_count_dry();
+#endif
 	buf_free = aud_get_buffer_size();
 	if(buf_free > pcm_size*2)
 	{
 		aud_fill_buffer((uint8*)mp3_pcm_ptr_tmp, pcm_size*2);
 		aud_buff_full = 0;
 		pcm_size = 0;
+#if (CFG_MP3_PIPELINE == 1)
+		mp3_pipe_put_frame();
+#endif
 	}
 	else 
 	{
@@ -389,13 +435,23 @@ static void app_player_play_pause( UINT8 play_pause  )
 					APP_MUSIC_PRT("mp3 memery initial unsucssed\r\n");
 				}
 				mp3_play_flag = 1;
+#if (CFG_MP3_PIPELINE == 1)
+				if(mp3decinfo && (mp3_pipe_start(hMP3Decoder, newFatfs) != 0))
+				{
+					APP_MUSIC_PRT("mp3 pipe start failed\r\n");
+					mp3_mem_uninit();
+				}
+#endif
 			}
 			else
 			{
+#if (CFG_MP3_PIPELINE == 0)
 				mp3decinfo->decode_state = MP3_DECODE_FIND_SYNC_WORD;
 				init = 0;
 				t = 0;
 				aud_buff_full = 0;
+#endif
+				/* with the pipeline the decoded frames stay valid across a pause */
 			}
 		}
 		else
@@ -552,8 +608,13 @@ static uint8 app_player_play_func( void )
 		}
 	}
 	app_player_process_schedule_cmd();
+#if (CFG_MP3_PIPELINE == 1)
+	if(aud_buff_full || pipe_wait)
+		return 1;
+#else
 	if(aud_buff_full)
 		return 1;
+#endif
 	else
 		return 0;
 }
@@ -568,6 +629,12 @@ static void app_player_mp3_file_end( void )
 	aud_buff_full = 0;
 	aud_close();
 	
+#if (CFG_MP3_PIPELINE == 1)
+	mp3_pipe_stop();
+	mp3_pipe_dump();
+	pipe_frame = NULL;
+	pipe_wait = 0;
+#endif
 	mp3_mem_uninit();
 	
 	rbbuf = NULL;
@@ -630,6 +697,9 @@ static void app_player_unload(void)
 	{
 		app_player_mp3_file_end();
 	}
+#if (CFG_MP3_PIPELINE == 1)
+	mp3_pipe_deinit();
+#endif
 	media_uninit();
 	memset( &app_player, 0, sizeof(app_player_ctrl) );
 }
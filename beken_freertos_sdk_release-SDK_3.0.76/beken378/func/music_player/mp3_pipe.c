@@ -0,0 +1,447 @@
+#include "include.h"
+#include "mp3_pipe.h"
+
+#if (CONFIG_APP_MP3PLAYER == 1) && (CFG_MP3_PIPELINE == 1)
+#include "arm_arch.h"
+#include "mem_pub.h"
+#include "uart_pub.h"
+#include "rtos_pub.h"
+
+/*
+ * The reader task keeps a byte ring of the file filled with sector sized
+ * reads, the decoder task pulls its input from that ring and decodes up to
+ * CFG_MP3_PIPE_FRAMES frames ahead, the media thread only copies finished
+ * frames into the audio ring. A frame with an error stops the decoder until
+ * the media thread has handled it, the recovery touches the decoder state.
+ */
+#define MP3_PIPE_RD_SIZE            CFG_MP3_PIPE_READ_BUF
+#define MP3_PIPE_RD_CHUNK           (4 * FF_MAX_SS)
+#define MP3_PIPE_FRAMES             CFG_MP3_PIPE_FRAMES
+#define MP3_PIPE_WAIT_MS            20
+
+#define MP3_PIPE_DEC_PRIORITY       (THD_MEDIA_PRIORITY + 1)
+#define MP3_PIPE_RD_PRIORITY        (THD_MEDIA_PRIORITY + 2)
+#define MP3_PIPE_DEC_STACK          4096
+#define MP3_PIPE_RD_STACK           2048
+
+#if (MP3_PIPE_RD_SIZE % FF_MAX_SS)
+#error "CFG_MP3_PIPE_READ_BUF must be a multiple of the sector size"
+#endif
+
+#define MP3_PIPE_PRT                os_printf
+
+typedef struct
+{
+    HMP3Decoder dec;
+    FIL *file;
+    volatile UINT8 run;
+
+    /* file bytes, written by the reader */
+    UINT8 *rd_buf;
+    UINT32 rd_wp;
+    UINT32 rd_rp;
+    volatile UINT32 rd_fill;
+    volatile UINT8 rd_eof;
+    volatile UINT8 rd_err;
+    volatile UINT8 rd_busy;
+    volatile int seek_pos;
+    int seek_res;
+
+    /* decoded frames, written by the decoder */
+    MP3_PIPE_FRAME_T *frame;
+    UINT32 frame_wr;
+    UINT32 frame_rd;
+    volatile UINT32 frame_cnt;
+    volatile UINT8 dec_hold;
+    volatile UINT8 dec_busy;
+
+    beken_semaphore_t rd_sem;
+    beken_semaphore_t data_sem;
+    beken_semaphore_t seek_sem;
+    beken_semaphore_t dec_sem;
+    beken_thread_t rd_thread;
+    beken_thread_t dec_thread;
+
+    MP3_PIPE_STATS_T stats;
+} MP3_PIPE_T;
+
+static MP3_PIPE_T mp3_pipe;
+
+static void mp3_pipe_drain(beken_semaphore_t *sem)
+{
+    while (rtos_get_semaphore(sem, 0) == kNoErr)
+        ;
+}
+
+static void mp3_pipe_reader(beken_thread_arg_t arg)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+    UINT32 len, space;
+    UINT br;
+    FRESULT res;
+    GLOBAL_INT_DECLARATION();
+
+    while (1)
+    {
+        rtos_get_semaphore(&p->rd_sem, BEKEN_WAIT_FOREVER);
+
+        while (1)
+        {
+            p->rd_busy = 1;
+            if (!p->run)
+                break;
+
+            if (p->seek_pos >= 0)
+            {
+                /* the decoder waits in mp3_pipe_seek, nobody reads the ring */
+                res = f_lseek(p->file, (FSIZE_t)p->seek_pos);
+                p->rd_wp = p->rd_rp = 0;
+                p->rd_fill = 0;
+                p->seek_res = (res != FR_OK) ? res : f_EOF(p->file);
+                p->rd_eof = (p->seek_res != FR_OK);
+                p->rd_err = (res != FR_OK);
+                p->seek_pos = -1;
+                rtos_set_semaphore(&p->seek_sem);
+                continue;
+            }
+
+            if (p->rd_eof)
+                break;
+
+            space = MP3_PIPE_RD_SIZE - p->rd_fill;
+            len = MP3_PIPE_RD_SIZE - p->rd_wp;
+            if (len > space)
+                len = space;
+            if (len > MP3_PIPE_RD_CHUNK)
+                len = MP3_PIPE_RD_CHUNK;
+            len &= ~(FF_MAX_SS - 1);
+            if (len == 0)
+                break;
+
+            br = 0;
+            res = f_read(p->file, p->rd_buf + p->rd_wp, len, &br);
+            if (res != FR_OK)
+            {
+                MP3_PIPE_PRT("mp3 pipe: read %d\r\n", res);
+                p->rd_err = 1;
+            }
+
+            p->rd_wp = (p->rd_wp + br) % MP3_PIPE_RD_SIZE;
+            GLOBAL_INT_DISABLE();
+            p->rd_fill += br;
+            GLOBAL_INT_RESTORE();
+            if (p->rd_err || (br < len) || (f_EOF(p->file) == FR_FILE_END))
+                p->rd_eof = 1;
+
+            rtos_set_semaphore(&p->data_sem);
+        }
+
+        p->rd_busy = 0;
+    }
+}
+
+static void mp3_pipe_decoder(beken_thread_arg_t arg)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+    MP3_PIPE_FRAME_T *f;
+    UINT32 t, bucket;
+    int err;
+    GLOBAL_INT_DECLARATION();
+
+    while (1)
+    {
+        rtos_get_semaphore(&p->dec_sem, BEKEN_WAIT_FOREVER);
+
+        while (1)
+        {
+            /* busy goes up before run is checked, mp3_pipe_stop relies on it */
+            p->dec_busy = 1;
+            if (!p->run || p->dec_hold || (p->frame_cnt >= MP3_PIPE_FRAMES))
+                break;
+
+            f = &p->frame[p->frame_wr];
+            t = rtos_get_time();
+            err = MP3Decode(p->dec, f->pcm, &f->samples);
+            t = rtos_get_time() - t;
+            if (!p->run)
+                break;
+
+            f->err = err;
+            if (err == ERR_MP3_NONE)
+            {
+                MP3GetLastFrameInfo(p->dec, &f->info);
+                bucket = t / MP3_PIPE_HIST_STEP_MS;
+                if (bucket >= MP3_PIPE_HIST_BUCKETS)
+                    bucket = MP3_PIPE_HIST_BUCKETS - 1;
+                p->stats.decode_ms[bucket]++;
+                p->stats.frames++;
+            }
+            else
+            {
+                p->dec_hold = 1;
+            }
+
+            p->frame_wr = (p->frame_wr + 1) % MP3_PIPE_FRAMES;
+            GLOBAL_INT_DISABLE();
+            p->frame_cnt++;
+            GLOBAL_INT_RESTORE();
+        }
+
+        p->dec_busy = 0;
+    }
+}
+
+/* undo a partial mp3_pipe_init, the reader is still parked on rd_sem */
+static void mp3_pipe_free_tasks(void)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+    beken_semaphore_t *sem[] = {&p->rd_sem, &p->data_sem, &p->seek_sem, &p->dec_sem};
+    UINT32 i;
+
+    if (p->rd_thread)
+    {
+        rtos_delete_thread(&p->rd_thread);
+        p->rd_thread = NULL;
+    }
+    if (p->dec_thread)
+    {
+        rtos_delete_thread(&p->dec_thread);
+        p->dec_thread = NULL;
+    }
+    for (i = 0; i < sizeof(sem) / sizeof(sem[0]); i++)
+    {
+        if (*sem[i])
+            rtos_deinit_semaphore(sem[i]);
+    }
+}
+
+static int mp3_pipe_init(void)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+
+    if (p->rd_buf == NULL)
+        p->rd_buf = (UINT8 *)os_malloc(MP3_PIPE_RD_SIZE);
+    if (p->frame == NULL)
+        p->frame = (MP3_PIPE_FRAME_T *)os_malloc(MP3_PIPE_FRAMES * sizeof(MP3_PIPE_FRAME_T));
+    if ((p->rd_buf == NULL) || (p->frame == NULL))
+    {
+        MP3_PIPE_PRT("mp3 pipe: no memory\r\n");
+        mp3_pipe_deinit();
+        return -1;
+    }
+
+    if (p->dec_thread)
+        return 0;
+
+    if ((rtos_init_semaphore(&p->rd_sem, 1) != kNoErr)
+            || (rtos_init_semaphore(&p->data_sem, 1) != kNoErr)
+            || (rtos_init_semaphore(&p->seek_sem, 1) != kNoErr)
+            || (rtos_init_semaphore(&p->dec_sem, 1) != kNoErr))
+    {
+        MP3_PIPE_PRT("mp3 pipe: semaphore failed\r\n");
+        mp3_pipe_free_tasks();
+        return -1;
+    }
+
+    if ((rtos_create_thread(&p->rd_thread, MP3_PIPE_RD_PRIORITY, "mp3_rd",
+                            (beken_thread_function_t)mp3_pipe_reader,
+                            MP3_PIPE_RD_STACK, (beken_thread_arg_t)0) != kNoErr)
+            || (rtos_create_thread(&p->dec_thread, MP3_PIPE_DEC_PRIORITY, "mp3_dec",
+                                   (beken_thread_function_t)mp3_pipe_decoder,
+                                   MP3_PIPE_DEC_STACK, (beken_thread_arg_t)0) != kNoErr))
+    {
+        MP3_PIPE_PRT("mp3 pipe: thread failed\r\n");
+        mp3_pipe_free_tasks();
+        return -1;
+    }
+
+    return 0;
+}
+
+int mp3_pipe_start(HMP3Decoder dec, FIL *file)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+
+    mp3_pipe_stop();
+    if ((dec == NULL) || (file == NULL) || (mp3_pipe_init() != 0))
+        return -1;
+
+    p->dec = dec;
+    p->file = file;
+    p->rd_wp = p->rd_rp = 0;
+    p->rd_fill = 0;
+    p->rd_eof = 0;
+    p->rd_err = 0;
+    p->seek_pos = -1;
+    p->frame_wr = p->frame_rd = 0;
+    p->frame_cnt = 0;
+    p->dec_hold = 0;
+    os_memset(&p->stats, 0, sizeof(p->stats));
+
+    mp3_pipe_drain(&p->data_sem);
+    mp3_pipe_drain(&p->seek_sem);
+
+    p->run = 1;
+    rtos_set_semaphore(&p->rd_sem);
+    rtos_set_semaphore(&p->dec_sem);
+
+    return 0;
+}
+
+/* returns once neither task touches the file or the decoder any more */
+void mp3_pipe_stop(void)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+
+    if (!p->run)
+        return;
+
+    p->run = 0;
+    rtos_set_semaphore(&p->data_sem);
+    rtos_set_semaphore(&p->seek_sem);
+    while (p->rd_busy || p->dec_busy)
+        rtos_delay_milliseconds(1);
+}
+
+void mp3_pipe_deinit(void)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+
+    mp3_pipe_stop();
+    if (p->rd_buf)
+    {
+        os_free(p->rd_buf);
+        p->rd_buf = NULL;
+    }
+    if (p->frame)
+    {
+        os_free(p->frame);
+        p->frame = NULL;
+    }
+}
+
+MP3_PIPE_FRAME_T *mp3_pipe_get_frame(void)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+
+    if (p->frame_cnt == 0)
+    {
+        if (p->run && !p->dec_hold)
+            p->stats.frame_wait++;
+        return NULL;
+    }
+
+    return &p->frame[p->frame_rd];
+}
+
+void mp3_pipe_put_frame(void)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+    GLOBAL_INT_DECLARATION();
+
+    if (p->frame_cnt == 0)
+        return;
+
+    p->frame_rd = (p->frame_rd + 1) % MP3_PIPE_FRAMES;
+    GLOBAL_INT_DISABLE();
+    p->frame_cnt--;
+    GLOBAL_INT_RESTORE();
+    rtos_set_semaphore(&p->dec_sem);
+}
+
+void mp3_pipe_resume(void)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+
+    if (!p->run)
+        return;
+
+    p->dec_hold = 0;
+    rtos_set_semaphore(&p->dec_sem);
+}
+
+int mp3_pipe_eof(void)
+{
+    return mp3_pipe.rd_eof && (mp3_pipe.rd_fill == 0);
+}
+
+void mp3_pipe_count_dry(void)
+{
+    mp3_pipe.stats.dac_dry++;
+}
+
+void mp3_pipe_dump(void)
+{
+    MP3_PIPE_STATS_T *s = &mp3_pipe.stats;
+    int i;
+
+    MP3_PIPE_PRT("mp3 pipe: %d frames, in_wait %d, frame_wait %d, dac_dry %d\r\n",
+                 s->frames, s->in_wait, s->frame_wait, s->dac_dry);
+    MP3_PIPE_PRT("mp3 pipe: decode ms");
+    for (i = 0; i < MP3_PIPE_HIST_BUCKETS; i++)
+        MP3_PIPE_PRT(" <%d:%d", (i + 1) * MP3_PIPE_HIST_STEP_MS, s->decode_ms[i]);
+    MP3_PIPE_PRT("\r\n");
+}
+
+int mp3_pipe_read(unsigned char *buf, int size)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+    UINT32 n;
+    GLOBAL_INT_DECLARATION();
+
+    while (size > 0)
+    {
+        if (!p->run)
+            return FR_DISK_ERR;
+
+        n = p->rd_fill;
+        if (n == 0)
+        {
+            if (p->rd_eof)
+                return p->rd_err ? FR_DISK_ERR : FR_FILE_END;
+
+            p->stats.in_wait++;
+            rtos_get_semaphore(&p->data_sem, MP3_PIPE_WAIT_MS);
+            continue;
+        }
+
+        if (n > size)
+            n = size;
+        if (n > MP3_PIPE_RD_SIZE - p->rd_rp)
+            n = MP3_PIPE_RD_SIZE - p->rd_rp;
+
+        os_memcpy(buf, p->rd_buf + p->rd_rp, n);
+        p->rd_rp = (p->rd_rp + n) % MP3_PIPE_RD_SIZE;
+        GLOBAL_INT_DISABLE();
+        p->rd_fill -= n;
+        GLOBAL_INT_RESTORE();
+        buf += n;
+        size -= n;
+
+        rtos_set_semaphore(&p->rd_sem);
+    }
+
+    if (p->rd_eof && (p->rd_fill == 0))
+        return FR_FILE_END;
+
+    return FR_OK;
+}
+
+int mp3_pipe_seek(int pos)
+{
+    MP3_PIPE_T *p = &mp3_pipe;
+
+    p->seek_pos = pos;
+    rtos_set_semaphore(&p->rd_sem);
+    while (rtos_get_semaphore(&p->seek_sem, MP3_PIPE_WAIT_MS) != kNoErr)
+    {
+        if (!p->run)
+            return FR_DISK_ERR;
+    }
+
+    if (!p->run)
+        return FR_DISK_ERR;
+
+    return p->seek_res;
+}
+#endif // (CONFIG_APP_MP3PLAYER == 1) && (CFG_MP3_PIPELINE == 1)
@@ -0,0 +1,49 @@
+#ifndef _MP3_PIPE_H_
+#define _MP3_PIPE_H_
+
+#include "include.h"
+
+#if (CONFIG_APP_MP3PLAYER == 1) && (CFG_MP3_PIPELINE == 1)
+#include "ff.h"
+#include "mp3dec.h"
+
+#define MP3_PIPE_FRAME_SAMPLES      (MAX_NCHAN * MAX_NGRAN * MAX_NSAMP)
+#define MP3_PIPE_HIST_BUCKETS       8
+#define MP3_PIPE_HIST_STEP_MS       4
+
+typedef struct
+{
+    int err;                    /* MP3Decode result */
+    int samples;                /* pcm samples, as returned in pcm_size */
+    MP3FrameInfo info;
+    short pcm[MP3_PIPE_FRAME_SAMPLES];
+} MP3_PIPE_FRAME_T;
+
+typedef struct
+{
+    UINT32 in_wait;             /* decoder waited for file data */
+    UINT32 frame_wait;          /* player found no decoded frame */
+    UINT32 dac_dry;             /* audio ring ran empty while playing */
+    UINT32 frames;
+    UINT32 decode_ms[MP3_PIPE_HIST_BUCKETS];
+} MP3_PIPE_STATS_T;
+
+/* reader and decoder tasks ahead of the media thread, file is newFatfs */
+int mp3_pipe_start(HMP3Decoder dec, FIL *file);
+void mp3_pipe_stop(void);
+void mp3_pipe_deinit(void);
+
+/* media thread side */
+MP3_PIPE_FRAME_T *mp3_pipe_get_frame(void);
+void mp3_pipe_put_frame(void);
+void mp3_pipe_resume(void);
+int mp3_pipe_eof(void);
+void mp3_pipe_count_dry(void);
+void mp3_pipe_dump(void);
+
+/* decoder side, same results as the file_read/file_seek they replace */
+int mp3_pipe_read(unsigned char *buf, int size);
+int mp3_pipe_seek(int pos);
+#endif
+
+#endif // _MP3_PIPE_H_
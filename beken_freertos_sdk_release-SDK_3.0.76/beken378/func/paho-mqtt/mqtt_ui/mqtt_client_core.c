@@ -335,39 +335,103 @@ static void NewMessageData(MessageData *md, MQTTString *aTopicName, MQTTMessage
     md->message = aMessage;
 }
 
+static void mqtt_sub_trie_free(struct mqtt_client_session *cs)
+{
+	mqtt_topic_trie_free(cs->sub_trie.root);
+	cs->sub_trie.root = NULL;
+	cs->sub_trie.handlers = NULL;
+	cs->sub_trie.num = 0;
+}
+
+/* (re)compile the subscription table when the application replaced it */
+static struct mqtt_topic_node *mqtt_sub_trie_get(struct mqtt_client_session *cs)
+{
+	struct sub_msg_handlers *sub = cs->sub.messageHandlers;
+	int i;
+
+	if(cs->sub_trie.root
+		&& cs->sub_trie.handlers == sub
+		&& cs->sub_trie.num == cs->sub.sub_topic_num)
+	{
+		return cs->sub_trie.root;
+	}
+
+	mqtt_sub_trie_free(cs);
+	for (i = 0; sub && i < cs->sub.sub_topic_num; ++i)
+	{
+		if (sub[i].topicFilter == NULL)
+			continue;
+
+		if (mqtt_topic_trie_add(&cs->sub_trie.root, sub[i].topicFilter, i) != 0)
+		{
+			TMQTT_LOG("sub trie no memory\r\n");
+			mqtt_sub_trie_free(cs);
+			return NULL;
+		}
+	}
+	cs->sub_trie.handlers = sub;
+	cs->sub_trie.num = cs->sub.sub_topic_num;
+
+	return cs->sub_trie.root;
+}
+
+struct deliver_ctx
+{
+	struct mqtt_client_session *cs;
+	MessageData md;
+	int rc;
+};
+
+static void deliverMatched(void *arg, unsigned short index)
+{
+	struct deliver_ctx *ctx = (struct deliver_ctx *)arg;
+	struct sub_msg_handlers *sub = &ctx->cs->sub.messageHandlers[index];
+
+	if (sub->callback != NULL)
+	{
+		sub->callback(ctx->cs, &ctx->md);
+		ctx->rc = PAHO_SUCCESS;
+	}
+}
+
 static int deliverMessage(struct mqtt_client_session *cs, MQTTString *topicName, MQTTMessage *message)
 {
     int i;
-    int rc = PAHO_FAILURE;
 	struct sub_msg_handlers *sub;
+	struct mqtt_topic_node *root;
+	struct deliver_ctx ctx;
 
 	ASSERT(cs);
-	sub = cs->sub.messageHandlers;
-    // we have to find the right message handler - indexed by topic
-    for (i = 0; i < cs->sub.sub_topic_num; ++i)
-    {
-        if (sub[i].topicFilter != 0 && (MQTTPacket_equals(topicName, (char *)sub[i].topicFilter) ||
-                isTopicMatched((char *)sub[i].topicFilter, topicName)))
-        {
-            if (sub[i].callback != NULL)
-            {
-                MessageData md;
-                NewMessageData(&md, topicName, message);
-                sub[i].callback(cs,&md);
-                rc = PAHO_SUCCESS;
-            }
-        }
-    }
+	ctx.cs = cs;
+	ctx.rc = PAHO_FAILURE;
+	NewMessageData(&ctx.md, topicName, message);
+
+	root = mqtt_sub_trie_get(cs);
+	if (root != NULL && topicName->lenstring.data != NULL)
+	{
+		mqtt_topic_trie_match(root, topicName->lenstring.data, topicName->lenstring.len, deliverMatched, &ctx);
+	}
+	else
+	{
+		// no trie (no memory), check every filter
+		sub = cs->sub.messageHandlers;
+		for (i = 0; i < cs->sub.sub_topic_num; ++i)
+		{
+			if (sub[i].topicFilter != 0 && (MQTTPacket_equals(topicName, (char *)sub[i].topicFilter) ||
+					isTopicMatched((char *)sub[i].topicFilter, topicName)))
+			{
+				deliverMatched(&ctx, i);
+			}
+		}
+	}
 
-    if (rc == PAHO_FAILURE && cs->defaultMessageHandler != NULL)
+    if (ctx.rc == PAHO_FAILURE && cs->defaultMessageHandler != NULL)
     {
-        MessageData md;
-        NewMessageData(&md, topicName, message);
-        cs->defaultMessageHandler(cs, &md);
-        rc = PAHO_SUCCESS;
+        cs->defaultMessageHandler(cs, &ctx.md);
+        ctx.rc = PAHO_SUCCESS;
     }
 
-    return rc;
+    return ctx.rc;
 }
 
 static int MQTT_cycle(struct mqtt_client_session *cs)
@@ -486,171 +550,263 @@ _mqtt_disconnect:
 	return MQTT_ERR;
 }
 
-static int mqtt_send_publish(struct mqtt_client_session *cs,mqtt_msg_queue_t *mqt)
+static mqtt_msg_queue_t *mqtt_pub_queue_pop(struct mqtt_client_session *cs)
+{
+	mqtt_msg_queue_t *mqt = NULL;
+
+	rtos_enter_critical();
+	if(!list_empty( &cs->msg_hd ))
+	{
+		mqt = list_entry(cs->msg_hd.next,struct mqtt_msg_queue,node);
+		list_del_init(&mqt->node);
+	}
+	rtos_exit_critical();
+
+	return mqt;
+}
+
+static int mqtt_serialize_publish(MQTTMessage *message, MQTTString topic, unsigned char *buf, int buf_len)
+{
+	return MQTTSerialize_publish(buf, buf_len, 0, message->qos, message->retained, message->id,
+                                topic, (unsigned char *)message->payload, message->payloadlen);
+}
+
+/*
+ * Drain up to MQTT_PUB_BATCH_MAX queued publish messages. They are serialized
+ * back to back into cs->buf and go out in one send, a message that does not
+ * fit behind the others flushes the buffer first.
+ */
+static int mqtt_send_publish_batch(struct mqtt_client_session *cs)
 {
     MQTTMessage message;
     MQTTString topic = MQTTString_initializer;
-	char *data = NULL;
-	int len,rc;
-	
-	if(cs == NULL || mqt == NULL)
-		return MQTT_ERR;
-	data = mqt->msg;
-	if(data == NULL)
-		return MQTT_ERR;
+	mqtt_msg_queue_t *mqt;
+	int off = 0, num = 0;
+	int len, rc = MQTT_OK;
+
+	while (num < MQTT_PUB_BATCH_MAX)
+	{
+		mqt = mqtt_pub_queue_pop(cs);
+		if(mqt == NULL)
+			break;
+		num ++;
+
+		if(mqt->type != PUB_SD || mqt->msg == NULL)
+		{
+			os_free(mqt);
+			continue;
+		}
 
-	memcpy(&message,data,sizeof(MQTTMessage));
-    message.payload = data + sizeof(MQTTMessage);
-    topic.cstring = (char *)data + sizeof(MQTTMessage) + message.payloadlen;
+		memcpy(&message,mqt->msg,sizeof(MQTTMessage));
+	    message.payload = mqt->msg + sizeof(MQTTMessage);
+	    topic.cstring = (char *)mqt->msg + sizeof(MQTTMessage) + message.payloadlen;
 
-	if (message.qos == QOS1 || message.qos == QOS2)
+		if (message.qos == QOS1 || message.qos == QOS2)
+		{
+			message.id = get_mqtt_next_packet_id(cs);
+		}
+
+		len = mqtt_serialize_publish(&message, topic, cs->buf + off, cs->buf_size - off);
+		if (len <= 0 && off > 0)
+		{
+			if (mqtt_send_packet(cs, off, cs->command_timeout_ms) != PAHO_SUCCESS)
+			{
+				rc = MQTT_ERR;
+			}
+			off = 0;
+			len = mqtt_serialize_publish(&message, topic, cs->buf, cs->buf_size);
+		}
+
+		if (len <= 0)
+		{
+			TMQTT_LOG("mqtt_send_publish %s larger than buf, drop\r\n", topic.cstring);
+		}
+		else
+		{
+			off += len;
+		}
+		os_free(mqt);
+	}
+
+	if (off > 0 && mqtt_send_packet(cs, off, cs->command_timeout_ms) != PAHO_SUCCESS)
 	{
-		message.id = get_mqtt_next_packet_id(cs);
+		rc = MQTT_ERR;
 	}
 
-    len = MQTTSerialize_publish(cs->buf, cs->buf_size, 0, message.qos, message.retained, message.id,
-                                topic, (unsigned char *)message.payload, message.payloadlen);
-    if (len <= 0)
-    {
-        goto exit;
-    }
+	if (rc != MQTT_OK)
+	{
+		TMQTT_LOG("mqtt_send_publish sendPacket failed\r\n");
+	}
 
-    if ((rc = mqtt_send_packet(cs, len,cs->command_timeout_ms)) != PAHO_SUCCESS) // send the subscribe packet
-    {
-        TMQTT_LOG("mqtt_send_publish sendPacket rc: %d", rc);
-        goto exit;
-    }
-	
-	return MQTT_OK;
-exit:
-	TMQTT_LOG("mqtt_send_publish sendPacket failed\r\n");
-	return MQTT_ERR;
+	return rc;
 }
 
-void mqtt_core_handler(void)
+static void mqtt_session_drop(struct mqtt_client_session *cs)
+{
+	mqtt_client_send_disconnect_packet(cs);
+	mqtt_net_disconnect(cs);
+}
+
+static void mqtt_session_keepalive(struct mqtt_client_session *cs)
 {
-    int res;
-    fd_set readset;
-    struct timeval timeout;
-	struct mqtt_client_session *cs = NULL;
-	LIST_HEADER_T *node;
 	int len, rc;
-	mqtt_msg_queue_t *mqt = NULL;
 
-	rtos_enter_critical();
-	if(list_empty( &mqtt_hd))
+	if(cs->tick_ping + cs->keepAliveInterval > rtos_get_time())
 	{
-		rtos_exit_critical();
 		return;
 	}
-	node = mqtt_hd.next;
-	cs = list_entry(node,struct mqtt_client_session,node);
-	rtos_exit_critical();
-	if(cs == NULL)
+
+	len = MQTTSerialize_pingreq(cs->buf, cs->buf_size);
+	rc = mqtt_send_packet(cs, len,cs->command_timeout_ms);
+	if (rc != 0)
 	{
+		TMQTT_LOG("[%d] send ping rc: %d \n", rtos_get_time(), rc);
+		mqtt_session_drop(cs);
 		return;
 	}
-	
+	cs->tick_ping = rtos_get_time();
+}
+
+/* lock a session of the snapshot, NULL if it is busy or has left the list meanwhile */
+static struct mqtt_client_session *mqtt_session_acquire(struct mqtt_client_session *cs)
+{
+	int listed;
+
 	if(mqtt_senssion_lock(cs->lock,MQTT_LOCK_NO_WAIT) != MQTT_OK)
 	{
-		return;
+		return NULL;
 	}
-	
-	if((cs->is_connected == 0)
-		||(cs->net_is_connected == 0))
+
+	rtos_enter_critical();
+	listed = !list_empty( &cs->node );
+	rtos_exit_critical();
+
+	if(!listed)
 	{
-		rtos_enter_critical();
-		if(!list_empty( &cs->node))
-		{
-			list_del_init( &cs->node );
-		}
-		rtos_exit_critical();
-		goto exit;
+		mqtt_senssion_unlock(cs->lock);
+		return NULL;
 	}
-	
-    rtos_enter_critical();
-	if(!list_empty( &cs->msg_hd ))
+
+	return cs;
+}
+
+/*
+ * One round over every connected session: send their queued publish
+ * messages, wait on all sockets with a single select and service the
+ * readable ones, then ping the idle ones. The list head is rotated each
+ * round so sessions past MQTT_CORE_SESSION_MAX get their turn too.
+ */
+void mqtt_core_handler(void)
+{
+    int res, i, num = 0, maxfd = -1;
+    fd_set readset;
+    struct timeval timeout;
+	struct mqtt_client_session *ses[MQTT_CORE_SESSION_MAX];
+	struct mqtt_client_session *cs;
+	LIST_HEADER_T *node;
+
+	rtos_enter_critical();
+	for(node = mqtt_hd.next; node != &mqtt_hd && num < MQTT_CORE_SESSION_MAX; node = node->next)
 	{
-		node = cs->msg_hd.next;
-		mqt = list_entry(node,struct mqtt_msg_queue,node);
-		list_del_init(&mqt->node);
-		node = NULL;
+		ses[num ++] = list_entry(node,struct mqtt_client_session,node);
 	}
-	else
+	if(num > 0)
 	{
-		mqt = NULL;
+		list_move_tail(mqtt_hd.next, &mqtt_hd);
 	}
 	rtos_exit_critical();
 
-	if(mqt != NULL)
+	if(num == 0)
+	{
+		return;
+	}
+
+	FD_ZERO(&readset);
+	for(i = 0; i < num; i ++)
 	{
-		if(mqt->type == PUB_SD)
+		cs = mqtt_session_acquire(ses[i]);
+		if(cs == NULL)
 		{
-			mqtt_send_publish(cs,mqt);
+			ses[i] = NULL;
+			continue;
 		}
-		
-		if(mqt != NULL)
+
+		if((cs->is_connected == 0)
+			||(cs->net_is_connected == 0))
 		{
-			os_free(mqt);
-			mqt = NULL;
+			rtos_enter_critical();
+			list_del_init( &cs->node );
+			rtos_exit_critical();
+			mqtt_senssion_unlock(cs->lock);
+			ses[i] = NULL;
+			continue;
 		}
+
+		mqtt_send_publish_batch(cs);
+
+		if(cs->net_is_connected && cs->netport.socket >= 0)
+		{
+			FD_SET(cs->netport.socket, &readset);
+			maxfd = (cs->netport.socket > maxfd) ? cs->netport.socket : maxfd;
+		}
+		mqtt_senssion_unlock(cs->lock);
+	}
+
+	if(maxfd < 0)
+	{
+		return;
 	}
 
     timeout.tv_sec = 0;
     timeout.tv_usec = 2000;
-	do
+	res = select(maxfd + 1, &readset, NULL, NULL, &timeout);
+	if (res < 0)
+	{
+		TMQTT_LOG("select res: %d\n", res);
+	}
+
+	for(i = 0; i < num; i ++)
 	{
-	    FD_ZERO(&readset);
-	    FD_SET(cs->netport.socket, &readset);
+		if(ses[i] == NULL)
+			continue;
 
-	    /* int select(maxfdp1, readset, writeset, exceptset, timeout); */
-	    res = select(cs->netport.socket + 1, &readset, NULL, NULL, &timeout);
-	    if (res == 0)
-	    {
-	    	if(cs->tick_ping + cs->keepAliveInterval <= rtos_get_time())
-			{
-		        len = MQTTSerialize_pingreq(cs->buf, cs->buf_size);
-		        rc = mqtt_send_packet(cs, len,cs->command_timeout_ms);
-		        if (rc != 0)
-		        {
-		            TMQTT_LOG("[%d] send ping rc: %d \n", rtos_get_time(), rc);
-					mqtt_client_send_disconnect_packet(cs);
-					mqtt_net_disconnect(cs);
-		            break;
-		        }
-				cs->tick_ping = rtos_get_time();
-				break;
-	    	}
-			else
+		cs = mqtt_session_acquire(ses[i]);
+		if(cs == NULL)
+			continue;
+
+		if(cs->net_is_connected == 0 || cs->netport.socket < 0)
+		{
+			mqtt_senssion_unlock(cs->lock);
+			continue;
+		}
+
+		if (res < 0)
+		{
+			fd_set one;
+			struct timeval now = {0, 0};
+
+			/* find the session whose socket made select fail */
+			FD_ZERO(&one);
+			FD_SET(cs->netport.socket, &one);
+			if(select(cs->netport.socket + 1, &one, NULL, NULL, &now) < 0)
 			{
-				break;
-	    	}
-	   } /* res == 0: timeount for ping. */
-	   else if (res < 0)
-	   {
-	        TMQTT_LOG("select res: %d\n", res);
-			mqtt_client_send_disconnect_packet(cs);
-			mqtt_net_disconnect(cs);
-	        break;
-	   }
-	   
-	    if (FD_ISSET(cs->netport.socket, &readset))
-	    {
-	    	int rc_t;
-	        ////TMQTT_LOG("sock FD_ISSET\r\n");
-	        rc_t = MQTT_cycle(cs);
-	        ///TMQTT_LOG("sock FD_ISSET rc_t : %d\r\n", rc_t);
-	        if (rc_t < 0)  
+				mqtt_session_drop(cs);
+			}
+		}
+		else if (res > 0 && FD_ISSET(cs->netport.socket, &readset))
+		{
+	        if (MQTT_cycle(cs) < 0)
 			{
-				mqtt_client_send_disconnect_packet(cs);
-				mqtt_net_disconnect(cs);
-            	break;
+				mqtt_session_drop(cs);
 	        }
 	    }
-	}while(0);
-		
-exit:
-	mqtt_senssion_unlock(cs->lock);
+		else
+		{
+			mqtt_session_keepalive(cs);
+		}
+
+		mqtt_senssion_unlock(cs->lock);
+	}
 }
 
 int matt_client_connect(mqtt_client_session* cs, MQTTPacket_connectData* options)
@@ -730,6 +886,7 @@ int matt_client_connect(mqtt_client_session* cs, MQTTPacket_connectData* options
 		goto exit;
     }
 	ret = mqtt_client_subscribe_handler( cs );
+	mqtt_sub_trie_get( cs );
 	if (cs->online_callback)
 	{
 		cs->online_callback(cs);
@@ -917,6 +1074,7 @@ int mqtt_client_session_deinit(mqtt_client_session* cs)
 	rtos_exit_critical();
 	
 	mqtt_net_disconnect(cs);
+	mqtt_sub_trie_free(cs);
 	
 	return MQTT_OK;
 }
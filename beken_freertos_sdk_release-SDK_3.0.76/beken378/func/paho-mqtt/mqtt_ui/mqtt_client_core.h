@@ -5,6 +5,7 @@
 
 #include "include.h"
 #include "doubly_list.h"
+#include "mqtt_topic_trie.h"
 
 #define MAX_PACKET_ID           65535 /* according to the MQTT specification - do not change! */
 
@@ -15,6 +16,13 @@
 #define MQTT_DEFUALT_BUF_SIZE                  (512)
 #define MQTT_DEF_CMD_TIMEOUT_MS                (6000)
 
+#if !defined(MQTT_CORE_SESSION_MAX)
+#define MQTT_CORE_SESSION_MAX                  (8)   ///sessions served per mqtt_core_handler round
+#endif
+#if !defined(MQTT_PUB_BATCH_MAX)
+#define MQTT_PUB_BATCH_MAX                     (8)   ///queued publish packets coalesced into one send
+#endif
+
 
 #if !defined(MAX_MESSAGE_HANDLERS)
 #define MAX_MESSAGE_HANDLERS 5 /* redefinable - how many subscriptions do you want? */
@@ -134,6 +142,12 @@ struct mqtt_client_session
    void (*defaultMessageHandler)(mqtt_client_session *, MessageData *);
 
    LIST_HEADER_T msg_hd;
+
+	struct{
+		struct mqtt_topic_node *root;           ///compiled from sub.messageHandlers
+		struct sub_msg_handlers *handlers;
+		unsigned short num;
+	}sub_trie;
 } ;
 
 
@@ -151,6 +165,7 @@ extern int mqtt_client_disconnect(mqtt_client_session* cs);
 extern int mqtt_client_session_init(mqtt_client_session* cs);
 extern int mqtt_client_session_init2(mqtt_client_session* cs,unsigned char *send_buf,
 					unsigned int sdb_len,unsigned char *read_buf,unsigned int rdb_len);
+extern int mqtt_client_session_deinit(mqtt_client_session* cs);
 
 
 extern int mqtt_net_connect(mqtt_client_session* cs,char *host,int port);
@@ -0,0 +1,213 @@
+#include "include.h"
+#include "mem_pub.h"
+#include "mqtt_topic_trie.h"
+
+#include <string.h>
+
+struct mqtt_topic_node
+{
+	struct mqtt_topic_node *child;      // literal levels below this one
+	struct mqtt_topic_node *sibling;
+	struct mqtt_topic_node *plus;       // '+' below this one
+	struct mqtt_topic_node *hash;       // '#' below this one
+	unsigned short *handlers;           // indexes of the filters ending here
+	unsigned short handler_num;
+	unsigned short len;
+	char level[1];
+};
+
+static struct mqtt_topic_node *mqtt_topic_node_new(const char *level, int len)
+{
+	struct mqtt_topic_node *node;
+
+	node = os_zalloc(sizeof(struct mqtt_topic_node) + len);
+	if(node == NULL)
+	{
+		return NULL;
+	}
+	node->len = len;
+	memcpy(node->level, level, len);
+	node->level[len] = '\0';
+
+	return node;
+}
+
+static struct mqtt_topic_node *mqtt_topic_node_get(struct mqtt_topic_node *parent, const char *level, int len)
+{
+	struct mqtt_topic_node **slot;
+	struct mqtt_topic_node *node;
+
+	if(len == 1 && level[0] == '+')
+	{
+		slot = &parent->plus;
+	}
+	else if(len == 1 && level[0] == '#')
+	{
+		slot = &parent->hash;
+	}
+	else
+	{
+		for(node = parent->child; node; node = node->sibling)
+		{
+			if(node->len == len && memcmp(node->level, level, len) == 0)
+			{
+				return node;
+			}
+		}
+		node = mqtt_topic_node_new(level, len);
+		if(node)
+		{
+			node->sibling = parent->child;
+			parent->child = node;
+		}
+		return node;
+	}
+
+	if(*slot == NULL)
+	{
+		*slot = mqtt_topic_node_new(level, len);
+	}
+	return *slot;
+}
+
+/* add one filter, several filters may share a node */
+int mqtt_topic_trie_add(struct mqtt_topic_node **root, const char *filter, unsigned short index)
+{
+	struct mqtt_topic_node *node;
+	unsigned short *handlers;
+	const char *level, *sep;
+
+	if(root == NULL || filter == NULL)
+	{
+		return -1;
+	}
+
+	if(*root == NULL)
+	{
+		*root = mqtt_topic_node_new("", 0);
+		if(*root == NULL)
+		{
+			return -1;
+		}
+	}
+
+	node = *root;
+	level = filter;
+	do
+	{
+		sep = strchr(level, '/');
+		node = mqtt_topic_node_get(node, level, sep ? (sep - level) : (int)strlen(level));
+		if(node == NULL)
+		{
+			return -1;
+		}
+		level = sep + 1;
+	}while(sep);
+
+	handlers = os_malloc((node->handler_num + 1) * sizeof(unsigned short));
+	if(handlers == NULL)
+	{
+		return -1;
+	}
+	if(node->handlers)
+	{
+		memcpy(handlers, node->handlers, node->handler_num * sizeof(unsigned short));
+		os_free(node->handlers);
+	}
+	handlers[node->handler_num ++] = index;
+	node->handlers = handlers;
+
+	return 0;
+}
+
+static int mqtt_topic_node_report(struct mqtt_topic_node *node, mqtt_topic_match_cb cb, void *arg)
+{
+	int i;
+
+	for(i = 0; i < node->handler_num; i ++)
+	{
+		cb(arg, node->handlers[i]);
+	}
+
+	return node->handler_num;
+}
+
+/*
+ * node matched the topic up to level, level is NULL once the topic is used
+ * up. Wildcards at the first level never match topics starting with '$'.
+ */
+static int mqtt_topic_node_match(struct mqtt_topic_node *node, const char *level, const char *end,
+					int wild, mqtt_topic_match_cb cb, void *arg)
+{
+	struct mqtt_topic_node *child;
+	const char *sep, *next;
+	int len, matched = 0;
+
+	/* '#' also matches its parent level */
+	if(node->hash && wild)
+	{
+		matched += mqtt_topic_node_report(node->hash, cb, arg);
+	}
+
+	if(level == NULL)
+	{
+		return matched + mqtt_topic_node_report(node, cb, arg);
+	}
+
+	sep = memchr(level, '/', end - level);
+	len = sep ? (sep - level) : (end - level);
+	next = sep ? (sep + 1) : NULL;
+
+	for(child = node->child; child; child = child->sibling)
+	{
+		if(child->len == len && memcmp(child->level, level, len) == 0)
+		{
+			matched += mqtt_topic_node_match(child, next, end, 1, cb, arg);
+			break;
+		}
+	}
+
+	if(node->plus && wild)
+	{
+		matched += mqtt_topic_node_match(node->plus, next, end, 1, cb, arg);
+	}
+
+	return matched;
+}
+
+/* call cb for the index of every filter matching topic, returns the number of matches */
+int mqtt_topic_trie_match(struct mqtt_topic_node *root, const char *topic, int len,
+					mqtt_topic_match_cb cb, void *arg)
+{
+	if(root == NULL || topic == NULL || len <= 0)
+	{
+		return 0;
+	}
+
+	return mqtt_topic_node_match(root, topic, topic + len, topic[0] != '$', cb, arg);
+}
+
+void mqtt_topic_trie_free(struct mqtt_topic_node *root)
+{
+	struct mqtt_topic_node *child, *next;
+
+	if(root == NULL)
+	{
+		return;
+	}
+
+	for(child = root->child; child; child = next)
+	{
+		next = child->sibling;
+		mqtt_topic_trie_free(child);
+	}
+	mqtt_topic_trie_free(root->plus);
+	mqtt_topic_trie_free(root->hash);
+
+	if(root->handlers)
+	{
+		os_free(root->handlers);
+	}
+	os_free(root);
+}
+// eof
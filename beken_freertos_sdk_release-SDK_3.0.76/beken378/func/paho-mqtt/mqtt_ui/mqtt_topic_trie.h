@@ -0,0 +1,19 @@
+#ifndef _MQTT_TOPIC_TRIE_H__
+#define _MQTT_TOPIC_TRIE_H__
+
+/*
+ * Subscription filters compiled into a trie with one node per topic level,
+ * '+' and '#' levels hang off their parent as dedicated children. Matching a
+ * topic walks the levels once, so its cost follows the topic depth instead
+ * of the number of subscriptions.
+ */
+struct mqtt_topic_node;
+
+typedef void (*mqtt_topic_match_cb)(void *arg, unsigned short index);
+
+extern int mqtt_topic_trie_add(struct mqtt_topic_node **root, const char *filter, unsigned short index);
+extern int mqtt_topic_trie_match(struct mqtt_topic_node *root, const char *topic, int len,
+					mqtt_topic_match_cb cb, void *arg);
+extern void mqtt_topic_trie_free(struct mqtt_topic_node *root);
+
+#endif
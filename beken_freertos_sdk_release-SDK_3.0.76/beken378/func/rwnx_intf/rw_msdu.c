@@ -34,6 +34,12 @@
 #if CFG_TX_BUFING
 #include "rw_tx_buffering.h"
 #endif
+#if CFG_MSDU_TX_POOL
+#include "rw_msdu_pool.h"
+#endif
+#if CFG_RWNX_REODER
+#include "rw_rx_reord.h"
+#endif
 #include "includes.h"
 #include "common.h"
 #include "list.h"
@@ -54,6 +60,9 @@ void ethernetif_input(int iface, struct pbuf *p);
 UINT32 rwm_transfer_node(MSDU_NODE_T *node, u16 flag);
 extern int bmsg_ps_handler_rf_ps_mode_real_wakeup(void);
 UINT8 rwn_mgmt_is_valid_sta(struct sta_info_tag *sta);
+#if CFG_WIFI_RX_AMSDU_ZERO_COPY
+static void rwm_rx_amsdu_ref_init(void);
+#endif
 
 LIST_HEAD_DEFINE(msdu_rx_list);
 
@@ -129,7 +138,7 @@ void rwm_tx_confirm(void *param)
 		}
 		os_null_printf("flush_desc:0x%x\r\n", txdesc->host.msdu_node);
 
-		os_free(txdesc->host.msdu_node);
+		rwm_node_free((MSDU_NODE_T *)txdesc->host.msdu_node);
 		txdesc->host.msdu_node = NULL;
 		txdesc->status = TXDESC_STA_IDLE;
 	}
@@ -259,6 +268,15 @@ MSDU_NODE_T *rwm_tx_node_alloc(UINT32 len)
 {
     UINT8 *buff_ptr;
     MSDU_NODE_T *node_ptr = 0;
+#if CFG_MSDU_TX_POOL
+    /* management, eapol and raw frames may still use the heap when the pool
+     * is dry, only lwip data is pushed back, see rwm_tx_node_alloc_data */
+    node_ptr = rwm_msdu_pool_alloc(len);
+    if(node_ptr)
+    {
+        goto pool_exit;
+    }
+#endif
 #if (CFG_SUPPORT_RTT) && (CFG_SOC_NAME == SOC_BK7221U)
     extern void *dtcm_malloc(size_t size);
     node_ptr = (MSDU_NODE_T *)dtcm_malloc(sizeof(MSDU_NODE_T)
@@ -287,13 +305,113 @@ MSDU_NODE_T *rwm_tx_node_alloc(UINT32 len)
     node_ptr->msdu_ptr = buff_ptr;
     node_ptr->len = len;
 
+#if CFG_MSDU_TX_POOL
+pool_exit:
+#endif
+#if CFG_WIFI_TX_ZERO_COPY
+    if(node_ptr)
+    {
+        node_ptr->pbuf = NULL;
+    }
+#endif
+
 alloc_exit:
     return node_ptr;
 }
 
+#if CFG_MSDU_TX_POOL
+/* node for lwip data: a dry pool returns NULL, never covered by the heap */
+MSDU_NODE_T *rwm_tx_node_alloc_data(UINT32 len)
+{
+    MSDU_NODE_T *node_ptr;
+
+    if((len > CFG_MSDU_POOL_LARGE_LEN) || !rwm_msdu_pool_ready())
+    {
+        return rwm_tx_node_alloc(len);
+    }
+
+    node_ptr = rwm_msdu_pool_alloc(len);
+#if CFG_WIFI_TX_ZERO_COPY
+    if(node_ptr)
+    {
+        node_ptr->pbuf = NULL;
+    }
+#endif
+
+    return node_ptr;
+}
+#endif
+
+#if CFG_WIFI_TX_ZERO_COPY
+/*
+ * Build the msdu node in the head room lwip reserved in front of the frame:
+ *
+ *  | pbuf | MSDU_NODE_T | RESV_HEAD | ETH frame (payload) | RESV_TAIL |
+ *
+ * Only single PBUF_RAM pbufs allocated with PBUF_LINK_ENCAPSULATION_HLEN
+ * head room qualify, anything else has to be copied by rwm_transfer.
+ * The ethernet header sits at 2 mod 4, the node is rounded down to a word
+ * boundary: the cpu has no unaligned word access.
+ */
+static UINT32 rwm_tx_pbuf_node_addr(struct pbuf *p)
+{
+    return ((UINT32)p->payload - CFG_MSDU_RESV_HEAD_LEN - sizeof(MSDU_NODE_T)) & ~3U;
+}
+
+int rwm_tx_pbuf_in_place(struct pbuf *p)
+{
+    UINT32 head_start;
+
+    if(p->next || (PBUF_RAM != p->type))
+    {
+        return 0;
+    }
+
+    head_start = (UINT32)p + LWIP_MEM_ALIGN_SIZE(sizeof(struct pbuf));
+    if((UINT32)p->payload < head_start + CFG_MSDU_RESV_HEAD_LEN + sizeof(MSDU_NODE_T))
+    {
+        return 0;
+    }
+
+    return (rwm_tx_pbuf_node_addr(p) >= head_start);
+}
+
+MSDU_NODE_T *rwm_tx_node_wrap_pbuf(struct pbuf *p)
+{
+    MSDU_NODE_T *node_ptr;
+
+    if(!rwm_tx_pbuf_in_place(p))
+    {
+        return NULL;
+    }
+
+    node_ptr = (MSDU_NODE_T *)rwm_tx_pbuf_node_addr(p);
+    node_ptr->msdu_ptr = (UINT8 *)((UINT32)p->payload - CFG_MSDU_RESV_HEAD_LEN);
+    node_ptr->len = p->len;
+    node_ptr->pbuf = p;
+
+    return node_ptr;
+}
+#endif
+
 void rwm_node_free(MSDU_NODE_T *node)
 {
     ASSERT(node);
+#if CFG_WIFI_TX_ZERO_COPY
+    if(node->pbuf)
+    {
+        /* the node lives inside the pbuf, drop the reference taken by bmsg_tx_sender */
+        pbuf_free(node->pbuf);
+        return;
+    }
+#endif
+#if CFG_MSDU_TX_POOL
+    if(rwm_msdu_pool_owns(node))
+    {
+        rwm_msdu_pool_free(node);
+        return;
+    }
+#endif
     os_free(node);
 }
 
@@ -411,6 +529,21 @@ void rwm_msdu_ps_change_ind_handler(void *msg)
 
 void rwm_msdu_init(void)
 {
+#if CFG_MSDU_TX_POOL
+    if(rwm_msdu_pool_init() != 0)
+    {
+        os_printf("msdu pool off, tx nodes come from the heap\r\n");
+    }
+#endif
+#if CFG_WIFI_TX_ZERO_COPY
+    ASSERT(sizeof(MSDU_NODE_T) + 3 <= CFG_MSDU_RESV_NODE_LEN);
+#endif
+#if CFG_WIFI_RX_AMSDU_ZERO_COPY
+    rwm_rx_amsdu_ref_init();
+#endif
+#if CFG_RWNX_REODER
+    rwm_rx_reord_init();
+#endif
 #if CFG_TX_BUFING
     rwm_tx_bufing_init();
 #endif
@@ -470,14 +603,72 @@ uint8_t classify8021d(UINT8 *buf)
 }
 
 static bool tx_use_low_rate_once = false;
+UINT32 rwm_transfer_msdu(UINT8 vif_idx, MSDU_NODE_T *node, int sync, void *args)
+{
+    UINT32 ret = RW_FAILURE;
+    ETH_HDR_PTR eth_hdr_ptr;
+
+    eth_hdr_ptr = (ETH_HDR_PTR)rwm_get_msdu_content_ptr(node);
+    node->vif_idx = vif_idx;
+	node->sync = sync;
+	node->args = args;
+    node->sta_idx = rwm_mgmt_tx_get_staidx(vif_idx,
+                             &eth_hdr_ptr->e_dest);
+#if CFG_TX_BUFING
+    if (rwm_check_tx_bufing(node))
+    {
+        rwm_tx_bufing_save_data(node);
+        ret = RW_SUCCESS;
+        goto tx_exit;
+    }
+#endif
+
+    if ( true == tx_use_low_rate_once )
+    {
+        tx_use_low_rate_once = false;
+        /// use RETRY_IMMEDIATELY to transfer at a low rate
+        rwm_transfer_node(node, TXU_CNTRL_RETRY_IMMEDIATELY);
+    }
+    else
+    {
+        rwm_transfer_node(node, 0);
+    }
+
+#if CFG_TX_BUFING
+tx_exit:
+#endif
+    return ret;
+}
+
+#if CFG_WIFI_TX_ZERO_COPY
+/**
+ * transmit the pbuf in place, without allocating and copying a new msdu node.
+ * On RW_SUCCESS the caller's pbuf reference belongs to the node and is
+ * released by rwm_node_free, on RW_FAILURE the caller still owns it.
+ */
+UINT32 rwm_transfer_pbuf(UINT8 vif_idx, struct pbuf *p)
+{
+    MSDU_NODE_T *node;
+
+    node = rwm_tx_node_wrap_pbuf(p);
+    if(NULL == node)
+    {
+        return RW_FAILURE;
+    }
+
+    rwm_transfer_msdu(vif_idx, node, 0, 0);
+
+    return RW_SUCCESS;
+}
+#endif
+
 UINT32 rwm_transfer(UINT8 vif_idx, UINT8 *buf, UINT32 len, int sync, void *args)
 {
     UINT32 ret = 0;
     MSDU_NODE_T *node;
-    ETH_HDR_PTR eth_hdr_ptr;
 
     ret = RW_FAILURE;
-#ifdef CFG_USE_APP_DEMO_VIDEO_TRANSFER
+#if defined(CFG_USE_APP_DEMO_VIDEO_TRANSFER) && (!CFG_MSDU_TX_POOL)
 #if CFG_OS_FREERTOS
 extern size_t xPortGetFreeHeapSize( void );
 #define MEMORY_LIMIT 7000
@@ -508,31 +699,7 @@ extern size_t xPortGetFreeHeapSize( void );
     }
     rwm_tx_msdu_renew(buf, len, node->msdu_ptr);
 
-    eth_hdr_ptr = (ETH_HDR_PTR)buf;
-    node->vif_idx = vif_idx;
-	node->sync = sync;
-	node->args = args;
-    node->sta_idx = rwm_mgmt_tx_get_staidx(vif_idx,
-                             &eth_hdr_ptr->e_dest);
-#if CFG_TX_BUFING
-    if (rwm_check_tx_bufing(node))
-    {
-        rwm_tx_bufing_save_data(node);
-        ret = RW_SUCCESS;
-        goto tx_exit;
-    }
-#endif
-
-    if ( true == tx_use_low_rate_once )
-    {
-        tx_use_low_rate_once = false;
-        /// use RETRY_IMMEDIATELY to transfer at a low rate
-        rwm_transfer_node(node, TXU_CNTRL_RETRY_IMMEDIATELY);
-    }
-    else
-    {
-        rwm_transfer_node(node, 0);
-    }
+    ret = rwm_transfer_msdu(vif_idx, node, sync, args);
 
 tx_exit:
     return ret;
@@ -783,6 +950,79 @@ UINT32 rwm_get_rx_free_node(struct pbuf **p_ret, UINT32 len)
     return RW_SUCCESS;
 }
 
+#if CFG_WIFI_RX_AMSDU_ZERO_COPY
+/* an a-msdu subframe handed to lwip, pointing into the mpdu it arrived in */
+typedef struct amsdu_rx_ref {
+    struct pbuf_custom pc;              // must stay first, lwip frees through it
+    struct pbuf *parent;
+    struct amsdu_rx_ref *next;
+} AMSDU_RX_REF_T;
+
+static AMSDU_RX_REF_T amsdu_rx_ref[CFG_AMSDU_RX_REF_NUM];
+static AMSDU_RX_REF_T *amsdu_rx_ref_free_list = NULL;
+
+static void rwm_rx_amsdu_ref_init(void)
+{
+    UINT32 i;
+    GLOBAL_INT_DECLARATION();
+
+    GLOBAL_INT_DISABLE();
+    amsdu_rx_ref_free_list = NULL;
+    for (i = 0; i < CFG_AMSDU_RX_REF_NUM; i ++)
+    {
+        amsdu_rx_ref[i].next = amsdu_rx_ref_free_list;
+        amsdu_rx_ref_free_list = &amsdu_rx_ref[i];
+    }
+    GLOBAL_INT_RESTORE();
+}
+
+/* called by pbuf_free once lwip is done with the subframe */
+static void rwm_rx_amsdu_ref_free(struct pbuf *p)
+{
+    AMSDU_RX_REF_T *ref = (AMSDU_RX_REF_T *)p;
+    struct pbuf *parent = ref->parent;
+    GLOBAL_INT_DECLARATION();
+
+    GLOBAL_INT_DISABLE();
+    ref->parent = NULL;
+    ref->next = amsdu_rx_ref_free_list;
+    amsdu_rx_ref_free_list = ref;
+    GLOBAL_INT_RESTORE();
+
+    /* the last subframe released frees the mpdu */
+    pbuf_free(parent);
+}
+
+/* NULL when all descriptors are held by lwip, the caller copies instead */
+static struct pbuf *rwm_rx_amsdu_ref(struct pbuf *parent, void *payload, UINT32 len)
+{
+    AMSDU_RX_REF_T *ref;
+    struct pbuf *p;
+    GLOBAL_INT_DECLARATION();
+
+    GLOBAL_INT_DISABLE();
+    ref = amsdu_rx_ref_free_list;
+    if (ref)
+    {
+        amsdu_rx_ref_free_list = ref->next;
+    }
+    GLOBAL_INT_RESTORE();
+
+    if (NULL == ref)
+    {
+        return NULL;
+    }
+
+    ref->parent = parent;
+    ref->pc.custom_free_function = rwm_rx_amsdu_ref_free;
+    /* PBUF_REF, lwip never grows the header into the previous subframe */
+    p = pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &ref->pc, payload, len);
+    pbuf_ref(parent);
+
+    return p;
+}
+#endif
+
 static const uint8_t rfc1042_header[6] = { 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00 };
 static const uint8_t bridge_tunnel_header[6] = { 0xaa, 0xaa, 0x03, 0x00, 0xf8, 0x00 };
 void ethernetif_input_amsdu(RW_RXIFO_PTR rx_info, struct pbuf *p)
@@ -892,18 +1132,37 @@ void ethernetif_input_amsdu(RW_RXIFO_PTR rx_info, struct pbuf *p)
         }
 
 
+#if CFG_WIFI_RX_AMSDU_ZERO_COPY
+        if ((uint32_t)eth_hdr + du_len > mpdu_end)
+        {
+            // malformed subframe, lwip would read past the mpdu
+            break;
+        }
+#endif
+
         // If the frame's src addr not equal to us.
         if (p_vif_entry && os_memcmp(&eth_hdr->sa, &p_vif_entry->mac_addr, ETH_ALEN))
         {
-            //malloc/dma/callback
-            rwm_get_rx_free_node(&pbuf, du_len);
+            pbuf = NULL;
+#if CFG_WIFI_RX_AMSDU_ZERO_COPY
+            pbuf = rwm_rx_amsdu_ref(p, (void *)eth_hdr, du_len);
+#endif
+            if (NULL == pbuf)
+            {
+                //malloc/dma/callback
+                rwm_get_rx_free_node(&pbuf, du_len);
+                if (pbuf)
+                {
+                    os_memcpy(pbuf->payload, (void *)eth_hdr, du_len);
+                }
+            }
+
             if (NULL == pbuf)
             {
                 os_printf("%s rwm_get_rx_free_node(%d) failed\n", __FUNCTION__, du_len);
             }
             else
             {
-                os_memcpy(pbuf->payload, (void *)eth_hdr, du_len);
                 ethernetif_input(rx_info->vif_idx, pbuf);
             }
         }
@@ -912,193 +1171,10 @@ void ethernetif_input_amsdu(RW_RXIFO_PTR rx_info, struct pbuf *p)
         amsdu_subfrm_hdr = (struct amsdu_hdr *)((uint8_t *)amsdu_subfrm_hdr + msdu_len_with_padding);
     }
 
+    /* drop our reference, subframes still in lwip keep the mpdu alive */
     pbuf_free(p);
 }
-#if CFG_RWNX_REODER
-static uint8_t ooo_pkt_cnt = 0;
-static uint16_t win_start = 0;
-static uint8_t rx_status_pos = 0;
-uint32_t sn_rx_time = 0;
-#define RX_REORD_WIN_SIZE 6
-
-struct rwm_reord_elt
-{
-    /// Host Buffer Address
-    struct pbuf *host_address;
-};
-struct rwm_reord_elt Element[RX_REORD_WIN_SIZE] = {NULL};
-
-static void rwm_reorder_update(void)
-{
-    Element[rx_status_pos].host_address = NULL;
-    win_start = (win_start + 1) & MAC_SEQCTRL_NUM_MAX;
-    rx_status_pos = (rx_status_pos + 1) % RX_REORD_WIN_SIZE;
-}
 
-static void rwm_reorder_fwd(uint8_t vif_idx)
-{
-    while (Element[rx_status_pos].host_address != NULL)
-    {
-        //msdu upload directly
-        ethernetif_input(vif_idx, Element[rx_status_pos].host_address);
-
-        // Update the reordering window
-        rwm_reorder_update();
-
-        ooo_pkt_cnt--;
-    }
-}
-
-struct mm_timer_tag rwm_reorder_timer;
-void rwm_reord_timeout_cb(void *env)
-{
-    // Restart reordering timer
-    uint8_t *vif_index = (uint8_t *)env;
-    mm_timer_set(&rwm_reorder_timer, rwm_reorder_timer.time + RX_CNTRL_REORD_MAX_WAIT);
-
-    do
-    {
-        // Check if there is at least a packet waiting
-        if (!ooo_pkt_cnt)
-            break;
-
-        // Check if we spent too much time waiting for an SN
-        if (!hal_machw_time_past(sn_rx_time + RX_CNTRL_REORD_MAX_WAIT))
-            break;
-
-        if (Element[rx_status_pos].host_address == NULL)
-        {
-            // Consider the next waited packet as received
-            rwm_reorder_update();
-        }
-
-        // Send the data
-        rwm_reorder_fwd(*vif_index);
-    } while (0);
-}
-
-static void rwm_reorder_flush(uint8_t vif_idx, uint16_t sn_skipped)
-{
-    // Forward all packets that have already been received
-    for (uint16_t i = 0; (i < sn_skipped) && ooo_pkt_cnt; i++)
-    {
-        uint8_t index = (rx_status_pos + i) % RX_REORD_WIN_SIZE;
-
-        if (Element[index].host_address != NULL)
-        {
-            // Data has already been copied in host memory and can now be forwarded
-            ethernetif_input(vif_idx, Element[index].host_address);
-
-            // Remove the unordered element from the structure
-            Element[index].host_address = NULL;
-
-            ooo_pkt_cnt--;
-        }
-    }
-
-    win_start     = (win_start + sn_skipped) & MAC_SEQCTRL_NUM_MAX;
-    rx_status_pos = (rx_status_pos + sn_skipped) % RX_REORD_WIN_SIZE;
-}
-
-bool is_first_packet = true;
-UINT32 rwm_upload_data(RW_RXIFO_PTR rx_info)
-{
-    struct pbuf *p = (struct pbuf *)rx_info->data;
-    struct eth_hdr *ethhdr;
-    ethhdr = p->payload;
-    STA_INF_PTR sta_entry;
-    uint16_t sn_pos;
-
-    os_null_printf("s:%d, v:%d, sn:%d, d:%d, r:%d, c:%d, l:%d, %p\r\n",
-                   rx_info->sta_idx,
-                   rx_info->vif_idx,
-                   rx_info->sn,
-                   rx_info->dst_idx,
-                   rx_info->rssi,
-                   rx_info->center_freq,
-                   rx_info->length,
-                   rx_info->data);
-
-    sta_entry = rwm_mgmt_sta_idx2ptr(rx_info->sta_idx);
-    if (sta_entry)
-        sta_entry->rssi = rx_info->rssi;
-
-    if (rx_info->rx_dmadesc_flags & RX_FLAGS_IS_AMSDU_BIT)
-    {
-        /* A-MSDU subframe, convert like 'rxu_cntrl_mac2eth_update()' and then pass it to lwip */
-        ethernetif_input_amsdu(rx_info, p);
-        return RW_SUCCESS;
-    }
-
-    if (htons(ethhdr->type) == 0x80) {
-        if(is_first_packet){
-            win_start = rx_info->sn;
-            rx_status_pos = win_start % RX_REORD_WIN_SIZE;
-            is_first_packet = false;
-            rwm_reorder_timer.cb = rwm_reord_timeout_cb;
-            rwm_reorder_timer.env = &rx_info->vif_idx;
-            mm_timer_set(&rwm_reorder_timer, sn_rx_time + RX_CNTRL_REORD_MAX_WAIT);
-        }
-
-        if (rx_info->sn == win_start) {
-
-            //msdu upload directly
-            ethernetif_input(rx_info->vif_idx, p);
-
-            // Store current time
-            extern uint32_t sn_rx_time;
-            sn_rx_time = hal_machw_time();
-
-            //Update the RX Window
-            rwm_reorder_update();
-
-            // And forward any ready frames
-            rwm_reorder_fwd(rx_info->vif_idx);
-
-            return RW_SUCCESS;
-
-        } else {
-
-            sn_pos = (rx_info->sn - win_start) & MAC_SEQCTRL_NUM_MAX;
-
-            if (sn_pos >= RX_REORD_WIN_SIZE) {
-                if (sn_pos < (MAC_SEQCTRL_NUM_MAX >> 1)) {
-
-                    // Move the window
-                    rwm_reorder_flush(rx_info->vif_idx, sn_pos - RX_REORD_WIN_SIZE + 1);
-
-                    // Recompute the SN position
-                    sn_pos = (rx_info->sn - win_start) & MAC_SEQCTRL_NUM_MAX;
-
-                } else {
-
-                    pbuf_free(p);
-                    return RW_FAILURE;
-
-                }
-            }
-
-            sn_pos = (sn_pos + rx_status_pos) % RX_REORD_WIN_SIZE;
-
-            if (Element[sn_pos].host_address != NULL) {
-
-                pbuf_free(p);
-                return RW_FAILURE;
-            }
-
-            //alloc memory and save p_buf address to p
-            Element[sn_pos].host_address = p;
-
-            ooo_pkt_cnt++;
-        }
-    } else {
-
-        ethernetif_input(rx_info->vif_idx, p);
-    }
-
-    return RW_SUCCESS;
-}
-#else
 UINT32 rwm_upload_data(RW_RXIFO_PTR rx_info)
 {
     struct pbuf *p = (struct pbuf *)rx_info->data;
@@ -1119,8 +1195,12 @@ UINT32 rwm_upload_data(RW_RXIFO_PTR rx_info)
 
     if (rx_info->rx_dmadesc_flags & RX_FLAGS_IS_AMSDU_BIT)
     {
+#if CFG_RWNX_REODER
+        return rwm_rx_reord_handle(rx_info, p);
+#else
         /* A-MSDU subframe, convert like 'rxu_cntrl_mac2eth_update()' and then pass it to lwip */
         ethernetif_input_amsdu(rx_info, p);
+#endif
     }
     else
     {
@@ -1135,8 +1215,12 @@ UINT32 rwm_upload_data(RW_RXIFO_PTR rx_info)
                 // If the frame's src addr not equal to us.
                 if (os_memcmp(&eth_hdr->sa, &p_vif_entry->mac_addr, ETH_ALEN))
                 {
+#if CFG_RWNX_REODER
+                    return rwm_rx_reord_handle(rx_info, p);
+#else
                     ethernetif_input(rx_info->vif_idx, p);
                     return RW_SUCCESS;
+#endif
                 }
             }
         }
@@ -1147,7 +1231,6 @@ UINT32 rwm_upload_data(RW_RXIFO_PTR rx_info)
 
     return RW_SUCCESS;
 }
-#endif
 
 UINT32 rwm_uploaded_data_handle(UINT8 *upper_buf, UINT32 len)
 {
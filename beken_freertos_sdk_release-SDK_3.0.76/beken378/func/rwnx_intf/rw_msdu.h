@@ -42,6 +42,10 @@ typedef struct _msdu_node_
     UINT8 sta_idx;
 	void *args;
 	int sync;
+#if CFG_WIFI_TX_ZERO_COPY
+	/* lwip pbuf the msdu is carved from, NULL for heap nodes */
+	struct pbuf *pbuf;
+#endif
 } MSDU_NODE_T, *MSDU_NODE_PTR;
 
 extern void rwm_push_rx_list(MSDU_NODE_T *node);
@@ -54,9 +58,19 @@ extern void *rwm_raw_frame_prepare_space(uint8_t *buffer, int length);
 extern int rwm_raw_frame_destroy_space(void *node);
 extern int rwm_raw_frame_with_cb(uint8_t *buffer, int len, void *cb, void *param);
 extern MSDU_NODE_T *rwm_tx_node_alloc(UINT32 len);
+#if CFG_MSDU_TX_POOL
+extern MSDU_NODE_T *rwm_tx_node_alloc_data(UINT32 len);
+#endif
+extern UINT32 rwm_transfer_msdu(UINT8 vif_idx, MSDU_NODE_T *node, int sync, void *args);
 extern void rwm_node_free(MSDU_NODE_T *node);
+#if CFG_WIFI_TX_ZERO_COPY
+extern int rwm_tx_pbuf_in_place(struct pbuf *p);
+extern MSDU_NODE_T *rwm_tx_node_wrap_pbuf(struct pbuf *p);
+extern UINT32 rwm_transfer_pbuf(UINT8 vif_idx, struct pbuf *p);
+#endif
 extern UINT8 *rwm_rx_buf_alloc(UINT32 len);
 extern UINT32 rwm_upload_data(RW_RXIFO_PTR rx_info);
+extern void ethernetif_input_amsdu(RW_RXIFO_PTR rx_info, struct pbuf *p);
 extern UINT32 rwm_get_rx_free_node(struct pbuf **p_ret, UINT32 len);
 extern UINT32 rwm_get_rx_valid(void);
 extern UINT8 rwm_get_tid();
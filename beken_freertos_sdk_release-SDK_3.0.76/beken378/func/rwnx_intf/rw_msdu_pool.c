@@ -0,0 +1,226 @@
+/**
+ ****************************************************************************************
+ *
+ * @file rw_msdu_pool.c
+ *
+ * @brief Preallocated slab pool of MSDU TX nodes
+ *
+ * TX nodes are carved once at init from a few MTU-class regions, and recycled
+ * through per class free lists, so steady state TX never touches the heap.
+ * Allocation and release are O(1). When the matching class and every bigger
+ * class are empty, the allocation fails: lwip data is pushed back instead of
+ * probing the heap, other frames fall back to the heap.
+ *
+ * Copyright (C) BEKEN corperation 2021
+ *
+ ****************************************************************************************
+ */
+
+/*
+ * INCLUDE FILES
+ ****************************************************************************************
+ */
+#include "include.h"
+#include "rw_msdu_pool.h"
+#include "mem_pub.h"
+#include "uart_pub.h"
+#include "arm_arch.h"
+
+#if CFG_MSDU_TX_POOL
+/*
+ * GLOBAL VARIABLE DEFINITION
+ ****************************************************************************************
+ */
+static const UINT16 msdu_pool_class_len[MSDU_POOL_CLASS_NUM] = {
+    CFG_MSDU_POOL_SMALL_LEN,
+    CFG_MSDU_POOL_MIDDLE_LEN,
+    CFG_MSDU_POOL_LARGE_LEN,
+};
+
+static const UINT16 msdu_pool_class_cnt[MSDU_POOL_CLASS_NUM] = {
+    CFG_MSDU_POOL_SMALL_CNT,
+    CFG_MSDU_POOL_MIDDLE_CNT,
+    CFG_MSDU_POOL_LARGE_CNT,
+};
+
+static msdu_pool g_msdu_pool = {0};
+
+/*
+ * FUNCTION BODIES
+ ****************************************************************************************
+ */
+int rwm_msdu_pool_init(void)
+{
+    UINT32 i, j;
+    UINT8 *block;
+    msdu_pool_class *cls;
+
+    if(g_msdu_pool.cls[0].base)
+    {
+        return 0;
+    }
+
+    for(i = 0; i < MSDU_POOL_CLASS_NUM; i ++)
+    {
+        cls = &g_msdu_pool.cls[i];
+        cls->payload_len = msdu_pool_class_len[i];
+        cls->block_size = (sizeof(MSDU_NODE_T) + CFG_MSDU_RESV_HEAD_LEN
+                            + cls->payload_len + CFG_MSDU_RESV_TAIL_LEN + 3) & ~3;
+
+        /* never released, so it does not fragment the heap */
+        cls->base = (UINT8 *)os_malloc(cls->block_size * msdu_pool_class_cnt[i]);
+        if(NULL == cls->base)
+        {
+            os_printf("msdu pool class %d alloc failed\r\n", i);
+            goto init_fail;
+        }
+        cls->end = cls->base + cls->block_size * msdu_pool_class_cnt[i];
+        cls->total = msdu_pool_class_cnt[i];
+
+        cls->free_list = NULL;
+        for(j = 0; j < cls->total; j ++)
+        {
+            block = cls->base + (cls->total - 1 - j) * cls->block_size;
+            *(void **)block = cls->free_list;
+            cls->free_list = block;
+        }
+        cls->free_cnt = cls->total;
+        cls->min_free_cnt = cls->total;
+    }
+
+    return 0;
+
+init_fail:
+    /* drop the classes done so far, a later init starts over */
+    while(i --)
+    {
+        os_free(g_msdu_pool.cls[i].base);
+    }
+    os_memset(&g_msdu_pool, 0, sizeof(g_msdu_pool));
+
+    return -1;
+}
+
+int rwm_msdu_pool_ready(void)
+{
+    return (NULL != g_msdu_pool.cls[0].base);
+}
+
+MSDU_NODE_T *rwm_msdu_pool_alloc(UINT32 len)
+{
+    UINT32 i;
+    void *block = NULL;
+    msdu_pool_class *cls;
+    MSDU_NODE_T *node_ptr;
+    GLOBAL_INT_DECLARATION();
+
+    if(len > msdu_pool_class_len[MSDU_POOL_CLASS_NUM - 1])
+    {
+        /* left to the caller, rare enough to come from the heap */
+        g_msdu_pool.oversize_cnt ++;
+        return NULL;
+    }
+
+    GLOBAL_INT_DISABLE();
+    for(i = 0; i < MSDU_POOL_CLASS_NUM; i ++)
+    {
+        cls = &g_msdu_pool.cls[i];
+        if((len > cls->payload_len) || (NULL == cls->free_list))
+        {
+            continue;
+        }
+
+        block = cls->free_list;
+        cls->free_list = *(void **)block;
+        cls->free_cnt --;
+        if(cls->free_cnt < cls->min_free_cnt)
+        {
+            cls->min_free_cnt = cls->free_cnt;
+        }
+
+        if((i > 0) && (len <= msdu_pool_class_len[i - 1]))
+        {
+            g_msdu_pool.borrow_cnt ++;
+        }
+        else
+        {
+            g_msdu_pool.alloc_cnt ++;
+        }
+        break;
+    }
+
+    if(NULL == block)
+    {
+        g_msdu_pool.dry_cnt ++;
+    }
+    GLOBAL_INT_RESTORE();
+
+    if(NULL == block)
+    {
+        return NULL;
+    }
+
+    node_ptr = (MSDU_NODE_T *)block;
+    node_ptr->msdu_ptr = (UINT8 *)((UINT32)node_ptr + sizeof(MSDU_NODE_T));
+    node_ptr->len = len;
+
+    return node_ptr;
+}
+
+int rwm_msdu_pool_owns(MSDU_NODE_T *node)
+{
+    UINT32 i;
+    msdu_pool_class *cls;
+
+    for(i = 0; i < MSDU_POOL_CLASS_NUM; i ++)
+    {
+        cls = &g_msdu_pool.cls[i];
+        if(((UINT8 *)node >= cls->base) && ((UINT8 *)node < cls->end))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void rwm_msdu_pool_free(MSDU_NODE_T *node)
+{
+    UINT32 i;
+    msdu_pool_class *cls;
+    GLOBAL_INT_DECLARATION();
+
+    for(i = 0; i < MSDU_POOL_CLASS_NUM; i ++)
+    {
+        cls = &g_msdu_pool.cls[i];
+        if(((UINT8 *)node >= cls->base) && ((UINT8 *)node < cls->end))
+        {
+            break;
+        }
+    }
+    ASSERT(i < MSDU_POOL_CLASS_NUM);
+
+    GLOBAL_INT_DISABLE();
+    *(void **)node = cls->free_list;
+    cls->free_list = node;
+    cls->free_cnt ++;
+    GLOBAL_INT_RESTORE();
+}
+
+void rwm_msdu_pool_dump(void)
+{
+    UINT32 i;
+    msdu_pool_class *cls;
+
+    for(i = 0; i < MSDU_POOL_CLASS_NUM; i ++)
+    {
+        cls = &g_msdu_pool.cls[i];
+        os_printf("msdu pool[%d] len:%d free:%d/%d min:%d\r\n", i, cls->payload_len,
+                  cls->free_cnt, cls->total, cls->min_free_cnt);
+    }
+    os_printf("msdu pool alloc:%d borrow:%d dry:%d oversize:%d\r\n",
+              g_msdu_pool.alloc_cnt, g_msdu_pool.borrow_cnt,
+              g_msdu_pool.dry_cnt, g_msdu_pool.oversize_cnt);
+}
+#endif // CFG_MSDU_TX_POOL
+// eof
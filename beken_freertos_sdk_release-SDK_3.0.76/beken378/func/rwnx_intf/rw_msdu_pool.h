@@ -0,0 +1,56 @@
+/**
+ ****************************************************************************************
+ *
+ * @file rw_msdu_pool.h
+ *
+ * @brief Preallocated slab pool of MSDU TX nodes.
+ *
+ * Copyright (C) BEKEN corperation 2021
+ *
+ ****************************************************************************************
+ */
+#ifndef _RW_MSDU_POOL_H_
+#define _RW_MSDU_POOL_H_
+
+#include "rw_msdu.h"
+
+#if CFG_MSDU_TX_POOL
+/*
+ * TYPE and STRUCT DEFINITIONS
+ ****************************************************************************************
+ */
+#define MSDU_POOL_CLASS_NUM             3
+
+/// one size class of the pool, all blocks carry sizeof(MSDU_NODE_T) + head/tail room
+typedef struct msdu_pool_class_st {
+    UINT8 *base;                        // start of the preallocated blocks
+    UINT8 *end;
+    UINT32 block_size;
+    UINT32 payload_len;                 // largest msdu that fits in one block
+    UINT32 total;
+    UINT32 free_cnt;
+    UINT32 min_free_cnt;                // low watermark
+    void *free_list;                    // singly linked through the first word
+} msdu_pool_class;
+
+typedef struct msdu_pool_st {
+    msdu_pool_class cls[MSDU_POOL_CLASS_NUM];
+    UINT32 alloc_cnt;
+    UINT32 borrow_cnt;                  // served by a bigger class
+    UINT32 dry_cnt;                     // every class empty
+    UINT32 oversize_cnt;                // larger than any class, from heap
+} msdu_pool;
+
+/*
+ * FUNCTION DECLARATIONS
+ ****************************************************************************************
+ */
+int rwm_msdu_pool_init(void);
+int rwm_msdu_pool_ready(void);
+/* NULL when the pool is dry, or len exceeds CFG_MSDU_POOL_LARGE_LEN */
+MSDU_NODE_T *rwm_msdu_pool_alloc(UINT32 len);
+int rwm_msdu_pool_owns(MSDU_NODE_T *node);
+void rwm_msdu_pool_free(MSDU_NODE_T *node);
+void rwm_msdu_pool_dump(void);
+#endif // CFG_MSDU_TX_POOL
+#endif // _RW_MSDU_POOL_H_
@@ -73,31 +73,210 @@ extern int wpa_is_scan_only();
 int wlan_get_bss_beacon_ies(struct wpabuf *buf, const u8 *bcn_ie, int ie_len);
 #endif
 
+/* scan results: kept strongest first, at most MAX_BSS_LIST of them. items
+ * are carved from per-scan arena chunks and found by bssid through a small
+ * hash, everything goes back in one go in sr_free_all */
+#define SR_HASH_SIZE                16
+#define SR_ARENA_CHUNK              2048
+#define SR_ALIGN(len)               (((len) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+typedef struct sr_node
+{
+    struct sr_node *next;       /* same hash bucket */
+    UINT32 size;                /* arena bytes, header and ies included */
+    SCAN_RST_ITEM_T item;       /* followed by ie_len of IE data */
+} SR_NODE_T;
+
+typedef struct sr_chunk
+{
+    struct sr_chunk *next;
+    UINT32 size;
+    UINT32 used;
+} SR_CHUNK_T;
+
+typedef struct sr_store
+{
+    SCAN_RST_UPLOAD_T rst;      /* handed out by sr_get_scan_results */
+    SR_CHUNK_T *chunk;          /* newest first */
+    UINT32 live;
+    UINT32 waste;               /* replaced or evicted, until compacted */
+    SR_NODE_T *hash[SR_HASH_SIZE];
+    SCAN_RST_ITEM_PTR res[MAX_BSS_LIST];
+} SR_STORE_T;
+
+#define SR_NODE_HDR                 ((UINT32)&((SR_NODE_T *)0)->item)
+#define SR_NODE_OF(item_ptr)        ((SR_NODE_T *)((UINT8 *)(item_ptr) - SR_NODE_HDR))
+
+static UINT32 sr_bssid_hash(const UINT8 *bssid)
+{
+    return (bssid[3] ^ bssid[4] ^ bssid[5]) & (SR_HASH_SIZE - 1);
+}
+
+static void *sr_arena_alloc(SR_STORE_T *store, UINT32 len)
+{
+    SR_CHUNK_T *chunk = store->chunk;
+    UINT32 size;
+    void *ptr;
+
+    len = SR_ALIGN(len);
+    if ((chunk == NULL) || (chunk->used + len > chunk->size))
+    {
+        size = (len > SR_ARENA_CHUNK) ? len : SR_ARENA_CHUNK;
+        chunk = (SR_CHUNK_T *)os_malloc(sizeof(SR_CHUNK_T) + size);
+        if (chunk == NULL)
+            return NULL;
+
+        chunk->size = size;
+        chunk->used = 0;
+        chunk->next = store->chunk;
+        store->chunk = chunk;
+    }
+
+    ptr = (UINT8 *)&chunk[1] + chunk->used;
+    chunk->used += len;
+
+    return ptr;
+}
+
+static void sr_arena_free(SR_CHUNK_T *chunk)
+{
+    SR_CHUNK_T *next;
+
+    while (chunk)
+    {
+        next = chunk->next;
+        os_free(chunk);
+        chunk = next;
+    }
+}
+
+static void sr_hash_add(SR_STORE_T *store, SR_NODE_T *node)
+{
+    UINT32 h = sr_bssid_hash(node->item.bssid);
+
+    node->next = store->hash[h];
+    store->hash[h] = node;
+}
+
+static SR_NODE_T *sr_hash_find(SR_STORE_T *store, const UINT8 *bssid)
+{
+    SR_NODE_T *node = store->hash[sr_bssid_hash(bssid)];
+
+    while (node && os_memcmp(node->item.bssid, bssid, ETH_ALEN))
+        node = node->next;
+
+    return node;
+}
+
+/* move the live items into one chunk once more than half the arena is dead */
+static void sr_compact(SR_STORE_T *store)
+{
+    SR_CHUNK_T *old = store->chunk;
+    SR_NODE_T *node;
+    UINT32 i;
+
+    if ((store->waste < SR_ARENA_CHUNK) || (store->waste <= store->live))
+        return;
+
+    store->chunk = NULL;
+    if (store->live && (sr_arena_alloc(store, store->live) == NULL))
+    {
+        store->chunk = old;
+        return;
+    }
+
+    /* take the chunk back and fill it item by item */
+    if (store->chunk)
+        store->chunk->used = 0;
+
+    os_memset(store->hash, 0, sizeof(store->hash));
+    for (i = 0; i < store->rst.scanu_num; i ++)
+    {
+        node = SR_NODE_OF(store->res[i]);
+        node = (SR_NODE_T *)os_memcpy(sr_arena_alloc(store, node->size), node, node->size);
+        sr_hash_add(store, node);
+        store->res[i] = &node->item;
+    }
+
+    store->waste = 0;
+    sr_arena_free(old);
+}
+
 /* scan result malloc item */
-UINT8 *sr_malloc_result_item(UINT32 vies_len)
+static SCAN_RST_ITEM_PTR sr_malloc_result_item(SR_STORE_T *store, UINT32 vies_len)
+{
+    SR_NODE_T *node;
+    UINT32 size = SR_ALIGN(SR_NODE_HDR + sizeof(SCAN_RST_ITEM_T) + vies_len);
+
+    node = (SR_NODE_T *)sr_arena_alloc(store, size);
+    if (node == NULL)
+        return NULL;
+
+    os_memset(node, 0, SR_NODE_HDR + sizeof(SCAN_RST_ITEM_T));
+    node->size = size;
+    store->live += size;
+
+    return &node->item;
+}
+
+/* drop an item from the list and the hash, its space waits for sr_compact */
+static void sr_free_result_item(SR_STORE_T *store, SCAN_RST_ITEM_PTR item)
 {
-    return os_zalloc(vies_len + sizeof(struct sta_scan_res));
+    SR_NODE_T *node = SR_NODE_OF(item);
+    SR_NODE_T **pp = &store->hash[sr_bssid_hash(item->bssid)];
+    UINT32 i;
+
+    while (*pp && (*pp != node))
+        pp = &(*pp)->next;
+    if (*pp)
+        *pp = node->next;
+
+    for (i = 0; i < store->rst.scanu_num; i ++)
+    {
+        if (store->res[i] == item)
+        {
+            os_memmove(&store->res[i], &store->res[i + 1],
+                       (store->rst.scanu_num - i - 1) * sizeof(store->res[0]));
+            store->rst.scanu_num --;
+            break;
+        }
+    }
+
+    store->live -= node->size;
+    store->waste += node->size;
 }
 
-/* free scan result item */
-void sr_free_result_item(UINT8 *item_ptr)
+/* insert behind the entries at least as strong */
+static void sr_insert_result_item(SR_STORE_T *store, SCAN_RST_ITEM_PTR item)
 {
-    os_free(item_ptr);
+    UINT32 lo = 0, hi = store->rst.scanu_num, mid;
+
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (store->res[mid]->level >= item->level)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    os_memmove(&store->res[lo + 1], &store->res[lo],
+               (store->rst.scanu_num - lo) * sizeof(store->res[0]));
+    store->res[lo] = item;
+    store->rst.scanu_num ++;
+
+    sr_hash_add(store, SR_NODE_OF(item));
 }
 
 UINT8 *sr_malloc_shell(void)
 {
-    UINT8 *ptr;
-    UINT32 layer1_space_len;
-    UINT32 layer2_space_len;
-
-    layer1_space_len = sizeof(SCAN_RST_UPLOAD_T);
-    layer2_space_len = MAX_BSS_LIST * sizeof(struct sta_scan_res *);
-    ptr = os_zalloc(layer1_space_len + layer2_space_len);
+    SR_STORE_T *store;
 
-	if(ptr)
+    store = (SR_STORE_T *)os_zalloc(sizeof(SR_STORE_T));
+	if(store)
 	{
-		return ptr;
+		store->rst.res = store->res;
+		return (UINT8 *)store;
 	}
 	else
 	{
@@ -113,13 +292,10 @@ void sr_free_shell(UINT8 *shell_ptr)
 
 void sr_free_all(SCAN_RST_UPLOAD_T *scan_rst)
 {
-    UINT32 i;
+    SR_STORE_T *store = (SR_STORE_T *)scan_rst;
 
-    for(i = 0; i < scan_rst->scanu_num; i ++)
-    {
-        sr_free_result_item((UINT8 *)scan_rst->res[i]);
-        scan_rst->res[i] = 0;
-    }
+    sr_arena_free(store->chunk);
+    store->chunk = 0;
     scan_rst->scanu_num = 0;
 	scan_rst->ref = 0;
 
@@ -607,28 +783,6 @@ rw_stage_type mhdr_get_station_stage(void)
 }
 
 
-static void sort_scan_result(SCAN_RST_UPLOAD_T *ap_list)
-{
-    int i, j;
-    struct sta_scan_res *tmp;
-
-    if (ap_list->scanu_num == 0)
-        return;
-
-    for(i = 0; i < (ap_list->scanu_num - 1); i++)
-    {
-        for(j = i + 1; j < ap_list->scanu_num; j++)
-        {
-            if (ap_list->res[j]->level > ap_list->res[i]->level)
-            {
-                tmp = ap_list->res[j];
-                ap_list->res[j] = ap_list->res[i];
-                ap_list->res[i] = tmp;
-            }
-        }
-    }
-}
-
 UINT32 mhdr_scanu_start_cfm(void *msg, SCAN_RST_UPLOAD_T **ap_list)
 {
     struct scanu_start_cfm *cfm;
@@ -637,16 +791,10 @@ UINT32 mhdr_scanu_start_cfm(void *msg, SCAN_RST_UPLOAD_T **ap_list)
     msg_ptr = (struct ke_msg *)msg;
     cfm = (struct scanu_start_cfm *)msg_ptr->param;
 
-    if(*ap_list)
+    /* results are kept in level order as they arrive */
+    if(*ap_list && (CO_OK != cfm->status))
     {
-    	if(CO_OK == cfm->status)
-    	{
-        	sort_scan_result(*ap_list);
-    	}
-		else
-		{
-			sr_flush_scan_results(*ap_list);
-		}
+		sr_flush_scan_results(*ap_list);
     }
 
 	mhdr_scanu_reg_cb_handle(cfm);
@@ -658,15 +806,16 @@ UINT32 mhdr_scanu_result_ind(SCAN_RST_UPLOAD_T *scan_rst, void *msg, UINT32 len)
 {
     UINT32 ret, chann;
     UINT8 *elmt_addr;
-    UINT32 vies_len, i;
+    UINT32 vies_len;
     UINT8 *var_part_addr;
     struct ke_msg *msg_ptr;
     SCAN_RST_ITEM_PTR item;
-    SCAN_RST_UPLOAD_PTR result_ptr;
+    SCAN_RST_ITEM_PTR replace = NULL;
+    SR_STORE_T *store;
+    SR_NODE_T *node;
     SCAN_IND_PTR scanu_ret_ptr;
     IEEE802_11_PROBE_RSP_PTR probe_rsp_ieee80211_ptr;
     char on_channel;
-    int replace_index = -1;
 #if CFG_WPA_CTRL_IFACE
     bool reduce_ie = false;
     struct wpabuf *ies = 0;
@@ -676,10 +825,7 @@ UINT32 mhdr_scanu_result_ind(SCAN_RST_UPLOAD_T *scan_rst, void *msg, UINT32 len)
 #endif
 
     ret = RW_SUCCESS;
-    result_ptr = scan_rst;
-
-    if (result_ptr->scanu_num >= MAX_BSS_LIST)
-        goto scan_rst_exit;
+    store = (SR_STORE_T *)scan_rst;
 
     msg_ptr = (struct ke_msg *)msg;
     scanu_ret_ptr = (SCAN_IND_PTR)msg_ptr->param;
@@ -724,25 +870,24 @@ UINT32 mhdr_scanu_result_ind(SCAN_RST_UPLOAD_T *scan_rst, void *msg, UINT32 len)
         os_printf("scan rst no ds param, drop it?\r\n");
     }
 
+    /* items may move here, so before any of them is looked up */
+    sr_compact(store);
+
     /* check the duplicate bssid*/
-    do
+    node = sr_hash_find(store, probe_rsp_ieee80211_ptr->bssid);
+    if (node)
     {
-        for(i = 0; i < result_ptr->scanu_num; i ++)
-        {
-            if(!os_memcmp(probe_rsp_ieee80211_ptr->bssid, result_ptr->res[i]->bssid, ETH_ALEN))
-            {
-                if ((result_ptr->res[i]->on_channel == 1) || (on_channel == 0))
-                {
-                    goto scan_rst_exit;
-                }
-                else
-                {
-                    replace_index = i; // should replace it.
-                }
-            }
-        }
+        if ((node->item.on_channel == 1) || (on_channel == 0))
+            goto scan_rst_exit;
+
+        replace = &node->item; // should replace it.
+    }
+    else if ((scan_rst->scanu_num >= MAX_BSS_LIST)
+             && (scanu_ret_ptr->rssi <= scan_rst->res[MAX_BSS_LIST - 1]->level))
+    {
+        /* full, and no stronger than the weakest we keep */
+        goto scan_rst_exit;
     }
-    while(0);
 
 #if CFG_WPA_CTRL_IFACE
     if (reduce_ie) {
@@ -750,11 +895,11 @@ UINT32 mhdr_scanu_result_ind(SCAN_RST_UPLOAD_T *scan_rst, void *msg, UINT32 len)
         if (!ies)
             goto scan_rst_exit;
         wlan_get_bss_beacon_ies(ies, (u8 *)(var_part_addr), vies_len);
-        item = (SCAN_RST_ITEM_PTR)sr_malloc_result_item(wpabuf_len(ies));
+        item = sr_malloc_result_item(store, wpabuf_len(ies));
         // os_printf("%s: %d-> %d\n", __func__, vies_len, wpabuf_len(ies));
     } else
 #endif
-    item = (SCAN_RST_ITEM_PTR)sr_malloc_result_item(vies_len);
+    item = sr_malloc_result_item(store, vies_len);
     if (item == NULL)
         goto scan_rst_exit;
 
@@ -798,16 +943,13 @@ UINT32 mhdr_scanu_result_ind(SCAN_RST_UPLOAD_T *scan_rst, void *msg, UINT32 len)
 
     item->security = get_security_type_from_ie((u8 *)var_part_addr, vies_len, item->caps);
 
-    if (replace_index >= 0)
-    {
-        sr_free_result_item((UINT8 *)result_ptr->res[replace_index]);
-        result_ptr->res[replace_index] = item;
-    }
-    else
-    {
-        result_ptr->res[result_ptr->scanu_num] = item;
-        result_ptr->scanu_num ++;
-    }
+    /* the weakest makes room when full */
+    if (replace)
+        sr_free_result_item(store, replace);
+    else if (scan_rst->scanu_num >= MAX_BSS_LIST)
+        sr_free_result_item(store, scan_rst->res[MAX_BSS_LIST - 1]);
+
+    sr_insert_result_item(store, item);
 
 scan_rst_exit:
 #if CFG_WPA_CTRL_IFACE
@@ -868,8 +1010,6 @@ void rwnx_handle_recv_msg(struct ke_msg *rx_msg)
 		if (0 == scan_rst_set_ptr) {
 			scan_rst_set_ptr = (SCAN_RST_UPLOAD_T *)sr_malloc_shell();
 			if (scan_rst_set_ptr) {
-				scan_rst_set_ptr->scanu_num = 0;
-				scan_rst_set_ptr->res = (SCAN_RST_ITEM_PTR*)&scan_rst_set_ptr[1];
 				mhdr_scanu_result_ind(scan_rst_set_ptr, rx_msg, rx_msg->param_len);
 			} else {
 				os_printf("scan_rst_set_ptr malloc fail\r\n");
@@ -0,0 +1,447 @@
+/**
+ ****************************************************************************************
+ *
+ * @file rw_rx_reord.c
+ *
+ * @brief Per STA/TID RX reordering module
+ *
+ * Frames received under an RX block ack agreement are reordered per [sta_idx, tid]
+ * session, with the window size taken from the addba negotiation. Every session owns
+ * a timer, so a lost sn only holds back its own station and tid. Frames without an
+ * agreement, and group addressed frames, are delivered as they come.
+ *
+ * Copyright (C) BEKEN corperation 2021
+ *
+ ****************************************************************************************
+ */
+
+/*
+ * INCLUDE FILES
+ ****************************************************************************************
+ */
+#include "include.h"
+#include "rw_rx_reord.h"
+#include "rw_pub.h"
+#include "mem_pub.h"
+#include "uart_pub.h"
+#include "rxu_cntrl.h"
+#include "sta_mgmt.h"
+#include "bam.h"
+#include "hal_machw.h"
+#include "lwip/pbuf.h"
+
+#if CFG_RWNX_REODER
+/*
+ * GLOBAL VARIABLE DEFINITION
+ ****************************************************************************************
+ */
+static rwm_reord_session rwm_reord_sessions[RWM_REORD_SESSION_NUM];
+static rwm_reord_stats rwm_reord_stat = {0};
+
+/*
+ * EXTERNAL FUNCTION DECLARE
+ ****************************************************************************************
+ */
+void ethernetif_input(int iface, struct pbuf *p);
+
+/*
+ * FUNCTION BODIES
+ ****************************************************************************************
+ */
+static void rwm_rx_reord_deliver(uint8_t vif_idx, struct pbuf *p, bool amsdu)
+{
+    RW_RXIFO_ST rx_info = {0};
+
+    if (amsdu)
+    {
+        rx_info.vif_idx = vif_idx;
+        rx_info.sta_idx = INVALID_STA_IDX;
+        rx_info.dst_idx = INVALID_STA_IDX;
+        ethernetif_input_amsdu(&rx_info, p);
+    }
+    else
+    {
+        ethernetif_input(vif_idx, p);
+    }
+}
+
+/* hand the slot at win_start up, if any, and slide the window by one */
+static void rwm_rx_reord_advance(rwm_reord_session *s)
+{
+    struct pbuf *p = s->elt[s->pos];
+    bool amsdu = (s->amsdu_map & CO_BIT(s->pos)) != 0;
+
+    s->elt[s->pos] = NULL;
+    s->amsdu_map &= ~CO_BIT(s->pos);
+    s->win_start = (s->win_start + 1) & MAC_SEQCTRL_NUM_MAX;
+    s->pos = (s->pos + 1) % s->win_size;
+
+    if (p)
+    {
+        s->ooo_cnt --;
+        rwm_rx_reord_deliver(s->vif_idx, p, amsdu);
+    }
+}
+
+/* forward the frames that became in order */
+static void rwm_rx_reord_fwd(rwm_reord_session *s)
+{
+    while (s->elt[s->pos] != NULL)
+    {
+        rwm_rx_reord_advance(s);
+    }
+}
+
+/* move the window by sn_skipped, forwarding what was buffered on the way */
+static void rwm_rx_reord_flush(rwm_reord_session *s, uint16_t sn_skipped)
+{
+    uint16_t i, cnt;
+
+    cnt = (sn_skipped < s->win_size) ? sn_skipped : s->win_size;
+    for (i = 0; i < cnt; i ++)
+    {
+        if (s->elt[s->pos])
+        {
+            rwm_reord_stat.flush ++;
+        }
+        rwm_rx_reord_advance(s);
+    }
+
+    // The remaining skipped sns can not be buffered
+    s->win_start = (s->win_start + sn_skipped - cnt) & MAC_SEQCTRL_NUM_MAX;
+}
+
+static void rwm_rx_reord_timer_update(rwm_reord_session *s)
+{
+    if (s->ooo_cnt && !s->timer_on)
+    {
+        mm_timer_set(&s->timer, s->sn_rx_time + RX_CNTRL_REORD_MAX_WAIT);
+        s->timer_on = true;
+    }
+    else if (!s->ooo_cnt && s->timer_on)
+    {
+        mm_timer_clear(&s->timer);
+        s->timer_on = false;
+    }
+}
+
+/* release the session, what is still buffered goes up in sn order */
+static void rwm_rx_reord_reset(rwm_reord_session *s)
+{
+    while (s->ooo_cnt)
+    {
+        if (s->elt[s->pos])
+        {
+            rwm_reord_stat.flush ++;
+        }
+        rwm_rx_reord_advance(s);
+    }
+
+    if (s->timer_on)
+    {
+        mm_timer_clear(&s->timer);
+        s->timer_on = false;
+    }
+    s->sta_idx = INVALID_STA_IDX;
+}
+
+/* rx agreement of the [sta_idx, tid], NULL once the station or the agreement is deleted */
+static struct bam_env_tag *rwm_rx_reord_get_bam(uint8_t sta_idx, uint8_t tid)
+{
+    uint8_t bam_idx;
+
+    if (!sta_mgmt_is_valid(sta_idx))
+    {
+        return NULL;
+    }
+
+    bam_idx = sta_mgmt_get_rx_bam_idx(sta_idx, tid);
+    if (bam_idx >= BAM_IDX_MAX)
+    {
+        return NULL;
+    }
+
+    return &bam_env[bam_idx];
+}
+
+/* negotiated buffer size of the rx agreement */
+static uint8_t rwm_rx_reord_win_size(struct bam_env_tag *bam)
+{
+    uint8_t win_size = bam->buffer_size;
+
+    if ((win_size == 0) || (win_size > RWM_REORD_WIN_MAX))
+    {
+        win_size = RWM_REORD_WIN_MAX;
+    }
+
+    return win_size;
+}
+
+/* the session still runs under the agreement it was set up for */
+static bool rwm_rx_reord_is_current(rwm_reord_session *s)
+{
+    struct bam_env_tag *bam = rwm_rx_reord_get_bam(s->sta_idx, s->tid);
+
+    return bam && MAC_ADDR_CMP(&s->peer, &sta_info_tab[s->sta_idx].mac_addr)
+           && (s->ssn == bam->ssn) && (s->dialog_token == bam->dialog_token)
+           && (s->win_size == rwm_rx_reord_win_size(bam));
+}
+
+static void rwm_rx_reord_timeout_cb(void *env)
+{
+    rwm_reord_session *s = (rwm_reord_session *)env;
+
+    s->timer_on = false;
+    if (!rwm_rx_reord_is_current(s))
+    {
+        rwm_rx_reord_reset(s);
+        return;
+    }
+
+    if (!s->ooo_cnt)
+    {
+        return;
+    }
+
+    if (hal_machw_time_past(s->sn_rx_time + RX_CNTRL_REORD_MAX_WAIT))
+    {
+        // Consider the waited sns as received, up to the first buffered frame
+        while (s->elt[s->pos] == NULL)
+        {
+            rwm_reord_stat.timeout ++;
+            rwm_rx_reord_advance(s);
+        }
+        rwm_rx_reord_fwd(s);
+        s->sn_rx_time = hal_machw_time();
+    }
+
+    rwm_rx_reord_timer_update(s);
+}
+
+/*
+ * The tid is not reported with the rx info, it is taken from the qos control
+ * of the frame being uploaded, which rxu keeps in its rx status while the
+ * upload runs. Non qos frames give TID_MAX and are delivered directly.
+ */
+static uint8_t rwm_rx_reord_get_tid(RW_RXIFO_PTR rx_info)
+{
+    struct rx_cntrl_rx_status *rx_status = &rxu_cntrl_env.rx_status;
+    uint8_t tid;
+
+    if (!(rx_status->frame_cntl & MAC_QOS_ST_BIT)
+            || (rx_status->sta_idx != rx_info->sta_idx)
+            || (rx_status->sn != rx_info->sn))
+    {
+        return TID_MAX;
+    }
+
+    tid = rx_status->tid;
+    if (tid >= TID_MAX)
+    {
+        return TID_MAX;
+    }
+
+    return tid;
+}
+
+/*
+ * A session is kept while its agreement is: a DELBA, a new ADDBA on the same
+ * tid (new ssn or dialog token) or a station delete releases it. The mac
+ * handles those without telling the host, so the sessions are checked here,
+ * on every lookup, and by their timer when frames are buffered. When the tid
+ * has no agreement, NULL is returned and the frame goes up directly.
+ */
+static rwm_reord_session *rwm_rx_reord_get_session(RW_RXIFO_PTR rx_info, uint8_t tid)
+{
+    uint32_t i;
+    rwm_reord_session *s, *free_s = NULL, *old_s = NULL;
+    struct sta_info_tag *sta = &sta_info_tab[rx_info->sta_idx];
+    struct bam_env_tag *bam = rwm_rx_reord_get_bam(rx_info->sta_idx, tid);
+
+    for (i = 0; i < RWM_REORD_SESSION_NUM; i ++)
+    {
+        s = &rwm_reord_sessions[i];
+        if (s->sta_idx == INVALID_STA_IDX)
+        {
+            if (!free_s)
+            {
+                free_s = s;
+            }
+            continue;
+        }
+
+        if (!rwm_rx_reord_is_current(s))
+        {
+            /* station or agreement deleted, or replaced by a new addba */
+            rwm_rx_reord_reset(s);
+            if (!free_s)
+            {
+                free_s = s;
+            }
+            continue;
+        }
+
+        if ((s->sta_idx == rx_info->sta_idx) && (s->tid == tid))
+        {
+            return s;
+        }
+
+        if (!s->ooo_cnt && (!old_s || ((int32_t)(s->sn_rx_time - old_s->sn_rx_time) < 0)))
+        {
+            old_s = s;
+        }
+    }
+
+    if (!bam)
+    {
+        return NULL;
+    }
+
+    if (!free_s)
+    {
+        if (!old_s)
+        {
+            return NULL;
+        }
+
+        /* recycle the idle session that was used the longest time ago */
+        rwm_rx_reord_reset(old_s);
+        free_s = old_s;
+    }
+
+    s = free_s;
+    os_memset(s->elt, 0, sizeof(s->elt));
+    s->amsdu_map = 0;
+    s->ooo_cnt = 0;
+    s->pos = 0;
+    s->win_size = rwm_rx_reord_win_size(bam);
+    s->win_start = bam->ssn;
+    if (((rx_info->sn - bam->ssn) & MAC_SEQCTRL_NUM_MAX) >= (MAC_SEQCTRL_NUM_MAX >> 1))
+    {
+        /* a recycled session, the peer is already well past the addba ssn */
+        s->win_start = rx_info->sn;
+    }
+    s->ssn = bam->ssn;
+    s->dialog_token = bam->dialog_token;
+    s->sta_idx = rx_info->sta_idx;
+    s->tid = tid;
+    s->vif_idx = rx_info->vif_idx;
+    s->sn_rx_time = hal_machw_time();
+    MAC_ADDR_CPY(&s->peer, &sta->mac_addr);
+    s->timer.cb = rwm_rx_reord_timeout_cb;
+    s->timer.env = s;
+    s->timer_on = false;
+
+    return s;
+}
+
+UINT32 rwm_rx_reord_handle(RW_RXIFO_PTR rx_info, struct pbuf *p)
+{
+    bool amsdu = (rx_info->rx_dmadesc_flags & RX_FLAGS_IS_AMSDU_BIT) != 0;
+    rwm_reord_session *s;
+    uint16_t sn_pos;
+    uint8_t tid, idx;
+
+    if ((rx_info->sta_idx >= NX_REMOTE_STA_MAX)
+            || (!amsdu && (((uint8_t *)p->payload)[0] & 0x01)))
+    {
+        /* group addressed frames never belong to a block ack session */
+        rwm_rx_reord_deliver(rx_info->vif_idx, p, amsdu);
+        return RW_SUCCESS;
+    }
+
+    tid = rwm_rx_reord_get_tid(rx_info);
+    s = (tid < TID_MAX) ? rwm_rx_reord_get_session(rx_info, tid) : NULL;
+    if (!s)
+    {
+        if ((tid < TID_MAX) && rwm_rx_reord_get_bam(rx_info->sta_idx, tid))
+        {
+            rwm_reord_stat.no_session ++;
+        }
+        rwm_rx_reord_deliver(rx_info->vif_idx, p, amsdu);
+        return RW_SUCCESS;
+    }
+
+    sn_pos = (rx_info->sn - s->win_start) & MAC_SEQCTRL_NUM_MAX;
+    if (sn_pos >= (MAC_SEQCTRL_NUM_MAX >> 1))
+    {
+        /* behind the window, already forwarded or given up */
+        rwm_reord_stat.drop ++;
+        pbuf_free(p);
+        return RW_FAILURE;
+    }
+
+    if (sn_pos >= s->win_size)
+    {
+        // Move the window so that this sn is its last slot
+        rwm_rx_reord_flush(s, sn_pos - s->win_size + 1);
+        rwm_rx_reord_fwd(s);
+        sn_pos = (rx_info->sn - s->win_start) & MAC_SEQCTRL_NUM_MAX;
+    }
+
+    idx = (s->pos + sn_pos) % s->win_size;
+    if (s->elt[idx] != NULL)
+    {
+        rwm_reord_stat.dup ++;
+        pbuf_free(p);
+        return RW_FAILURE;
+    }
+
+    if (sn_pos == 0)
+    {
+        rwm_reord_stat.in_order ++;
+        s->sn_rx_time = hal_machw_time();
+        rwm_rx_reord_advance(s);
+        rwm_rx_reord_deliver(s->vif_idx, p, amsdu);
+        rwm_rx_reord_fwd(s);
+    }
+    else
+    {
+        rwm_reord_stat.ooo ++;
+        s->elt[idx] = p;
+        if (amsdu)
+        {
+            s->amsdu_map |= CO_BIT(idx);
+        }
+        s->ooo_cnt ++;
+    }
+
+    rwm_rx_reord_timer_update(s);
+
+    return RW_SUCCESS;
+}
+
+void rwm_rx_reord_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < RWM_REORD_SESSION_NUM; i ++)
+    {
+        os_memset(&rwm_reord_sessions[i], 0, sizeof(rwm_reord_session));
+        rwm_reord_sessions[i].sta_idx = INVALID_STA_IDX;
+    }
+}
+
+void rwm_rx_reord_dump(void)
+{
+    uint32_t i;
+    rwm_reord_session *s;
+
+    for (i = 0; i < RWM_REORD_SESSION_NUM; i ++)
+    {
+        s = &rwm_reord_sessions[i];
+        if (s->sta_idx == INVALID_STA_IDX)
+        {
+            continue;
+        }
+        os_printf("reord[%d] sta:%d tid:%d win:%d ssn:%d token:%d start:%d ooo:%d\r\n", i,
+                  s->sta_idx, s->tid, s->win_size, s->ssn, s->dialog_token, s->win_start,
+                  s->ooo_cnt);
+    }
+    os_printf("reord in_order:%d ooo:%d drop:%d dup:%d timeout:%d flush:%d no_session:%d\r\n",
+              rwm_reord_stat.in_order, rwm_reord_stat.ooo, rwm_reord_stat.drop,
+              rwm_reord_stat.dup, rwm_reord_stat.timeout, rwm_reord_stat.flush,
+              rwm_reord_stat.no_session);
+}
+#endif // CFG_RWNX_REODER
+// eof
@@ -0,0 +1,77 @@
+/**
+ ****************************************************************************************
+ *
+ * @file rw_rx_reord.h
+ *
+ * @brief Per STA/TID RX reordering module.
+ *
+ * Copyright (C) BEKEN corperation 2021
+ *
+ ****************************************************************************************
+ */
+#ifndef _RW_RX_REORD_H_
+#define _RW_RX_REORD_H_
+/*
+ * INCLUDE FILES
+ ****************************************************************************************
+ */
+#include "rw_msdu.h"
+#include "mm_timer.h"
+
+#if CFG_RWNX_REODER
+/*
+ * TYPE and STRUCT DEFINITIONS
+ ****************************************************************************************
+ */
+#ifndef CFG_RWNX_REORD_SESSION_NUM
+#define CFG_RWNX_REORD_SESSION_NUM      4
+#endif
+#ifndef CFG_RWNX_REORD_WIN_MAX
+#define CFG_RWNX_REORD_WIN_MAX          32
+#endif
+
+#define RWM_REORD_SESSION_NUM           CFG_RWNX_REORD_SESSION_NUM
+#define RWM_REORD_WIN_MAX               CFG_RWNX_REORD_WIN_MAX
+#if (RWM_REORD_WIN_MAX > 32)
+#error "amsdu_map holds one bit per reordering slot"
+#endif
+
+//one reordering session, bound to a [sta_idx, tid] with an rx block ack agreement
+typedef struct rwm_reord_session_st {
+    struct mm_timer_tag timer;          //forwards the window when a sn never shows up
+    struct mac_addr peer;               //detects sta_idx reuse by another station
+    uint32_t sn_rx_time;                //time the last waited sn was received
+    uint32_t amsdu_map;                 //elt[] slots holding an a-msdu
+    uint16_t win_start;                 //seeded from the addba ssn
+    uint16_t ssn;                       //ssn and dialog token of the agreement, a new
+    uint8_t dialog_token;               //addba on the same tid restarts the session
+    uint8_t win_size;                   //negotiated in the addba, up to RWM_REORD_WIN_MAX
+    uint8_t pos;                        //elt[] slot of win_start
+    uint8_t ooo_cnt;
+    uint8_t sta_idx;                    //INVALID_STA_IDX when the session is free
+    uint8_t tid;
+    uint8_t vif_idx;
+    bool timer_on;
+    struct pbuf *elt[RWM_REORD_WIN_MAX];
+} rwm_reord_session;
+
+typedef struct rwm_reord_stats_st {
+    uint32_t in_order;
+    uint32_t ooo;                       //buffered, waiting for a lower sn
+    uint32_t drop;                      //sn behind the window
+    uint32_t dup;                       //sn already buffered
+    uint32_t timeout;                   //sn skipped after RX_CNTRL_REORD_MAX_WAIT
+    uint32_t flush;                     //frames pushed out by a window move or reset
+    uint32_t no_session;                //all sessions busy, frame passed through
+} rwm_reord_stats;
+
+/*
+ * FUNCTION DECLARATIONS
+ ****************************************************************************************
+ */
+void rwm_rx_reord_init(void);
+UINT32 rwm_rx_reord_handle(RW_RXIFO_PTR rx_info, struct pbuf *p);
+void rwm_rx_reord_dump(void);
+#endif // CFG_RWNX_REODER
+#endif // _RW_RX_REORD_H_
+// eof
@@ -159,7 +159,7 @@ static void rwm_push_bufing_data(MSDU_NODE_T *node, uint8_t client_idx)
         discard_node = rwm_pop_bufing_data(client_idx,flag);
 
         if(discard_node)
-            os_free(discard_node);
+            rwm_node_free(discard_node);
         else
         {
             return;
@@ -223,7 +223,7 @@ static void rwm_flush_bufing_list(uint8_t client_idx,uint8_t flag)
         {
             node_ptr = rwm_pop_bufing_data(client_idx,flag);
             if(node_ptr)
-                os_free(node_ptr);
+                rwm_node_free(node_ptr);
             else
                 break;
         }
@@ -51,6 +51,34 @@
 
 #define TVIDEO_RXBUF_LEN            (TVIDEO_RXNODE_SIZE_UDP * 4)
 
+// camera dma writes straight into the pool, which then is a ring of nodes
+#if (CFG_VIDEO_DMA_FRAME_RING && CFG_USE_CAMERA_INTF && CFG_GENERAL_DMA && TVIDEO_USE_HDR)
+#define TVIDEO_DMA_RING             1
+#else
+#define TVIDEO_DMA_RING             0
+#endif
+
+#if TVIDEO_DMA_RING
+#ifndef TVIDEO_RING_NODE_NUM
+#define TVIDEO_RING_NODE_NUM        40  // 57KB
+#endif
+#define TVIDEO_RING_HDR_ROOM        8   // pkt header room in front of node 0
+#define TVIDEO_FRAME_NUM            8
+#define TVIDEO_RING_LEN             (TVIDEO_RING_HDR_ROOM + TVIDEO_RING_NODE_NUM * TVIDEO_RXNODE_SIZE_UDP)
+
+#if (TVIDEO_RING_NODE_NUM * TVIDEO_RXNODE_SIZE_UDP > 0xFFFF)
+#error "dma ring length must fit rxbuf_len"
+#endif
+
+#if (TVIDEO_RING_NODE_NUM > TVIDEO_POOL_LEN / TVIDEO_RXNODE_SIZE)
+#define TVIDEO_ELEM_NUM             TVIDEO_RING_NODE_NUM
+#endif
+#endif
+
+#ifndef TVIDEO_ELEM_NUM
+#define TVIDEO_ELEM_NUM             (TVIDEO_POOL_LEN / TVIDEO_RXNODE_SIZE)
+#endif
+
 #define TVIDEO_STATUS_INIT          0
 #define TVIDEO_STATUS_OPENED        1
 #define TVIDEO_STATUS_RUNNING       2
@@ -70,7 +98,7 @@ typedef struct tvideo_pool_st
 {
     //UINT8*  pool[TVIDEO_POOL_LEN];
     UINT8 *pool;
-    TVIDEO_ELEM_ST elem[TVIDEO_POOL_LEN / TVIDEO_RXNODE_SIZE];
+    TVIDEO_ELEM_ST elem[TVIDEO_ELEM_NUM];
     struct co_list free;
     struct co_list ready;
 
@@ -91,6 +119,23 @@ typedef struct tvideo_pool_st
     tvideo_add_pkt_header add_pkt_header;
     #endif
 
+    #if TVIDEO_DMA_RING
+    UINT32 ring_mode;
+    UINT8 *ring;                    // node 0, header room in front of it
+    UINT32 node_wr;                 // node the dma fills, free running
+    UINT32 node_rd;                 // oldest node not released by the sender
+    UINT32 cur_first;               // first node of the frame being received
+    UINT32 cur_len;
+    UINT32 cur_drop;
+    UINT32 frm_wr;
+    UINT32 frm_rd;
+    UINT32 frm_seq;                 // frame being sent
+    UINT32 frm_sent;                // its nodes already sent
+    UINT32 hdr_node;                // node whose pkt header is written
+    TVIDEO_FRAME_ST frame[TVIDEO_FRAME_NUM];
+    TVIDEO_RING_STATS_ST stats;
+    #endif
+
     UINT32 status;
 } TVIDEO_POOL_ST, *TVIDEO_POOL_PTR;
 
@@ -140,11 +185,23 @@ void tvideo_intfer_send_msg(UINT32 new_msg)
 static void tvideo_pool_init(void *data)
 {
     UINT32 i = 0;
+    UINT32 pool_len = TVIDEO_POOL_LEN;
     TVIDEO_SETUP_DESC_PTR setup = (TVIDEO_SETUP_DESC_PTR)((int)data);
 
+    #if TVIDEO_DMA_RING
+    // the dma needs word aligned nodes, and the header goes right before them
+    tvideo_pool.ring_mode = (setup->open_type != TVIDEO_OPEN_SPIDMA)
+                            && (setup->pkt_header_size <= TVIDEO_RING_HDR_ROOM)
+                            && ((setup->pkt_header_size % 4) == 0);
+    if (tvideo_pool.ring_mode)
+    {
+        pool_len = TVIDEO_RING_LEN;
+    }
+    #endif
+
     if (tvideo_pool.pool == NULL)
     {
-        tvideo_pool.pool = os_malloc(sizeof(UINT8) * TVIDEO_POOL_LEN);
+        tvideo_pool.pool = os_malloc(sizeof(UINT8) * pool_len);
         if (tvideo_pool.pool == NULL)
         {
             TVIDEO_FATAL("tvideo_pool alloc failed\r\n");
@@ -152,7 +209,7 @@ static void tvideo_pool_init(void *data)
         }
     }
 
-    os_memset(&tvideo_pool.pool[0], 0, sizeof(UINT8)*TVIDEO_POOL_LEN);
+    os_memset(&tvideo_pool.pool[0], 0, sizeof(UINT8)*pool_len);
 
     co_list_init(&tvideo_pool.free);
     co_list_init(&tvideo_pool.ready);
@@ -300,6 +357,239 @@ static void tvideo_rx_handler(void *curptr, UINT32 newlen, UINT32 is_eof, UINT32
     tvideo_intfer_send_msg(TV_INT_POLL);
 }
 
+#if TVIDEO_DMA_RING
+static void tvideo_ring_init(UINT32 node_len)
+{
+    UINT32 i;
+
+    tvideo_pool.ring = tvideo_pool.pool + TVIDEO_RING_HDR_ROOM;
+    for (i = 0; i < TVIDEO_RING_NODE_NUM; i++)
+    {
+        tvideo_pool.elem[i].buf_start = tvideo_pool.ring + i * node_len;
+        tvideo_pool.elem[i].buf_len = 0;
+    }
+
+    tvideo_pool.node_wr = 0;
+    tvideo_pool.node_rd = 0;
+    tvideo_pool.cur_first = 0;
+    tvideo_pool.cur_len = 0;
+    tvideo_pool.cur_drop = 0;
+    tvideo_pool.frm_wr = 0;
+    tvideo_pool.frm_rd = 0;
+    tvideo_pool.frm_seq = 0;
+    tvideo_pool.frm_sent = 0;
+    tvideo_pool.hdr_node = (UINT32)-1;
+    os_memset(&tvideo_pool.stats, 0, sizeof(tvideo_pool.stats));
+
+    tvideo_st.rxbuf = tvideo_pool.ring;
+    tvideo_st.rxbuf_len = TVIDEO_RING_NODE_NUM * node_len;
+}
+
+// isr, give the nodes of the oldest queued frame back to the dma
+static void tvideo_ring_drop_oldest(void)
+{
+    TVIDEO_FRAME_PTR frm = &tvideo_pool.frame[tvideo_pool.frm_rd % TVIDEO_FRAME_NUM];
+
+    tvideo_pool.node_rd = frm->first + frm->node_cnt;
+    tvideo_pool.frm_rd++;
+    tvideo_pool.stats.drop_overrun++;
+}
+
+// isr, the dma has filled the node at curptr and moved on to the next one
+static void tvideo_ring_rx_handler(void *curptr, UINT32 newlen, UINT32 is_eof, UINT32 frame_len)
+{
+    UINT32 node, wr = tvideo_pool.node_wr;
+
+    do
+    {
+        if (!newlen)
+        {
+            break;
+        }
+
+        node = ((UINT8 *)curptr - tvideo_pool.ring) / tvideo_st.node_len;
+        if (node >= TVIDEO_RING_NODE_NUM)
+        {
+            break;
+        }
+
+        if (node != (wr % TVIDEO_RING_NODE_NUM))
+        {
+            // dma was restarted elsewhere, queued nodes may be overwritten
+            wr += (node + TVIDEO_RING_NODE_NUM - (wr % TVIDEO_RING_NODE_NUM)) % TVIDEO_RING_NODE_NUM;
+            tvideo_pool.frm_rd = tvideo_pool.frm_wr;
+            tvideo_pool.node_rd = wr;
+            tvideo_pool.cur_first = wr;
+            tvideo_pool.cur_len = 0;
+            tvideo_pool.cur_drop = 1;
+            tvideo_pool.stats.drop_resync++;
+        }
+
+        if (newlen > tvideo_st.node_len)
+        {
+            newlen = tvideo_st.node_len;
+        }
+        tvideo_pool.elem[node].buf_len = newlen;
+        tvideo_pool.cur_len += newlen;
+        tvideo_pool.node_wr = ++wr;
+
+        // keep the node the dma fills now, and the node in front of the
+        // oldest one (its tail is the header room), away from queued data
+        while ((wr - tvideo_pool.node_rd) >= (TVIDEO_RING_NODE_NUM - 1))
+        {
+            if (tvideo_pool.frm_rd != tvideo_pool.frm_wr)
+            {
+                tvideo_ring_drop_oldest();
+            }
+            else
+            {
+                // this frame alone fills the ring
+                if (!tvideo_pool.cur_drop)
+                {
+                    tvideo_pool.cur_drop = 1;
+                    tvideo_pool.stats.drop_oversize++;
+                }
+                tvideo_pool.node_rd = wr;
+            }
+        }
+
+        if (tvideo_pool.cur_drop)
+        {
+            tvideo_pool.node_rd = wr;
+        }
+    }
+    while (0);
+
+    tvideo_intfer_send_msg(TV_INT_POLL);
+}
+
+// isr, queue the frame received since the previous end of frame
+static void tvideo_ring_end_frame(void)
+{
+    TVIDEO_FRAME_PTR frm;
+    UINT32 cnt = tvideo_pool.node_wr - tvideo_pool.cur_first;
+
+    if (tvideo_pool.cur_drop)
+    {
+        tvideo_pool.node_rd = tvideo_pool.node_wr;
+    }
+    else if (cnt)
+    {
+        if ((tvideo_pool.frm_wr - tvideo_pool.frm_rd) >= TVIDEO_FRAME_NUM)
+        {
+            tvideo_ring_drop_oldest();
+        }
+
+        frm = &tvideo_pool.frame[tvideo_pool.frm_wr % TVIDEO_FRAME_NUM];
+        frm->first = tvideo_pool.cur_first;
+        frm->node_cnt = cnt;
+        frm->frame_id = tvideo_pool.frame_id;
+        frm->len = tvideo_pool.cur_len;
+        frm->time = rtos_get_time();
+        tvideo_pool.frm_wr++;
+        tvideo_pool.stats.frames++;
+    }
+
+    tvideo_pool.cur_first = tvideo_pool.node_wr;
+    tvideo_pool.cur_len = 0;
+    tvideo_pool.cur_drop = 0;
+}
+
+// send queued frames node by node, the pkt header is written in place
+static void tvideo_ring_poll_handler(void)
+{
+    TVIDEO_FRAME_ST frm;
+    TVIDEO_ELEM_PTR elem;
+    TV_HDR_PARAM_ST param;
+    UINT32 seq, node, send_len;
+    UINT32 hdr_size = tvideo_pool.pkt_header_size;
+    GLOBAL_INT_DECLARATION();
+
+    while (1)
+    {
+        GLOBAL_INT_DISABLE();
+        if (tvideo_pool.frm_rd == tvideo_pool.frm_wr)
+        {
+            GLOBAL_INT_RESTORE();
+            break;
+        }
+        seq = tvideo_pool.frm_rd;
+        frm = tvideo_pool.frame[seq % TVIDEO_FRAME_NUM];
+        GLOBAL_INT_RESTORE();
+
+        if (tvideo_pool.frm_seq != seq)
+        {
+            // previous frame was dropped between two polls
+            if (tvideo_pool.frm_sent)
+            {
+                tvideo_pool.stats.abort++;
+            }
+            tvideo_pool.frm_seq = seq;
+            tvideo_pool.frm_sent = 0;
+        }
+
+        while ((tvideo_pool.frm_sent < frm.node_cnt) && (tvideo_pool.frm_rd == seq))
+        {
+            node = frm.first + tvideo_pool.frm_sent;
+            elem = &tvideo_pool.elem[node % TVIDEO_RING_NODE_NUM];
+
+            // the room in front of a node is the tail of the previous one,
+            // which is sent already or released
+            param.ptk_ptr = (UINT8 *)elem->buf_start - hdr_size;
+            if (tvideo_pool.hdr_node != node)
+            {
+                param.ptklen = elem->buf_len;
+                param.frame_id = frm.frame_id;
+                param.is_eof = (tvideo_pool.frm_sent + 1 == frm.node_cnt);
+                param.frame_len = param.is_eof ? frm.node_cnt : 0;
+
+                if (tvideo_pool.add_pkt_header)
+                {
+                    tvideo_pool.add_pkt_header(&param);
+                }
+                tvideo_pool.hdr_node = node;
+            }
+
+            if (tvideo_pool.send_func)
+            {
+                send_len = tvideo_pool.send_func(param.ptk_ptr, elem->buf_len + hdr_size);
+                if (send_len != elem->buf_len + hdr_size)
+                {
+                    // try again on the next poll
+                    return;
+                }
+            }
+
+            tvideo_pool.frm_sent++;
+        }
+
+        GLOBAL_INT_DISABLE();
+        if (tvideo_pool.frm_rd == seq)
+        {
+            tvideo_pool.node_rd = frm.first + frm.node_cnt;
+            tvideo_pool.frm_rd++;
+            tvideo_pool.stats.sent++;
+        }
+        else
+        {
+            tvideo_pool.stats.abort++;
+        }
+        GLOBAL_INT_RESTORE();
+
+        tvideo_pool.frm_sent = 0;
+    }
+}
+
+void video_transfer_get_ring_stats(TVIDEO_RING_STATS_PTR stats)
+{
+    GLOBAL_INT_DECLARATION();
+
+    GLOBAL_INT_DISABLE();
+    os_memcpy(stats, &tvideo_pool.stats, sizeof(TVIDEO_RING_STATS_ST));
+    GLOBAL_INT_RESTORE();
+}
+#endif
+
 static void tvideo_end_frame_handler(void)
 {
     #if TVIDEO_DROP_DATA_NONODE
@@ -311,6 +601,13 @@ static void tvideo_end_frame_handler(void)
     }
     #endif
 
+    #if TVIDEO_DMA_RING
+    if (tvideo_pool.ring_mode)
+    {
+        tvideo_ring_end_frame();
+    }
+    #endif
+
     #if(TVIDEO_USE_HDR && CFG_USE_CAMERA_INTF)
     if (tvideo_pool.open_type != TVIDEO_OPEN_SPIDMA)
     {
@@ -373,6 +670,14 @@ static void tvideo_config_desc(void)
 
     tvideo_st.node_full_handler = tvideo_rx_handler;
     tvideo_st.data_end_handler = tvideo_end_frame_handler;
+
+    #if TVIDEO_DMA_RING
+    if (tvideo_pool.ring_mode)
+    {
+        tvideo_ring_init(node_len);
+        tvideo_st.node_full_handler = tvideo_ring_rx_handler;
+    }
+    #endif
 }
 
 static void tvideo_poll_handler(void)
@@ -446,6 +751,13 @@ static void video_transfer_main(beken_thread_arg_t data)
             switch (msg.data)
             {
             case TV_INT_POLL:
+                #if TVIDEO_DMA_RING
+                if (tvideo_pool.ring_mode)
+                {
+                    tvideo_ring_poll_handler();
+                    break;
+                }
+                #endif
                 tvideo_poll_handler();
                 break;
 
@@ -463,6 +775,16 @@ static void video_transfer_main(beken_thread_arg_t data)
 tvideo_exit:
     TVIDEO_PRT("video_transfer_main exit\r\n");
 
+    #if TVIDEO_DMA_RING
+    if (tvideo_pool.ring_mode)
+    {
+        TVIDEO_PRT("frames:%d sent:%d overrun:%d oversize:%d resync:%d abort:%d\r\n",
+                   tvideo_pool.stats.frames, tvideo_pool.stats.sent,
+                   tvideo_pool.stats.drop_overrun, tvideo_pool.stats.drop_oversize,
+                   tvideo_pool.stats.drop_resync, tvideo_pool.stats.abort);
+    }
+    #endif
+
     if (tvideo_pool.end_cb != NULL)
     {
         tvideo_pool.end_cb();
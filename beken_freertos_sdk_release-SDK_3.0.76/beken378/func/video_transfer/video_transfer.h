@@ -85,6 +85,28 @@ typedef struct tvideo_setup_desc
     tvideo_add_pkt_header add_pkt_header;
 } TVIDEO_SETUP_DESC_ST, *TVIDEO_SETUP_DESC_PTR;
 
+#if CFG_VIDEO_DMA_FRAME_RING
+// one complete frame in the dma ring, packets are consecutive ring nodes
+typedef struct tvideo_frame
+{
+    UINT32 first;           // ring node of the first packet, free running
+    UINT16 node_cnt;
+    UINT16 frame_id;
+    UINT32 len;             // jpeg bytes, without packet headers
+    UINT32 time;            // ms, end of frame
+} TVIDEO_FRAME_ST, *TVIDEO_FRAME_PTR;
+
+typedef struct tvideo_ring_stats
+{
+    UINT32 frames;          // frames completed by the camera
+    UINT32 sent;            // frames handed to send_func
+    UINT32 drop_overrun;    // oldest frames overwritten, sender too slow
+    UINT32 drop_oversize;   // frame larger than the ring
+    UINT32 drop_resync;     // dma restarted elsewhere, ring flushed
+    UINT32 abort;           // frame dropped while it was being sent
+} TVIDEO_RING_STATS_ST, *TVIDEO_RING_STATS_PTR;
+#endif
+
 #if (CFG_USE_SPIDMA || CFG_USE_CAMERA_INTF)
 void tvideo_intfer_send_msg(UINT32 new_msg);
 int video_transfer_init(TVIDEO_SETUP_DESC_PTR setup_cfg);
@@ -94,6 +116,10 @@ UINT32 video_transfer_set_video_param(UINT32 ppi, UINT32 fps);
 int video_buffer_open(void);
 int video_buffer_close(void);
 UINT32 video_buffer_read_frame(UINT8 *buf, UINT32 buf_len, int *err_code, UINT32 timeout);
+
+#if CFG_VIDEO_DMA_FRAME_RING
+void video_transfer_get_ring_stats(TVIDEO_RING_STATS_PTR stats);
+#endif
 #endif
 
 #endif // __VIDEO_TRANS_H__
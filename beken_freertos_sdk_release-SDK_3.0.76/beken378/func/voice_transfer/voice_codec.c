@@ -0,0 +1,126 @@
+#include "include.h"
+#include "voice_codec.h"
+
+#if (CFG_TVOICE_CODEC)
+/* ima adpcm, 4:1 on 16 bit pcm */
+static const INT16 tvoice_adpcm_step[89] =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const INT8 tvoice_adpcm_index[16] =
+{
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/* apply one code to the state, shared by both directions */
+static void tvoice_adpcm_step_state(TVO_ADPCM_STATE_ST *st, UINT8 code)
+{
+    INT32 step = tvoice_adpcm_step[st->index];
+    INT32 diff = step >> 3;
+    INT32 predict = st->predict;
+    INT32 index;
+
+    if (code & 4)
+        diff += step;
+    if (code & 2)
+        diff += step >> 1;
+    if (code & 1)
+        diff += step >> 2;
+
+    if (code & 8)
+        predict -= diff;
+    else
+        predict += diff;
+
+    if (predict > 32767)
+        predict = 32767;
+    else if (predict < -32768)
+        predict = -32768;
+
+    index = st->index + tvoice_adpcm_index[code];
+    if (index < 0)
+        index = 0;
+    else if (index > 88)
+        index = 88;
+
+    st->predict = (INT16)predict;
+    st->index = (UINT8)index;
+}
+
+static UINT8 tvoice_adpcm_code(TVO_ADPCM_STATE_ST *st, INT16 sample)
+{
+    INT32 step = tvoice_adpcm_step[st->index];
+    INT32 diff = sample - st->predict;
+    UINT8 code = 0;
+
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step)
+    {
+        code |= 4;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 2;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+        code |= 1;
+
+    tvoice_adpcm_step_state(st, code);
+
+    return code;
+}
+
+void tvoice_adpcm_reset(TVO_ADPCM_STATE_ST *st)
+{
+    st->predict = 0;
+    st->index = 0;
+    st->rsvd = 0;
+}
+
+int tvoice_adpcm_encode(TVO_ADPCM_STATE_ST *st, const INT16 *pcm, int samples, UINT8 *out)
+{
+    int i;
+
+    for (i = 0; i < samples; i++)
+    {
+        if (i & 1)
+            out[i >> 1] |= tvoice_adpcm_code(st, pcm[i]) << 4;
+        else
+            out[i >> 1] = tvoice_adpcm_code(st, pcm[i]);
+    }
+
+    return (samples + 1) / 2;
+}
+
+int tvoice_adpcm_decode(TVO_ADPCM_STATE_ST *st, const UINT8 *in, int samples, INT16 *pcm)
+{
+    int i;
+
+    for (i = 0; i < samples; i++)
+    {
+        tvoice_adpcm_step_state(st, (i & 1) ? (in[i >> 1] >> 4) : (in[i >> 1] & 0x0F));
+        pcm[i] = st->predict;
+    }
+
+    return (samples + 1) / 2;
+}
+#endif // (CFG_TVOICE_CODEC)
+// eof
@@ -0,0 +1,24 @@
+#ifndef __VOICE_CODEC_H__
+#define __VOICE_CODEC_H__
+
+#include "include.h"
+#include "typedef.h"
+
+/* codec id carried in every voice frame header */
+#define TVO_CODEC_PCM               1   /* 16 bit little endian */
+#define TVO_CODEC_IMA_ADPCM         2   /* 4 bit, low nibble first */
+#define TVO_CODEC_G722              3   /* reserved, needs 16k wideband input */
+
+typedef struct tvoice_adpcm_state
+{
+    INT16 predict;
+    UINT8 index;
+    UINT8 rsvd;
+} TVO_ADPCM_STATE_ST;
+
+void tvoice_adpcm_reset(TVO_ADPCM_STATE_ST *st);
+/* return the bytes written/used, (samples + 1) / 2 */
+int tvoice_adpcm_encode(TVO_ADPCM_STATE_ST *st, const INT16 *pcm, int samples, UINT8 *out);
+int tvoice_adpcm_decode(TVO_ADPCM_STATE_ST *st, const UINT8 *in, int samples, INT16 *pcm);
+
+#endif // __VOICE_CODEC_H__
@@ -17,6 +17,12 @@
 #include "general_dma_pub.h"
 #endif
 
+#if (CFG_TVOICE_CODEC)
+#include "voice_codec.h"
+// WB_FRAME_LEN sizes the packets, with or without the vad gate
+#include "vad.h"
+#endif
+
 //#include <finsh.h>
 #include <rtdevice.h>
 #include <drivers/audio.h>
@@ -44,9 +50,28 @@
 #define TVOICE_POOL_LEN             (TVOICE_RXNODE_SIZE * 3)  
 #define TVOICE_MSG_WAIT_TIME        (50)  // 1460 * (1/8000/2) = 0.09175 = 90ms 
 
+#if (CFG_TVOICE_VAD) && !(CFG_TVOICE_CODEC)
+#error "CFG_TVOICE_VAD needs the framed stream of CFG_TVOICE_CODEC"
+#endif
+
+#if (CFG_TVOICE_CODEC)
+// framed stream: a header and TVOICE_PKT_SAMPLES samples per packet, 80ms at 8k
+#define TVOICE_VAD_FRAME_LEN        (WB_FRAME_LEN)  // samples per wb_vad_entry()
+#define TVOICE_PKT_SAMPLES          (2 * TVOICE_VAD_FRAME_LEN)
+#define TVOICE_PKT_BYTES            (TVOICE_PKT_SAMPLES * sizeof(INT16))
+#define TVOICE_VAD_HANG             (4)    // packets still sent after the last speech
+#define TVO_FLAG_GAP                (0x01) // packets before this one were gated or dropped
+#endif
+
 typedef struct tvoice_hdr_st
 {
     UINT32 id;
+    #if (CFG_TVOICE_CODEC)
+    UINT8 codec;                    // TVO_CODEC_xx
+    UINT8 flags;
+    UINT16 samples;
+    TVO_ADPCM_STATE_ST adpcm;       // decoder state at the first sample
+    #endif
 }TVO_HDR_ST, *TVO_HDR_PTR;
 
 typedef struct tvoice_elem_st
@@ -72,6 +97,19 @@ typedef struct tvoice_desc
 
     rt_device_t adc_device;
     int n_channel;
+
+    #if (CFG_TVOICE_CODEC)
+    INT16 *pcm;
+    UINT32 pcm_fill;
+    UINT32 next_id;
+    TVO_ADPCM_STATE_ST adpcm;
+    UINT32 sent;
+    UINT32 gated;
+    #endif
+    #if (CFG_TVOICE_VAD)
+    int vad_on;
+    UINT32 hang;
+    #endif
 } TVOICE_DESC_ST, *TVOICE_DESC_PTR;
 
 TVOICE_DESC_ST tvoice_st;
@@ -107,7 +145,7 @@ void tvoice_intfer_send_msg(UINT32 new_msg)
     }
 }
 
-static void tvoice_pool_init(void* data)
+static int tvoice_pool_init(void* data)
 {
     UINT32 i = 0;
 
@@ -117,9 +155,24 @@ static void tvoice_pool_init(void* data)
         if(tvoice_st.pool == NULL)
         {
             TVOICE_WPRT("tvoice_pool alloc failed\r\n");
-            ASSERT(1);
+            return -1;
+        }
+    }
+    
+    #if (CFG_TVOICE_CODEC)
+    if(tvoice_st.pcm == NULL)
+    {
+        tvoice_st.pcm = sdram_malloc(TVOICE_PKT_BYTES);
+        if(tvoice_st.pcm == NULL)
+        {
+            TVOICE_WPRT("tvoice_pcm alloc failed\r\n");
+            return -1;
         }
     }
+    tvoice_st.pcm_fill = 0;
+    tvoice_st.next_id = 0;
+    tvoice_adpcm_reset(&tvoice_st.adpcm);
+    #endif
     
     co_list_init(&tvoice_st.free);
     co_list_init(&tvoice_st.ready);
@@ -141,6 +194,8 @@ static void tvoice_pool_init(void* data)
     tvoice_st.tv_hdr.id = 0;
     tvoice_st.elem_len -= sizeof(TVO_HDR_ST);
     #endif
+
+    return 0;
 }
 
 static void tvoice_send_audio_adc(void)
@@ -183,6 +238,93 @@ static rt_size_t tvoice_sound_read(char *buffer, rt_size_t size)
     return read_bytes;
 }
 
+#if (CFG_TVOICE_VAD)
+// speech in any vad frame opens the gate, it closes TVOICE_VAD_HANG packets later
+static int tvoice_packet_voiced(void)
+{
+    int i, speech = 0;
+
+    if(!tvoice_st.vad_on)
+        return 1;
+
+    for(i = 0; i < TVOICE_PKT_SAMPLES; i += TVOICE_VAD_FRAME_LEN)
+    {
+        if(wb_vad_entry((char *)&tvoice_st.pcm[i], TVOICE_VAD_FRAME_LEN * sizeof(INT16))
+            == WB_FRAME_TYPE_SPEECH)
+            speech = 1;
+    }
+
+    if(speech)
+        tvoice_st.hang = TVOICE_VAD_HANG + 1;
+    else if(tvoice_st.hang == 0)
+        return 0;
+
+    tvoice_st.hang--;
+    return 1;
+}
+#endif
+
+#if (CFG_TVOICE_CODEC)
+static void tvoice_encode_packet(TVOICE_ELEM_PTR elem)
+{
+    TVO_HDR_PTR hdr = (TVO_HDR_PTR)elem->buf_start;
+    UINT8 *payload = (UINT8 *)(hdr + 1);
+    UINT32 len;
+
+    hdr->id = tvoice_st.tv_hdr.id;
+    hdr->codec = CFG_TVOICE_CODEC;
+    hdr->flags = (hdr->id != tvoice_st.next_id) ? TVO_FLAG_GAP : 0;
+    hdr->samples = TVOICE_PKT_SAMPLES;
+    hdr->adpcm = tvoice_st.adpcm;
+
+    #if (CFG_TVOICE_CODEC == TVO_CODEC_IMA_ADPCM)
+    len = tvoice_adpcm_encode(&tvoice_st.adpcm, tvoice_st.pcm, TVOICE_PKT_SAMPLES, payload);
+    #else
+    len = TVOICE_PKT_BYTES;
+    os_memcpy(payload, tvoice_st.pcm, len);
+    #endif
+
+    elem->buf_len = sizeof(TVO_HDR_ST) + len;
+    tvoice_st.next_id = hdr->id + 1;
+    tvoice_st.sent++;
+}
+
+static int tvoice_read_audio_adc(void)
+{
+    TVOICE_ELEM_PTR elem = NULL;
+    rt_size_t read_bytes = 0;
+
+    read_bytes = tvoice_sound_read((char *)tvoice_st.pcm + tvoice_st.pcm_fill,
+                                   TVOICE_PKT_BYTES - tvoice_st.pcm_fill);
+    tvoice_st.pcm_fill += read_bytes;
+    if(tvoice_st.pcm_fill < TVOICE_PKT_BYTES)
+        return read_bytes;
+    tvoice_st.pcm_fill = 0;
+
+    #if (CFG_TVOICE_VAD)
+    if(!tvoice_packet_voiced())
+    {
+        // the id still counts it, the receiver sees the gap length
+        tvoice_st.tv_hdr.id++;
+        tvoice_st.gated++;
+        return read_bytes;
+    }
+    #endif
+
+    elem = (TVOICE_ELEM_PTR)co_list_pick(&tvoice_st.free);
+    if(elem) 
+    {
+        tvoice_encode_packet(elem);
+        co_list_pop_front(&tvoice_st.free);
+        co_list_push_back(&tvoice_st.ready, (struct co_list_hdr *)&elem->hdr);
+    } else {
+        TVOICE_WPRT("sound no node\r\n");
+    }
+    tvoice_st.tv_hdr.id++;
+
+    return read_bytes;
+}
+#else
 static int tvoice_read_audio_adc(void)
 {
     TVOICE_ELEM_PTR elem = NULL;
@@ -213,6 +355,7 @@ static int tvoice_read_audio_adc(void)
 
     return read_bytes;
 }
+#endif
 
 static int tvoice_init_audio_adc(void)
 {
@@ -231,6 +374,12 @@ static int tvoice_init_audio_adc(void)
     rt_device_control(tvoice_st.adc_device, CODEC_CMD_SET_CHANNEL, (void *)&channel); 
 
     rt_device_open(tvoice_st.adc_device, RT_DEVICE_OFLAG_RDONLY);
+
+    #if (CFG_TVOICE_VAD)
+    tvoice_st.vad_on = (wb_vad_enter() == VAD_RET_SUCCESS);
+    if(!tvoice_st.vad_on)
+        TVOICE_WPRT("vad init failed, no gating\r\n");
+    #endif
     
     return 0;
 }
@@ -247,7 +396,8 @@ static void tvoice_transfer_main( beken_thread_arg_t data )
     TVOICE_PRT("tvoice main\r\n");
 
     os_memset(&tvoice_st, 0, sizeof(TVOICE_DESC_ST));
-    tvoice_pool_init(data);
+    if(tvoice_pool_init(data))
+        goto tvoice_exit;
     
     if(tvoice_init_audio_adc())
         goto tvoice_exit;
@@ -278,6 +428,19 @@ static void tvoice_transfer_main( beken_thread_arg_t data )
 tvoice_exit:
     TVOICE_PRT("video_transfer_main exit\r\n");
 
+    #if (CFG_TVOICE_VAD)
+    if(tvoice_st.vad_on)
+        wb_vad_deinit();
+    #endif
+    #if (CFG_TVOICE_CODEC)
+    TVOICE_PRT("tvoice sent %d gated %d\r\n", tvoice_st.sent, tvoice_st.gated);
+    if(tvoice_st.pcm)
+    {
+        sdram_free(tvoice_st.pcm);
+        tvoice_st.pcm = NULL;
+    }
+    #endif
+
     if(tvoice_st.pool)
     {
         sdram_free(tvoice_st.pool);
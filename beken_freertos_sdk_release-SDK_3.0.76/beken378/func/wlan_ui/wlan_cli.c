@@ -54,6 +54,18 @@
 #include "bk_aware.h"
 #endif
 
+#if CFG_MSDU_TX_POOL
+#include "rw_msdu_pool.h"
+#endif
+
+#if CFG_RWNX_REODER
+#include "rw_rx_reord.h"
+#endif
+
+#if CFG_LWIP_HW_CSUM
+#include "ethernetif.h"
+#endif
+
 #if (CFG_SUPPORT_MATTER)
 #include "flash_namespace_value.h"
 #endif
@@ -1296,6 +1308,24 @@ void wifidebug_Command(char *pcWriteBuffer, int xWriteBufferLen, int argc, char
     os_printf("wifidebug_Command\r\n");
 }
 
+#if CFG_RWNX_REODER
+void reord_Command(char *pcWriteBuffer, int xWriteBufferLen, int argc, char **argv)
+{
+    rwm_rx_reord_dump();
+}
+#endif
+
+#if CFG_LWIP_HW_CSUM
+void csum_bench_Command(char *pcWriteBuffer, int xWriteBufferLen, int argc, char **argv)
+{
+    int mhz = 120;
+
+    if (argc > 1)
+        mhz = strtoul(argv[1], NULL, 0);
+    hw_ipcksum_bench(mhz);
+}
+#endif
+
 void ifconfig_Command(char *pcWriteBuffer, int xWriteBufferLen, int argc, char **argv)
 {
     char *msg = NULL;
@@ -1351,6 +1381,9 @@ void memory_show_Command(char *pcWriteBuffer, int xWriteBufferLen, int argc, cha
 {
 #if CFG_OS_FREERTOS
     cmd_printf("free memory %d\r\n", xPortGetFreeHeapSize());
+#if CFG_MSDU_TX_POOL
+    rwm_msdu_pool_dump();
+#endif
 #elif CFG_SUPPORT_LITEOS
 	LOS_MEM_POOL_STATUS status;
 	(void)LOS_MemInfoGet(m_aucSysMem0, &status);
@@ -4364,6 +4397,12 @@ static const struct cli_command built_ins[] =
 
     {"wifistate", "Show wifi state", wifistate_Command},
     {"blacklist", "Set ssid blacklist", blacklist_Command},
+#if CFG_RWNX_REODER
+    {"reord", "show rx reorder sessions", reord_Command},
+#endif
+#if CFG_LWIP_HW_CSUM
+    {"csum_bench", "csum_bench [cpu mhz]", csum_bench_Command},
+#endif
 
     // network
     {"ifconfig", "Show IP address", ifconfig_Command},
@@ -4478,6 +4517,12 @@ static const struct cli_command built_ins[] =
     {"exit", "CLI exit", cli_exit_handler},
     {"wifistate", "Show wifi state", wifistate_Command},
     {"blacklist", "Set ssid blacklist", blacklist_Command},
+#if CFG_RWNX_REODER
+    {"reord", "show rx reorder sessions", reord_Command},
+#endif
+#if CFG_LWIP_HW_CSUM
+    {"csum_bench", "csum_bench [cpu mhz]", csum_bench_Command},
+#endif
     // network
     {"ifconfig", "Show IP address", ifconfig_Command},
     {"ping", "ping <ip>", ping_Command},
@@ -53,6 +53,7 @@
 
 #if CFG_SUPPORT_OTA_HTTP
 #include "utils_httpc.h"
+#include "http_ota_wr.h"
 #endif
 
 #include "bk7011_cal_pub.h"
@@ -796,6 +797,263 @@ void fc_info_dec(struct wlan_fast_connect_info *fci)
 
 #define BSSID_INFO_ADDR            0x1e2000 /*reserve 4k for bssid info*/
 
+#if CFG_WLAN_FAST_CONNECT_PROFILES
+/*
+ * fast connect profiles: the net param sector keeps the last used networks,
+ * a header and an fci each. seq orders them by use and the oldest one is
+ * replaced when all slots are taken. a profile is picked by ssid and a
+ * digest of ssid and password, or by bssid and password.
+ */
+#define FCP_MAGIC                  0x31504346  /* "FCP1" */
+#define FCP_SECTOR_SIZE            4096
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t seq;
+	uint32_t digest;
+	uint32_t rsvd;
+	struct wlan_fast_connect_info fci;
+} FCP_REC_T;
+
+/* as many as asked for, as long as they fit the sector */
+#define FCP_NUM                    ((FCP_SECTOR_SIZE / sizeof(FCP_REC_T)) < CFG_WLAN_FAST_CONNECT_PROFILES ? \
+                                    (FCP_SECTOR_SIZE / sizeof(FCP_REC_T)) : CFG_WLAN_FAST_CONNECT_PROFILES)
+
+static UINT32 fcp_hit = 0;
+static UINT32 fcp_miss = 0;
+/* slot picked by the last bk_wlan_start_sta, checked against its digest */
+static int fcp_cur = -1;
+static uint32_t fcp_cur_digest = 0;
+
+static uint32_t fcp_digest(const char *ssid, const char *pwd)
+{
+	uint32_t hash = 0x811C9DC5;  /* fnv-1a */
+	int i;
+
+	for (i = 0; i < SSID_MAX_LEN && ssid[i]; i++)
+		hash = (hash ^ (uint8_t)ssid[i]) * 0x01000193;
+	hash *= 0x01000193;
+	for (; *pwd; pwd++)
+		hash = (hash ^ (uint8_t)*pwd) * 0x01000193;
+
+	return hash;
+}
+
+static bool fcp_rec_match(FCP_REC_T *rec, const char *ssid, const char *pwd, uint32_t digest)
+{
+	return rec->magic == FCP_MAGIC && rec->digest == digest &&
+		os_strncmp((char *)rec->fci.ssid, ssid, SSID_MAX_LEN) == 0 &&
+		os_strcmp((char *)rec->fci.pwd, pwd) == 0;
+}
+
+static FCP_REC_T *fcp_load(void)
+{
+	FCP_REC_T *tbl;
+	int i;
+
+	tbl = os_malloc(FCP_NUM * sizeof(FCP_REC_T));
+	if (tbl == NULL) {
+		bk_printf("fcp malloc failed!\n");
+		return NULL;
+	}
+
+	bk_flash_read(BK_PARTITION_NET_PARAM, 0, (uint8 *)tbl, FCP_NUM * sizeof(FCP_REC_T));
+	for (i = 0; i < FCP_NUM; i++) {
+		if (tbl[i].magic != FCP_MAGIC)
+			continue;
+#if (FAST_CONNECT_INFO_ENC_METHOD != ENC_METHOD_NULL)
+		fc_info_dec(&tbl[i].fci);
+#endif
+		/* an erased ssid would never end */
+		tbl[i].fci.ssid[SSID_MAX_LEN] = 0;
+		tbl[i].fci.pwd[sizeof(tbl[i].fci.pwd) - 1] = 0;
+	}
+
+	return tbl;
+}
+
+static void fcp_save(FCP_REC_T *tbl)
+{
+	uint32_t status;
+	uint32_t protect_flag, protect_param;
+	DD_HANDLE flash_hdl;
+	int i;
+
+#if (FAST_CONNECT_INFO_ENC_METHOD != ENC_METHOD_NULL)
+	for (i = 0; i < FCP_NUM; i++) {
+		if (tbl[i].magic == FCP_MAGIC)
+			fc_info_enc(&tbl[i].fci);
+	}
+#else
+	(void)i;
+#endif
+
+	flash_hdl = ddev_open(FLASH_DEV_NAME, (UINT32*)&status, 0);
+	ddev_control(flash_hdl, CMD_FLASH_GET_PROTECT, &protect_flag);
+	protect_param = FLASH_PROTECT_NONE;
+	ddev_control(flash_hdl, CMD_FLASH_SET_PROTECT, (void *)&protect_param);
+	bk_flash_erase(BK_PARTITION_NET_PARAM, 0, FCP_SECTOR_SIZE);
+	bk_flash_write(BK_PARTITION_NET_PARAM, 0, (uint8 *)tbl, FCP_NUM * sizeof(FCP_REC_T));
+	ddev_control(flash_hdl, CMD_FLASH_SET_PROTECT, (void *)&protect_flag);
+	ddev_close(flash_hdl);
+}
+
+int wlan_fast_connect_profile_find(const char *ssid, const char *key, const uint8_t *bssid,
+	struct wlan_fast_connect_info *fci)
+{
+	static const uint8_t zero_bssid[ETH_ALEN] = {0};
+	FCP_REC_T *tbl;
+	uint32_t digest;
+	int i, found = -1;
+
+	tbl = fcp_load();
+	if (tbl == NULL)
+		return -1;
+
+	digest = fcp_digest(ssid, key);
+	for (i = 0; i < FCP_NUM && found < 0; i++) {
+		if (fcp_rec_match(&tbl[i], ssid, key, digest))
+			found = i;
+	}
+	if (bssid && os_memcmp(bssid, zero_bssid, ETH_ALEN) == 0)
+		bssid = NULL;
+	for (i = 0; i < FCP_NUM && found < 0 && bssid; i++) {
+		if (tbl[i].magic == FCP_MAGIC &&
+			os_memcmp(tbl[i].fci.bssid, bssid, ETH_ALEN) == 0 &&
+			os_strcmp((char *)tbl[i].fci.pwd, key) == 0)
+			found = i;
+	}
+
+	if (found >= 0) {
+		os_memcpy(fci, &tbl[found].fci, sizeof(*fci));
+		fcp_cur = found;
+		fcp_cur_digest = tbl[found].digest;
+		fcp_hit++;
+	} else {
+		fcp_cur = -1;
+		fcp_miss++;
+	}
+	bk_printf("fcp %s, slot %d, hit %d miss %d\n", found >= 0 ? "hit" : "miss",
+		found, fcp_hit, fcp_miss);
+
+	os_free(tbl);
+
+	return found >= 0 ? 0 : -1;
+}
+
+void wlan_fast_connect_profile_stats(UINT32 *hit, UINT32 *miss)
+{
+	*hit = fcp_hit;
+	*miss = fcp_miss;
+}
+
+void wlan_fast_connect_profile_clear(void)
+{
+	FCP_REC_T *tbl;
+
+	tbl = os_zalloc(FCP_NUM * sizeof(FCP_REC_T));
+	if (tbl == NULL)
+		return;
+
+	fcp_save(tbl);
+	os_free(tbl);
+	fcp_cur = -1;
+}
+
+#if CFG_WLAN_FAST_CONNECT_STATIC_IP || CFG_WLAN_SUPPORT_FAST_DHCP
+static int fcp_clear_net_info(void)
+{
+	FCP_REC_T *tbl;
+
+	if (fcp_cur < 0)
+		return 1;
+
+	tbl = fcp_load();
+	if (tbl == NULL)
+		return 1;
+
+	if (tbl[fcp_cur].magic == FCP_MAGIC && tbl[fcp_cur].digest == fcp_cur_digest) {
+		os_memset(&tbl[fcp_cur].fci.net_info, 0, sizeof(tbl[fcp_cur].fci.net_info));
+		fcp_save(tbl);
+		bk_printf("clear only fci-net info\r\n");
+	}
+	os_free(tbl);
+
+	return 1;
+}
+#endif
+
+/* the most recently used profile */
+void wlan_read_fast_connect_info(struct wlan_fast_connect_info *fci)
+{
+	FCP_REC_T *tbl;
+	int i, last = -1;
+
+	os_memset(fci, 0, sizeof(*fci));
+
+	tbl = fcp_load();
+	if (tbl == NULL)
+		return;
+
+	for (i = 0; i < FCP_NUM; i++) {
+		if (tbl[i].magic == FCP_MAGIC && (last < 0 || tbl[i].seq > tbl[last].seq))
+			last = i;
+	}
+	if (last >= 0)
+		os_memcpy(fci, &tbl[last].fci, sizeof(*fci));
+
+	os_free(tbl);
+}
+
+/* store fci as the profile of its ssid and password, and make it the latest */
+void wlan_write_fast_connect_info(struct wlan_fast_connect_info *fci)
+{
+	FCP_REC_T *tbl;
+	uint32_t digest, seq = 0;
+	int i, slot = -1, empty = -1, oldest = -1;
+
+	tbl = fcp_load();
+	if (tbl == NULL)
+		return;
+
+	fci->ssid[SSID_MAX_LEN] = 0;
+	digest = fcp_digest((char *)fci->ssid, (char *)fci->pwd);
+	for (i = 0; i < FCP_NUM; i++) {
+		if (tbl[i].magic != FCP_MAGIC) {
+			if (empty < 0)
+				empty = i;
+			continue;
+		}
+		if (tbl[i].seq > seq)
+			seq = tbl[i].seq;
+		if (oldest < 0 || tbl[i].seq < tbl[oldest].seq)
+			oldest = i;
+		if (slot < 0 && fcp_rec_match(&tbl[i], (char *)fci->ssid, (char *)fci->pwd, digest))
+			slot = i;
+	}
+
+	/* already the latest and unchanged, spare the flash */
+	if (slot >= 0 && tbl[slot].seq == seq &&
+		!os_memcmp(&tbl[slot].fci, fci, sizeof(*fci)))
+		goto wr_exit;
+
+	if (slot < 0)
+		slot = empty >= 0 ? empty : oldest;
+
+	tbl[slot].magic = FCP_MAGIC;
+	tbl[slot].seq = seq + 1;
+	tbl[slot].digest = digest;
+	tbl[slot].rsvd = 0;
+	os_memcpy(&tbl[slot].fci, fci, sizeof(*fci));
+	fcp_save(tbl);
+
+	bk_printf("writed fci to flash, slot %d\n", slot);
+
+wr_exit:
+	os_free(tbl);
+}
+#else
 void wlan_read_fast_connect_info(struct wlan_fast_connect_info *fci)
 {
 	bk_flash_read(BK_PARTITION_NET_PARAM, 0, (uint8 *)fci, sizeof(*fci));
@@ -848,6 +1106,7 @@ wr_exit:
 	return;
 }
 #endif
+#endif
 
 #if CFG_WPA_CTRL_IFACE && CFG_WLAN_FAST_CONNECT && CFG_WLAN_FAST_CONNECT_DEAUTH_FIRST
 extern int me_mgmt_tx_mlme_before_connect(uint8_t *mpdu, int payload_size, uint8_t vif_index, uint16_t freq,
@@ -937,7 +1196,15 @@ static bool bk_wlan_fci_net_info_valid(struct wlan_fast_connect_info *fci)
 
 int bk_wlan_clear_fci_net_info(void)
 {
-#if CFG_WLAN_FAST_CONNECT_STATIC_IP || CFG_WLAN_SUPPORT_FAST_DHCP
+#if CFG_WPA_CTRL_IFACE && CFG_WLAN_FAST_CONNECT_PROFILES && \
+	(CFG_WLAN_FAST_CONNECT_STATIC_IP || CFG_WLAN_SUPPORT_FAST_DHCP)
+#if CFG_WLAN_SUPPORT_FAST_DHCP
+	ip4_addr_t zero = {.addr = 0};
+
+	dhcp_set_fast_dhcp_ip_address(zero);
+#endif
+	return fcp_clear_net_info();
+#elif CFG_WLAN_FAST_CONNECT_STATIC_IP || CFG_WLAN_SUPPORT_FAST_DHCP
 	UINT32 status;
 	DD_HANDLE flash_hdl;
 	uint8_t protect_flag, protect_param;
@@ -994,7 +1261,9 @@ OSStatus bk_wlan_start_sta(network_InitTypeDef_st *inNetworkInitPara)
 #if CFG_WPA_CTRL_IFACE
 #if CFG_WLAN_FAST_CONNECT || CFG_BSSID_FAST_CONNECT
 	struct wlan_fast_connect_info fci;
+#if !CFG_WLAN_FAST_CONNECT_PROFILES
 	int ssid_len, req_ssid_len;
+#endif
 	bool fci_valid __maybe_unused = false;
 	bool fast_connect __maybe_unused = false;
 #endif
@@ -1043,6 +1312,10 @@ OSStatus bk_wlan_start_sta(network_InitTypeDef_st *inNetworkInitPara)
     bk_wlan_sta_init(inNetworkInitPara);
 
 #if CFG_WPA_CTRL_IFACE && (CFG_WLAN_FAST_CONNECT || CFG_BSSID_FAST_CONNECT)
+#if CFG_WLAN_FAST_CONNECT_PROFILES
+	fci_valid = (wlan_fast_connect_profile_find(inNetworkInitPara->wifi_ssid,
+		inNetworkInitPara->wifi_key, (uint8_t *)inNetworkInitPara->wifi_bssid, &fci) == 0);
+#else
 	wlan_read_fast_connect_info(&fci);
 
 	ssid_len = os_strlen((char*)fci.ssid);
@@ -1060,17 +1333,18 @@ OSStatus bk_wlan_start_sta(network_InitTypeDef_st *inNetworkInitPara)
 	bk_printf("  chan: %d\n", fci.channel);
 	bk_printf("  desire ssid: |%s|\n", inNetworkInitPara->wifi_ssid);
 #endif
-	if ((ssid_len == req_ssid_len &&
+	fci_valid = (ssid_len == req_ssid_len &&
 		os_memcmp(inNetworkInitPara->wifi_ssid, fci.ssid, ssid_len) == 0 &&
 		os_strcmp(inNetworkInitPara->wifi_key, (char*)fci.pwd) == 0) ||
 	  (inNetworkInitPara->wifi_bssid &&
 		os_memcmp(inNetworkInitPara->wifi_bssid, fci.bssid, 6) == 0 &&
-		os_strcmp(inNetworkInitPara->wifi_key, (char*)fci.pwd) == 0)) {
+		os_strcmp(inNetworkInitPara->wifi_key, (char*)fci.pwd) == 0);
+#endif
+	if (fci_valid) {
 
 		chan = fci.channel;
 		psk = fci.psk;
 		psk_len = PMK_LEN * 2;
-		fci_valid = true;
 
 		bk_printf("fast_connect\n");
 		fast_connect = true;
@@ -2899,13 +3173,31 @@ int http_ota_download(const char *uri)
     httpclient_t httpclient;
     httpclient_data_t httpclient_data;
     char http_content[HTTP_RESP_CONTENT_LEN];
+#if HTTP_OTA_WR_RESUME
+    char http_header[128];
+    char etag[HTTP_OTA_WR_ETAG_LEN];
+    UINT32 offset;
+    int retry = 0;
+#endif
     #if AT_SERVICE_CFG
     http_is_ota = 1;
     #endif
+#if HTTP_OTA_WR_RESUME
+resume:
+#endif
     os_memset(&httpclient, 0, sizeof(httpclient_t));
     os_memset(&httpclient_data, 0, sizeof(httpclient_data));
     os_memset(&http_content, 0, sizeof(HTTP_RESP_CONTENT_LEN));
     httpclient.header = "Accept: text/xml,text/html,\r\n";
+#if HTTP_OTA_WR_RESUME
+    /* If-Range makes the server send the whole image again if it changed */
+    offset = http_ota_wr_resume_prepare(uri, etag);
+    if (offset) {
+        snprintf(http_header, sizeof(http_header), "%sRange: bytes=%u-\r\n%s%s%s",
+                 httpclient.header, offset, etag[0] ? "If-Range: " : "", etag, etag[0] ? "\r\n" : "");
+        httpclient.header = http_header;
+    }
+#endif
     httpclient_data.response_buf = http_content;
     httpclient_data.response_buf_len = HTTP_RESP_CONTENT_LEN;
     httpclient_data.response_content_len = HTTP_RESP_CONTENT_LEN;
@@ -2917,6 +3209,16 @@ int http_ota_download(const char *uri)
                             50000,
                             &httpclient_data);
 
+#if HTTP_OTA_WR_RESUME
+    /* only a lost or stalled connection is worth a Range request */
+    if ((ERROR_HTTP_CONN == ret || ERROR_HTTP_CLOSED == ret || ERROR_NET_TIMEOUT == ret)
+        && retry++ < HTTP_OTA_WR_RETRY_MAX) {
+        os_printf("ota interrupted, ret:%d, retry %d\r\n", ret, retry);
+        rtos_delay_milliseconds(1000);
+        goto resume;
+    }
+#endif
+
     if (0 != ret) {
         os_printf("request epoch time from remote server failed. ret:%d", ret);
     } else {
@@ -0,0 +1,31 @@
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include "include.h"
+#include "rtos_pub.h"
+
+/*
+ * host benchmarks of sdk modules on top of the posix port, each suite
+ * reports one line per case: iterations, time per op and throughput
+ */
+typedef struct
+{
+	const char *name;
+	void (*run)(UINT32 scale);
+} BENCH_SUITE;
+
+#define BENCH_START(t)              (t) = rtos_get_time_us()
+
+void bench_report(const char *name, UINT32 iterations, UINT64 start_us, UINT64 bytes);
+
+void bench_alloc(UINT32 scale);
+void bench_heap(UINT32 scale);
+void bench_rtos(UINT32 scale);
+void bench_kv(UINT32 scale);
+void bench_json(UINT32 scale);
+void bench_crypto(UINT32 scale);
+void bench_ecp(UINT32 scale);
+void bench_mqtt(UINT32 scale);
+
+#endif // _BENCH_H_
+// eof
@@ -0,0 +1,63 @@
+#include "include.h"
+#include <stdlib.h>
+#include "bench.h"
+#include "mem_pub.h"
+
+#define BENCH_ALLOC_SLOTS           256
+
+static UINT32 bench_alloc_seed = 1;
+
+static UINT32 bench_alloc_rand(void)
+{
+	bench_alloc_seed = bench_alloc_seed * 1103515245 + 12345;
+	return bench_alloc_seed >> 8;
+}
+
+/* pbuf and message sized blocks, freed in a random order */
+static void bench_alloc_mixed(UINT32 loops)
+{
+	void *slot[BENCH_ALLOC_SLOTS] = {0};
+	UINT64 start, bytes = 0;
+	UINT32 i, idx, size;
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		idx = bench_alloc_rand() % BENCH_ALLOC_SLOTS;
+		if (slot[idx]) {
+			os_free(slot[idx]);
+			slot[idx] = NULL;
+		} else {
+			size = 16 + bench_alloc_rand() % 1600;
+			slot[idx] = os_malloc(size);
+			bytes += size;
+		}
+	}
+	bench_report("malloc/free mixed", loops, start, 0);
+
+	for (i = 0; i < BENCH_ALLOC_SLOTS; i ++)
+		os_free(slot[i]);
+	(void)bytes;
+}
+
+static void bench_alloc_fixed(const char *name, UINT32 size, UINT32 loops, int zero)
+{
+	UINT64 start;
+	UINT32 i;
+	void *p;
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		p = zero ? os_zalloc(size) : os_malloc(size);
+		os_free(p);
+	}
+	bench_report(name, loops, start, 0);
+}
+
+void bench_alloc(UINT32 scale)
+{
+	bench_alloc_fixed("malloc/free 32", 32, 1000000 * scale, 0);
+	bench_alloc_fixed("malloc/free 1600", 1600, 1000000 * scale, 0);
+	bench_alloc_fixed("zalloc/free 1600", 1600, 1000000 * scale, 1);
+	bench_alloc_mixed(1000000 * scale);
+}
+// eof
@@ -0,0 +1,60 @@
+#include "include.h"
+#include <string.h>
+#include "bench.h"
+#include "mbedtls/sha256.h"
+#include "mbedtls/aes.h"
+#include "base_64.h"
+
+#define BENCH_CRYPTO_BUF            4096
+
+static unsigned char bench_crypto_buf[BENCH_CRYPTO_BUF];
+static unsigned char bench_crypto_out[BENCH_CRYPTO_BUF * 2];
+
+void bench_crypto(UINT32 scale)
+{
+	UINT32 loops = 5000 * scale;
+	mbedtls_sha256_context sha;
+	mbedtls_aes_context aes;
+	unsigned char key[32] = {0};
+	unsigned char iv[16] = {0};
+	unsigned char digest[32];
+	UINT64 start;
+	int out_len;
+	UINT32 i;
+
+	memset(bench_crypto_buf, 0x5a, sizeof(bench_crypto_buf));
+
+	mbedtls_sha256_init(&sha);
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		mbedtls_sha256_starts_ret(&sha, 0);
+		mbedtls_sha256_update_ret(&sha, bench_crypto_buf, sizeof(bench_crypto_buf));
+		mbedtls_sha256_finish_ret(&sha, digest);
+	}
+	bench_report("sha256 4KB", loops, start, (UINT64)loops * sizeof(bench_crypto_buf));
+	mbedtls_sha256_free(&sha);
+
+	mbedtls_aes_init(&aes);
+	mbedtls_aes_setkey_enc(&aes, key, 128);
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_ENCRYPT, sizeof(bench_crypto_buf), iv,
+							  bench_crypto_buf, bench_crypto_out);
+	bench_report("aes-128-cbc enc 4KB", loops, start, (UINT64)loops * sizeof(bench_crypto_buf));
+
+	mbedtls_aes_setkey_dec(&aes, key, 128);
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_DECRYPT, sizeof(bench_crypto_buf), iv,
+							  bench_crypto_out, bench_crypto_buf);
+	bench_report("aes-128-cbc dec 4KB", loops, start, (UINT64)loops * sizeof(bench_crypto_buf));
+	mbedtls_aes_free(&aes);
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		base64_encode(bench_crypto_buf, sizeof(bench_crypto_buf), &out_len, bench_crypto_out);
+	bench_report("base64 encode 4KB", loops, start, (UINT64)loops * sizeof(bench_crypto_buf));
+
+	bench_ecp(scale);
+}
+// eof
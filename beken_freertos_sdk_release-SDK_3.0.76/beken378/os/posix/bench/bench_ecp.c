@@ -0,0 +1,99 @@
+#include "include.h"
+#include <stdio.h>
+#include "bench.h"
+#include "mbedtls/ecdh.h"
+#include "mbedtls/ecdsa.h"
+
+/*
+ * part of the crypto suite, built against the mbedtls of the non matter
+ * build like ecp_alt.c: keygen is m * G and runs on the comb tables of
+ * ecp_comb_alt.c, timed again with them switched off to show what they
+ * save. The shared secret m * Q builds its table on the heap, ecdsa sign
+ * is one m * G plus the scalar arithmetic mod n.
+ */
+static UINT32 bench_ecp_seed = 1;
+
+/* fixed sequence, the timings do not depend on the entropy */
+static int bench_ecp_rng(void *ctx, unsigned char *buf, size_t len)
+{
+	while (len --) {
+		bench_ecp_seed = bench_ecp_seed * 1103515245 + 12345;
+		*buf ++ = (unsigned char)(bench_ecp_seed >> 16);
+	}
+
+	return 0;
+}
+
+static void bench_ecp_curve(mbedtls_ecp_group_id id, const char *curve, UINT32 loops)
+{
+	mbedtls_ecp_group grp;
+	mbedtls_ecp_point Q, peer_Q;
+	mbedtls_mpi d, peer_d, z, r, s;
+	unsigned char hash[32];
+	char name[40];
+	UINT64 start;
+	UINT32 i;
+
+	mbedtls_ecp_group_init(&grp);
+	mbedtls_ecp_point_init(&Q);
+	mbedtls_ecp_point_init(&peer_Q);
+	mbedtls_mpi_init(&d);
+	mbedtls_mpi_init(&peer_d);
+	mbedtls_mpi_init(&z);
+	mbedtls_mpi_init(&r);
+	mbedtls_mpi_init(&s);
+	bench_ecp_seed = 1;
+	bench_ecp_rng(NULL, hash, sizeof(hash));
+
+	if (mbedtls_ecp_group_load(&grp, id) != 0
+		|| mbedtls_ecdh_gen_public(&grp, &peer_d, &peer_Q, bench_ecp_rng, NULL) != 0) {
+		printf("  %s not available\n", curve);
+		goto exit;
+	}
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		mbedtls_ecdh_gen_public(&grp, &d, &Q, bench_ecp_rng, NULL);
+	snprintf(name, sizeof(name), "ecdh %s keygen", curve);
+	bench_report(name, loops, start, 0);
+
+	mbedtls_ecp_comb_rom_enabled = 0;
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		mbedtls_ecdh_gen_public(&grp, &d, &Q, bench_ecp_rng, NULL);
+	snprintf(name, sizeof(name), "ecdh %s keygen no rom", curve);
+	bench_report(name, loops, start, 0);
+	mbedtls_ecp_comb_rom_enabled = 1;
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		mbedtls_ecdh_compute_shared(&grp, &z, &peer_Q, &d, bench_ecp_rng, NULL);
+	snprintf(name, sizeof(name), "ecdh %s shared", curve);
+	bench_report(name, loops, start, 0);
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		mbedtls_ecdsa_sign(&grp, &r, &s, &d, hash, sizeof(hash), bench_ecp_rng, NULL);
+	snprintf(name, sizeof(name), "ecdsa %s sign", curve);
+	bench_report(name, loops, start, 0);
+
+	if (mbedtls_ecdsa_verify(&grp, hash, sizeof(hash), &Q, &r, &s) != 0)
+		printf("  ecdsa %s sign gave a bad signature\n", curve);
+
+exit:
+	mbedtls_mpi_free(&s);
+	mbedtls_mpi_free(&r);
+	mbedtls_mpi_free(&z);
+	mbedtls_mpi_free(&peer_d);
+	mbedtls_mpi_free(&d);
+	mbedtls_ecp_point_free(&peer_Q);
+	mbedtls_ecp_point_free(&Q);
+	mbedtls_ecp_group_free(&grp);
+}
+
+void bench_ecp(UINT32 scale)
+{
+	bench_ecp_curve(MBEDTLS_ECP_DP_SECP256R1, "p-256", 50 * scale);
+	bench_ecp_curve(MBEDTLS_ECP_DP_SECP384R1, "p-384", 50 * scale);
+}
+// eof
@@ -0,0 +1,216 @@
+#include "include.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+/*
+ * replay of one allocation trace through heap_tlsf.c, heap_4.c and libc.
+ * BK_HOST_HEAP_TRACE=<file> replays the "m:"/"f:" lines a target prints
+ * with OSMALLOC_STATISTICAL, otherwise a built in trace shaped like a
+ * station: long lived blocks from boot, then messages, pbufs and tls
+ * records of mixed lifetimes. Host headers are twice the target ones, so
+ * the free heap figures are a bit pessimistic for both target heaps.
+ */
+#define BENCH_HEAP_SLOTS            1024
+#define BENCH_HEAP_OPS_MAX          (256 * 1024)
+#define BENCH_HEAP_BOOT_BLOCKS      48
+#define BENCH_HEAP_CHURN_SLOTS      96
+#define BENCH_HEAP_CHURN_OPS        20000
+/* heap_4 header on the target, the trace sizes include it */
+#define BENCH_HEAP_TARGET_HDR       8
+
+typedef struct
+{
+	UINT16 slot;
+	UINT16 free;
+	UINT32 size;
+} BENCH_HEAP_OP;
+
+typedef struct
+{
+	const char *name;
+	void *(*alloc)(size_t size);
+	void (*free)(void *ptr);
+	size_t (*min_free)(void);
+} BENCH_HEAP;
+
+/* heap_tlsf.c, and heap_4.c with its symbols renamed by host.mk */
+void *pvPortMalloc(size_t xWantedSize);
+void vPortFree(void *pv);
+size_t xPortGetMinimumEverFreeHeapSize(void);
+void *heap4_pvPortMalloc(size_t xWantedSize);
+void heap4_vPortFree(void *pv);
+size_t heap4_xPortGetMinimumEverFreeHeapSize(void);
+
+static BENCH_HEAP_OP *bench_heap_ops;
+static UINT32 bench_heap_op_cnt;
+static UINT32 bench_heap_seed = 1;
+
+static UINT32 bench_heap_rand(void)
+{
+	bench_heap_seed = bench_heap_seed * 1103515245 + 12345;
+	return bench_heap_seed >> 8;
+}
+
+static void bench_heap_push(UINT32 slot, UINT32 size, int free)
+{
+	if (bench_heap_op_cnt >= BENCH_HEAP_OPS_MAX)
+		return;
+
+	bench_heap_ops[bench_heap_op_cnt].slot = slot;
+	bench_heap_ops[bench_heap_op_cnt].free = free;
+	bench_heap_ops[bench_heap_op_cnt].size = size;
+	bench_heap_op_cnt ++;
+}
+
+static UINT32 bench_heap_churn_size(void)
+{
+	UINT32 r = bench_heap_rand() % 100;
+
+	if (r < 60)
+		return 16 + bench_heap_rand() % 240;    // kernel messages, small structs
+	if (r < 90)
+		return 1536 + bench_heap_rand() % 128;  // pbufs
+	return 4096 + bench_heap_rand() % 1024;     // tls records, flash sectors
+}
+
+static void bench_heap_build(void)
+{
+	UINT8 live[BENCH_HEAP_SLOTS] = {0};
+	UINT32 i, slot;
+
+	bench_heap_op_cnt = 0;
+	bench_heap_seed = 1;
+
+	/* tasks, stacks and tables that stay for good */
+	for (i = 0; i < BENCH_HEAP_BOOT_BLOCKS; i ++)
+		bench_heap_push(i, 64 + bench_heap_rand() % 1536, 0);
+
+	for (i = 0; i < BENCH_HEAP_CHURN_OPS; i ++) {
+		slot = BENCH_HEAP_BOOT_BLOCKS + bench_heap_rand() % BENCH_HEAP_CHURN_SLOTS;
+		bench_heap_push(slot, live[slot] ? 0 : bench_heap_churn_size(), live[slot]);
+		live[slot] = !live[slot];
+	}
+
+	for (slot = 0; slot < BENCH_HEAP_SLOTS; slot ++) {
+		if (live[slot] || slot < BENCH_HEAP_BOOT_BLOCKS)
+			bench_heap_push(slot, 0, 1);
+	}
+}
+
+static int bench_heap_load(const char *path)
+{
+	unsigned long addr[BENCH_HEAP_SLOTS] = {0};
+	unsigned long ptr;
+	char line[256];
+	char *tag;
+	int size;
+	UINT32 slot;
+	FILE *fp;
+
+	fp = fopen(path, "r");
+	if (fp == NULL)
+		return -1;
+
+	bench_heap_op_cnt = 0;
+	while (fgets(line, sizeof(line), fp)) {
+		if ((tag = strstr(line, "m:")) && sscanf(tag, "m:%lx,%d", &ptr, &size) == 2) {
+			for (slot = 0; slot < BENCH_HEAP_SLOTS && addr[slot]; slot ++)
+				;
+			if (slot == BENCH_HEAP_SLOTS)
+				continue;
+			addr[slot] = ptr;
+			bench_heap_push(slot, (size > BENCH_HEAP_TARGET_HDR) ? size - BENCH_HEAP_TARGET_HDR : 4, 0);
+		} else if ((tag = strstr(line, "f:")) && sscanf(tag, "f:%lx,%d", &ptr, &size) == 2) {
+			/* blocks allocated before the capture started are not replayed */
+			for (slot = 0; slot < BENCH_HEAP_SLOTS && addr[slot] != ptr; slot ++)
+				;
+			if (slot == BENCH_HEAP_SLOTS || ptr == 0)
+				continue;
+			addr[slot] = 0;
+			bench_heap_push(slot, 0, 1);
+		}
+	}
+	fclose(fp);
+
+	for (slot = 0; slot < BENCH_HEAP_SLOTS; slot ++) {
+		if (addr[slot])
+			bench_heap_push(slot, 0, 1);
+	}
+
+	return 0;
+}
+
+static void bench_heap_replay(const BENCH_HEAP *heap, UINT32 passes)
+{
+	void *slot[BENCH_HEAP_SLOTS] = {0};
+	const BENCH_HEAP_OP *op;
+	UINT32 i, pass, fails = 0;
+	char name[40];
+	UINT64 start;
+
+	BENCH_START(start);
+	for (pass = 0; pass < passes; pass ++) {
+		for (i = 0; i < bench_heap_op_cnt; i ++) {
+			op = &bench_heap_ops[i];
+			if (op->free) {
+				heap->free(slot[op->slot]);
+				slot[op->slot] = NULL;
+			} else {
+				slot[op->slot] = heap->alloc(op->size);
+				if (slot[op->slot] == NULL)
+					fails ++;
+			}
+		}
+	}
+	snprintf(name, sizeof(name), "trace %s", heap->name);
+	bench_report(name, bench_heap_op_cnt * passes, start, 0);
+
+	if (heap->min_free)
+		printf("  %-28s %9u failed %8u B min free\n", name, fails / passes, (UINT32)heap->min_free());
+}
+
+static void *bench_heap_libc_alloc(size_t size)
+{
+	return malloc(size);
+}
+
+static void bench_heap_libc_free(void *ptr)
+{
+	free(ptr);
+}
+
+static const BENCH_HEAP bench_heaps[] =
+{
+	{"tlsf",    pvPortMalloc,        vPortFree,        xPortGetMinimumEverFreeHeapSize},
+	{"heap_4",  heap4_pvPortMalloc,  heap4_vPortFree,  heap4_xPortGetMinimumEverFreeHeapSize},
+	{"libc",    bench_heap_libc_alloc, bench_heap_libc_free, NULL},
+};
+
+void bench_heap(UINT32 scale)
+{
+	const char *path = getenv("BK_HOST_HEAP_TRACE");
+	UINT32 i, passes = 20 * scale;
+
+	bench_heap_ops = malloc(BENCH_HEAP_OPS_MAX * sizeof(BENCH_HEAP_OP));
+	if (bench_heap_ops == NULL)
+		return;
+
+	if (path) {
+		if (bench_heap_load(path) != 0) {
+			printf("  can not read %s\n", path);
+			free(bench_heap_ops);
+			return;
+		}
+		printf("  %u ops from %s\n", bench_heap_op_cnt, path);
+	} else {
+		bench_heap_build();
+	}
+
+	for (i = 0; i < sizeof(bench_heaps) / sizeof(bench_heaps[0]); i ++)
+		bench_heap_replay(&bench_heaps[i], passes);
+
+	free(bench_heap_ops);
+}
+// eof
@@ -0,0 +1,55 @@
+#include "include.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "cJSON.h"
+
+/* a typical cloud property report */
+static const char bench_json_doc[] =
+	"{\"method\":\"report\",\"id\":\"12345\",\"version\":\"1.0\","
+	"\"params\":{\"switch\":1,\"brightness\":80,\"color_temp\":4000,"
+	"\"rgb\":[255,128,64],\"mode\":\"scene\",\"fw\":\"3.0.76\","
+	"\"rssi\":-52,\"uptime\":86400,\"name\":\"living room lamp\"}}";
+
+void bench_json(UINT32 scale)
+{
+	UINT32 loops = 100000 * scale;
+	UINT32 len = strlen(bench_json_doc);
+	cJSON *root, *params;
+	UINT64 start;
+	char *out;
+	UINT32 i;
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		root = cJSON_Parse(bench_json_doc);
+		cJSON_Delete(root);
+	}
+	bench_report("parse", loops, start, (UINT64)loops * len);
+
+	root = cJSON_Parse(bench_json_doc);
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		out = cJSON_PrintUnformatted(root);
+		free(out);
+	}
+	bench_report("print unformatted", loops, start, (UINT64)loops * len);
+	cJSON_Delete(root);
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		root = cJSON_CreateObject();
+		params = cJSON_CreateObject();
+		cJSON_AddStringToObject(root, "method", "report");
+		cJSON_AddNumberToObject(params, "switch", 1);
+		cJSON_AddNumberToObject(params, "brightness", i & 0x7f);
+		cJSON_AddStringToObject(params, "mode", "scene");
+		cJSON_AddItemToObject(root, "params", params);
+		out = cJSON_PrintUnformatted(root);
+		free(out);
+		cJSON_Delete(root);
+	}
+	bench_report("build+print", loops, start, 0);
+}
+// eof
@@ -0,0 +1,56 @@
+#include "include.h"
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "easyflash.h"
+#include "flash_posix.h"
+
+#define BENCH_KV_KEYS               16
+
+static void bench_kv_stats(const char *name, UINT32 loops)
+{
+	FLASH_POSIX_STATS stats;
+
+	flash_posix_get_stats(&stats);
+	printf("  %-28s %9.1f B written/op %6.2f erases/op\n", name,
+		   (double)stats.write_bytes / loops, (double)stats.erase_sectors / loops);
+}
+
+void bench_kv(UINT32 scale)
+{
+	char key[16], value[64];
+	UINT32 loops = 2000 * scale;
+	UINT64 start;
+	UINT32 i;
+
+	if (easyflash_init() != EF_NO_ERR) {
+		printf("  easyflash init failed\n");
+		return;
+	}
+
+	for (i = 0; i < BENCH_KV_KEYS; i ++) {
+		snprintf(key, sizeof(key), "key%u", i);
+		snprintf(value, sizeof(value), "value-%u", i);
+		ef_set_env(key, value);
+	}
+	ef_save_env();
+
+	BENCH_START(start);
+	for (i = 0; i < loops * 10; i ++) {
+		snprintf(key, sizeof(key), "key%u", i % BENCH_KV_KEYS);
+		if (ef_get_env(key) == NULL)
+			break;
+	}
+	bench_report("get", loops * 10, start, 0);
+
+	flash_posix_reset_stats();
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		snprintf(key, sizeof(key), "key%u", i % BENCH_KV_KEYS);
+		snprintf(value, sizeof(value), "value-%u-%u", i % BENCH_KV_KEYS, i);
+		ef_set_and_save_env(key, value);
+	}
+	bench_report("set+save", loops, start, 0);
+	bench_kv_stats("set+save flash cost", loops);
+}
+// eof
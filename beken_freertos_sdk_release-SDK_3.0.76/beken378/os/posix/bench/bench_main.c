@@ -0,0 +1,85 @@
+#include "include.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "drv_model_pub.h"
+#include "flash_pub.h"
+
+static const BENCH_SUITE bench_suites[] =
+{
+	{"alloc",   bench_alloc},
+	{"heap",    bench_heap},
+	{"rtos",    bench_rtos},
+	{"kv",      bench_kv},
+	{"json",    bench_json},
+	{"crypto",  bench_crypto},
+	{"mqtt",    bench_mqtt},
+};
+
+void bench_report(const char *name, UINT32 iterations, UINT64 start_us, UINT64 bytes)
+{
+	UINT64 elapsed = rtos_get_time_us() - start_us;
+	double sec;
+
+	if (elapsed == 0)
+		elapsed = 1;
+	sec = elapsed / 1000000.0;
+
+	printf("  %-28s %9u ops %10.3f us/op", name, iterations, (double)elapsed / iterations);
+	if (bytes)
+		printf(" %9.2f MB/s", bytes / sec / (1024 * 1024));
+	printf("\n");
+}
+
+static void bench_usage(const char *prog)
+{
+	UINT32 i;
+
+	printf("usage: %s [-s scale] [suite ...]\n  suites:", prog);
+	for (i = 0; i < sizeof(bench_suites) / sizeof(bench_suites[0]); i ++)
+		printf(" %s", bench_suites[i].name);
+	printf("\n  BK_HOST_FLASH=<file> keeps the flash image in a file\n");
+	printf("  BK_HOST_HEAP_TRACE=<file> replays an OSMALLOC_STATISTICAL log in the heap suite\n");
+}
+
+int main(int argc, char **argv)
+{
+	UINT32 scale = 1;
+	UINT32 i;
+	int arg = 1;
+	int ran = 0;
+
+	if (arg + 1 < argc && strcmp(argv[arg], "-s") == 0) {
+		scale = strtoul(argv[arg + 1], NULL, 0);
+		if (scale == 0)
+			scale = 1;
+		arg += 2;
+	}
+
+	drv_model_init();
+	flash_init();
+
+	for (i = 0; i < sizeof(bench_suites) / sizeof(bench_suites[0]); i ++) {
+		int j, selected = (arg >= argc);
+
+		for (j = arg; j < argc; j ++) {
+			if (strcmp(argv[j], bench_suites[i].name) == 0)
+				selected = 1;
+		}
+		if (!selected)
+			continue;
+
+		printf("[%s]\n", bench_suites[i].name);
+		bench_suites[i].run(scale);
+		ran ++;
+	}
+
+	if (ran == 0) {
+		bench_usage(argv[0]);
+		return 1;
+	}
+
+	return 0;
+}
+// eof
@@ -0,0 +1,89 @@
+#include "include.h"
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "MQTTPacket.h"
+#include "mqtt_topic_trie.h"
+
+#define BENCH_MQTT_BUF              512
+#define BENCH_MQTT_FILTERS          32
+
+static void bench_mqtt_count(void *arg, unsigned short index)
+{
+	(*(UINT32 *)arg) ++;
+}
+
+/* gateway style subscription table: per device filters plus a few wildcards */
+static void bench_mqtt_topic(UINT32 loops)
+{
+	static const char *topics[] =
+	{
+		"gw/dev17/cmd/set",
+		"gw/dev03/ota/url",
+		"gw/broadcast/time",
+		"other/tree/that/matches/nothing",
+	};
+	struct mqtt_topic_node *root = NULL;
+	char filter[32];
+	UINT32 hits = 0;
+	UINT64 start;
+	UINT32 i;
+
+	for (i = 0; i < BENCH_MQTT_FILTERS - 3; i ++) {
+		snprintf(filter, sizeof(filter), "gw/dev%02u/cmd/+", i);
+		mqtt_topic_trie_add(&root, filter, i);
+	}
+	mqtt_topic_trie_add(&root, "gw/+/ota/#", i ++);
+	mqtt_topic_trie_add(&root, "gw/broadcast/#", i ++);
+	mqtt_topic_trie_add(&root, "$SYS/#", i ++);
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		const char *topic = topics[i % (sizeof(topics) / sizeof(topics[0]))];
+
+		mqtt_topic_trie_match(root, topic, strlen(topic), bench_mqtt_count, &hits);
+	}
+	bench_report("topic match (32 filters)", loops, start, 0);
+
+	mqtt_topic_trie_free(root);
+}
+
+void bench_mqtt(UINT32 scale)
+{
+	UINT32 loops = 500000 * scale;
+	unsigned char buf[BENCH_MQTT_BUF];
+	unsigned char payload[128];
+	MQTTString topic = MQTTString_initializer;
+	MQTTString topic_out;
+	unsigned char dup, retained;
+	unsigned short packetid;
+	unsigned char *payload_out;
+	int payload_len, qos, len = 0;
+	UINT64 start;
+	UINT32 i;
+
+	memset(payload, 'p', sizeof(payload));
+	topic.cstring = "devices/bk7238/events/telemetry";
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		len = MQTTSerialize_publish(buf, sizeof(buf), 0, 1, 0, (unsigned short)i, topic,
+									payload, sizeof(payload));
+	bench_report("serialize publish", loops, start, (UINT64)loops * len);
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++)
+		MQTTDeserialize_publish(&dup, &qos, &retained, &packetid, &topic_out,
+								&payload_out, &payload_len, buf, len);
+	bench_report("deserialize publish", loops, start, (UINT64)loops * len);
+
+	BENCH_START(start);
+	for (i = 0; i < loops; i ++) {
+		len = MQTTSerialize_puback(buf, sizeof(buf), (unsigned short)i);
+		MQTTDeserialize_ack(&retained, &dup, &packetid, buf, len);
+	}
+	bench_report("puback round trip", loops, start, 0);
+
+	bench_mqtt_topic(loops);
+}
+// eof
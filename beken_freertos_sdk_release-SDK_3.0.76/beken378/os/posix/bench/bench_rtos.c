@@ -0,0 +1,76 @@
+#include "include.h"
+#include "bench.h"
+#include "rtos_pub.h"
+
+typedef struct
+{
+	beken_queue_t queue;
+	beken_semaphore_t ping;
+	beken_semaphore_t pong;
+	beken_semaphore_t done;
+	UINT32 loops;
+} BENCH_RTOS_ST;
+
+static void bench_rtos_consumer(beken_thread_arg_t arg)
+{
+	BENCH_RTOS_ST *st = (BENCH_RTOS_ST *)arg;
+	UINT32 msg[4];
+	UINT32 i;
+
+	for (i = 0; i < st->loops; i ++)
+		rtos_pop_from_queue(&st->queue, msg, BEKEN_WAIT_FOREVER);
+
+	rtos_set_semaphore(&st->done);
+	rtos_delete_thread(NULL);
+}
+
+static void bench_rtos_ponger(beken_thread_arg_t arg)
+{
+	BENCH_RTOS_ST *st = (BENCH_RTOS_ST *)arg;
+	UINT32 i;
+
+	for (i = 0; i < st->loops; i ++) {
+		rtos_get_semaphore(&st->ping, BEKEN_WAIT_FOREVER);
+		rtos_set_semaphore(&st->pong);
+	}
+
+	rtos_set_semaphore(&st->done);
+	rtos_delete_thread(NULL);
+}
+
+void bench_rtos(UINT32 scale)
+{
+	BENCH_RTOS_ST st;
+	UINT32 msg[4] = {0};
+	UINT64 start;
+	UINT32 i;
+
+	st.loops = 200000 * scale;
+	rtos_init_queue(&st.queue, "bench", sizeof(msg), 32);
+	rtos_init_semaphore(&st.ping, 1);
+	rtos_init_semaphore(&st.pong, 1);
+	rtos_init_semaphore(&st.done, 1);
+
+	BENCH_START(start);
+	rtos_create_thread(NULL, 5, "bench_rx", bench_rtos_consumer, 1024, &st);
+	for (i = 0; i < st.loops; i ++)
+		rtos_push_to_queue(&st.queue, msg, BEKEN_WAIT_FOREVER);
+	rtos_get_semaphore(&st.done, BEKEN_WAIT_FOREVER);
+	bench_report("queue push/pop 16B", st.loops, start, (UINT64)st.loops * sizeof(msg));
+
+	st.loops = 50000 * scale;
+	BENCH_START(start);
+	rtos_create_thread(NULL, 5, "bench_pong", bench_rtos_ponger, 1024, &st);
+	for (i = 0; i < st.loops; i ++) {
+		rtos_set_semaphore(&st.ping);
+		rtos_get_semaphore(&st.pong, BEKEN_WAIT_FOREVER);
+	}
+	rtos_get_semaphore(&st.done, BEKEN_WAIT_FOREVER);
+	bench_report("semaphore ping-pong", st.loops, start, 0);
+
+	rtos_deinit_semaphore(&st.done);
+	rtos_deinit_semaphore(&st.pong);
+	rtos_deinit_semaphore(&st.ping);
+	rtos_deinit_queue(&st.queue);
+}
+// eof
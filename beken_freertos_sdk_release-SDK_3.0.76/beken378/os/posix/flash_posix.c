@@ -0,0 +1,267 @@
+#include "include.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "arm_arch.h"
+#include "drv_model_pub.h"
+#include "flash_pub.h"
+#include "flash.h"
+#include "flash_posix.h"
+#include "BkDriverFlash.h"
+#include "uart_pub.h"
+#include "mem_pub.h"
+
+/*
+ * Host flash device. It keeps nor semantics so that flash users behave as
+ * on the chip: programming can only clear bits, an erase sets a 4KB sector
+ * back to 0xff and the protect state of CMD_FLASH_SET_PROTECT is enforced.
+ * With BK_HOST_FLASH=<file> the array is a shared mapping of that file and
+ * survives the process.
+ *
+ * flash_posix_set_power_cut(n) cuts the power during the n-th program or
+ * erase from then on: that one is left half done and nothing after it
+ * reaches the array, until the cut is set again.
+ */
+#define HOST_FLASH_SECTOR_SIZE          0x1000
+#define HOST_FLASH_BLOCK_SIZE           0x10000
+
+static UINT8 *host_flash;
+static PROTECT_TYPE host_flash_protect = FLASH_UNPROTECT_LAST_BLOCK;
+static FLASH_POSIX_STATS host_flash_stats;
+static UINT32 host_flash_cut_op;
+static UINT32 host_flash_cut_hit;
+
+/* the partitions host modules look up, at their bk7238 addresses */
+static bk_logic_partition_t host_flash_partitions[BK_PARTITION_MAX] =
+{
+#if (CFG_SUPPORT_MATTER)
+	[BK_PARTITION_MATTER_FLASH] =
+	{
+		.partition_owner           = BK_FLASH_EMBEDDED,
+		.partition_description     = "matter info",
+		.partition_start_addr      = 0x3e2000,
+		.partition_length          = 0x9000,
+		.partition_options         = PAR_OPT_READ_EN | PAR_OPT_WRITE_DIS,
+	},
+#endif
+};
+
+static DD_OPERATIONS flash_op =
+{
+	NULL,
+	NULL,
+	flash_read,
+	flash_write,
+	flash_ctrl
+};
+
+static UINT8 *flash_posix_map(const char *path)
+{
+	UINT8 *base;
+	off_t size;
+	int fd;
+
+	fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		return NULL;
+
+	size = lseek(fd, 0, SEEK_END);
+	if (size < HOST_FLASH_SIZE) {
+		UINT8 ff[HOST_FLASH_SECTOR_SIZE];
+
+		/* a new image starts out erased */
+		memset(ff, 0xff, sizeof(ff));
+		while (size < HOST_FLASH_SIZE) {
+			if (pwrite(fd, ff, sizeof(ff), size) != sizeof(ff)) {
+				close(fd);
+				return NULL;
+			}
+			size += sizeof(ff);
+		}
+	}
+
+	base = mmap(NULL, HOST_FLASH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	return (base == MAP_FAILED) ? NULL : base;
+}
+
+/* address range that the current protect type leaves writable */
+static int flash_posix_writable(UINT32 addr, UINT32 len)
+{
+	UINT32 start;
+
+	switch (host_flash_protect) {
+	case FLASH_PROTECT_NONE:
+		start = 0;
+		break;
+
+	case FLASH_PROTECT_HALF:
+		start = HOST_FLASH_SIZE / 2;
+		break;
+
+	case FLASH_UNPROTECT_LAST_BLOCK:
+		start = HOST_FLASH_SIZE - HOST_FLASH_BLOCK_SIZE;
+		break;
+
+	default:
+		start = HOST_FLASH_SIZE;
+		break;
+	}
+
+	return (addr >= start) && (len <= HOST_FLASH_SIZE - addr);
+}
+
+/* bytes of the next program or erase that still get through */
+static UINT32 flash_posix_power(UINT32 len)
+{
+	if (host_flash_cut_hit)
+		return 0;
+
+	if (host_flash_cut_op && (-- host_flash_cut_op == 0)) {
+		host_flash_cut_hit = 1;
+		return len / 2;
+	}
+
+	return len;
+}
+
+void flash_init(void)
+{
+	const char *path = getenv("BK_HOST_FLASH");
+
+	if (host_flash)
+		return;
+
+	if (path && path[0]) {
+		host_flash = flash_posix_map(path);
+		if (host_flash == NULL)
+			os_printf("[Flash]map %s failed, using ram\r\n", path);
+	}
+
+	if (host_flash == NULL) {
+		host_flash = (UINT8 *)malloc(HOST_FLASH_SIZE);
+		ASSERT(host_flash);
+		memset(host_flash, 0xff, HOST_FLASH_SIZE);
+	}
+
+	host_flash_protect = FLASH_UNPROTECT_LAST_BLOCK;
+	ddev_register_dev(FLASH_DEV_NAME, &flash_op);
+}
+
+void flash_exit(void)
+{
+	ddev_unregister_dev(FLASH_DEV_NAME);
+}
+
+UINT32 flash_read(char *user_buf, UINT32 count, UINT32 address)
+{
+	if (address >= HOST_FLASH_SIZE || count > HOST_FLASH_SIZE - address)
+		return FLASH_FAILURE;
+
+	memcpy(user_buf, host_flash + address, count);
+	host_flash_stats.read_bytes += count;
+
+	return FLASH_SUCCESS;
+}
+
+UINT32 flash_write(char *user_buf, UINT32 count, UINT32 address)
+{
+	UINT32 i, len;
+
+	if (!flash_posix_writable(address, count)) {
+		os_printf("[Flash]write 0x%x+%d protected\r\n", address, count);
+		return FLASH_FAILURE;
+	}
+
+	len = flash_posix_power(count);
+	for (i = 0; i < len; i ++)
+		host_flash[address + i] &= (UINT8)user_buf[i];
+	host_flash_stats.write_bytes += count;
+	host_flash_stats.write_ops ++;
+
+	return FLASH_SUCCESS;
+}
+
+static UINT32 flash_posix_erase(UINT32 address)
+{
+	address &= ~(HOST_FLASH_SECTOR_SIZE - 1);
+	if (!flash_posix_writable(address, HOST_FLASH_SECTOR_SIZE)) {
+		os_printf("[Flash]erase 0x%x protected\r\n", address);
+		return FLASH_FAILURE;
+	}
+
+	memset(host_flash + address, 0xff, flash_posix_power(HOST_FLASH_SECTOR_SIZE));
+	host_flash_stats.erase_sectors ++;
+
+	return FLASH_SUCCESS;
+}
+
+UINT32 flash_ctrl(UINT32 cmd, void *parm)
+{
+	UINT32 ret = FLASH_SUCCESS;
+
+	switch (cmd) {
+	case CMD_FLASH_ERASE_SECTOR:
+		ret = flash_posix_erase(*(UINT32 *)parm);
+		break;
+
+	case CMD_FLASH_GET_SIZE:
+		*(UINT32 *)parm = HOST_FLASH_SIZE;
+		break;
+
+	case CMD_FLASH_GET_PROTECT:
+		*(UINT32 *)parm = host_flash_protect;
+		break;
+
+	case CMD_FLASH_SET_PROTECT:
+		host_flash_protect = (PROTECT_TYPE)(*(UINT32 *)parm);
+		break;
+
+	case CMD_FLASH_GET_ID:
+	case CMD_FLASH_READ_MID:
+		*(UINT32 *)parm = 0;
+		break;
+
+	default:
+		/* clock, line mode and status register controls have no host meaning */
+		break;
+	}
+
+	return ret;
+}
+
+void flash_posix_get_stats(FLASH_POSIX_STATS *stats)
+{
+	*stats = host_flash_stats;
+}
+
+void flash_posix_reset_stats(void)
+{
+	memset(&host_flash_stats, 0, sizeof(host_flash_stats));
+}
+
+/* the table is writable on the host, tests resize partitions through it */
+bk_logic_partition_t *bk_flash_get_info(bk_partition_t inPartition)
+{
+	if ((inPartition >= BK_PARTITION_MAX) || (host_flash_partitions[inPartition].partition_length == 0))
+		return NULL;
+
+	return &host_flash_partitions[inPartition];
+}
+
+/* 0 gives the power back */
+void flash_posix_set_power_cut(UINT32 op)
+{
+	host_flash_cut_op = op;
+	host_flash_cut_hit = 0;
+}
+
+UINT32 flash_posix_power_cut_hit(void)
+{
+	return host_flash_cut_hit;
+}
+// eof
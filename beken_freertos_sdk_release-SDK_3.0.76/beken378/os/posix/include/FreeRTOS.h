@@ -0,0 +1,33 @@
+#ifndef _HOST_FREERTOS_H_
+#define _HOST_FREERTOS_H_
+
+/*
+ * host replacement of FreeRTOS.h, just what the heaps of portable/MemMang
+ * need to be built into the benchmarks unchanged
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+#define pdFALSE                                    0
+#define pdTRUE                                     1
+
+typedef long BaseType_t;
+
+#define configSUPPORT_DYNAMIC_ALLOCATION           1
+#define configAPPLICATION_ALLOCATED_HEAP           0
+#define configUSE_MALLOC_FAILED_HOOK               0
+
+/* a static array close to what bk7238 leaves between _empty_ram and the end of sram */
+#define configDYNAMIC_HEAP_SIZE                    0
+#define configTOTAL_HEAP_SIZE                      ((size_t)(192 * 1024))
+
+#define portBYTE_ALIGNMENT                         8
+#define portBYTE_ALIGNMENT_MASK                    (0x0007)
+
+#define configASSERT(x)                            assert(x)
+#define mtCOVERAGE_TEST_MARKER()
+#define traceMALLOC(pvAddress, uiSize)
+#define traceFREE(pvAddress, uiSize)
+
+#endif // _HOST_FREERTOS_H_
@@ -0,0 +1,40 @@
+#ifndef _ARCH_H_
+#define _ARCH_H_
+
+/*
+ * host replacement of driver/entry/arch.h: there are no interrupts, the
+ * critical sections of the drivers and modules map to one process wide
+ * recursive lock of the posix port
+ */
+#include "generic.h"
+#include "compiler.h"
+
+extern uint32_t rtos_disable_int(void);
+extern void rtos_enable_int(uint32_t int_level);
+
+#define GLOBAL_INT_DECLARATION()   uint32_t irq_level
+#define GLOBAL_INT_DISABLE()       do{\
+										irq_level = rtos_disable_int();\
+									}while(0)
+
+#define GLOBAL_INT_RESTORE()       do{\
+										rtos_enable_int(irq_level);\
+									}while(0)
+
+#define CPU_WORD_SIZE                  4
+#define CPU_LE                         1
+
+#define ASSERT_REC(cond)
+#define ASSERT_REC_VAL(cond, ret)
+#define ASSERT_REC_NO_RET(cond)
+
+#if !defined(ASSERT_ERR)
+#define ASSERT_ERR(cond)                  ASSERT(cond)
+#endif
+
+#define ASSERT_ERR2(cond, param0, param1)
+#if !defined(ASSERT_WARN)
+#define ASSERT_WARN(cond)
+#endif
+
+#endif // _ARCH_H_
@@ -0,0 +1,20 @@
+#ifndef _FLASH_POSIX_H_
+#define _FLASH_POSIX_H_
+
+#include "typedef.h"
+
+typedef struct
+{
+	UINT64 read_bytes;
+	UINT64 write_bytes;
+	UINT32 write_ops;
+	UINT32 erase_sectors;
+} FLASH_POSIX_STATS;
+
+void flash_posix_get_stats(FLASH_POSIX_STATS *stats);
+void flash_posix_reset_stats(void);
+void flash_posix_set_power_cut(UINT32 op);
+UINT32 flash_posix_power_cut_hit(void);
+
+#endif // _FLASH_POSIX_H_
+// eof
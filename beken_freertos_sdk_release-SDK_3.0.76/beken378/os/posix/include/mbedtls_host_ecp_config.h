@@ -0,0 +1,31 @@
+#ifndef _MBEDTLS_HOST_ECP_CONFIG_H_
+#define _MBEDTLS_HOST_ECP_CONFIG_H_
+
+/*
+ * MBEDTLS_CONFIG_FILE of the host ecp objects: ecp_alt.c on the mbedtls
+ * library of the non matter build, with the ecp settings of tls_config.h.
+ * The limbs stay 64 bit, the target has 32 bit ones.
+ */
+#define MBEDTLS_HAVE_ASM
+#define MBEDTLS_BIGNUM_C
+#define MBEDTLS_ECP_C
+#define MBEDTLS_ECDH_C
+#define MBEDTLS_ECDSA_C
+#define MBEDTLS_ASN1_PARSE_C
+#define MBEDTLS_ASN1_WRITE_C
+#define MBEDTLS_ECP_ALT
+#define MBEDTLS_ECP_ROM_TABLES
+#define MBEDTLS_ECP_NIST_OPTIM
+#define MBEDTLS_ECP_DP_SECP256R1_ENABLED
+#define MBEDTLS_ECP_DP_SECP384R1_ENABLED
+
+#define MBEDTLS_MPI_MAX_SIZE         384
+#define MBEDTLS_MPI_WINDOW_SIZE        2
+#define MBEDTLS_ECP_MAX_BITS         384
+#define MBEDTLS_ECP_WINDOW_SIZE        2
+#define MBEDTLS_ECP_FIXED_POINT_OPTIM  0
+
+#include "mbedtls/check_config.h"
+
+#endif // _MBEDTLS_HOST_ECP_CONFIG_H_
+// eof
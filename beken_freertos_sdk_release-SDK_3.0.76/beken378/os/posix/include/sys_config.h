@@ -0,0 +1,26 @@
+#ifndef _HOST_SYS_CONFIG_H_
+#define _HOST_SYS_CONFIG_H_
+
+/*
+ * host build: the bk7238 feature set on top of the posix port of
+ * rtos_pub/mem_pub, with a ram or file backed flash
+ */
+#include "../../../app/config/sys_config_bk7238.h"
+
+#define CFG_HOST_POSIX                             1
+
+/* the host flash is a plain 4MB array */
+#define HOST_FLASH_SIZE                            0x400000
+
+/* the matter kv flash runs on the log backend, the power cut test covers it */
+#undef CFG_SUPPORT_MATTER
+#define CFG_SUPPORT_MATTER                         1
+#undef CFG_FLASH_KV_LOG
+#define CFG_FLASH_KV_LOG                           1
+
+/* modules linked into the host benchmarks */
+#ifndef _CJSON_USE_
+#define _CJSON_USE_                                1
+#endif
+
+#endif // _HOST_SYS_CONFIG_H_
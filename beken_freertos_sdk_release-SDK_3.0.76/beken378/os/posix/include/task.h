@@ -0,0 +1,10 @@
+#ifndef _HOST_TASK_H_
+#define _HOST_TASK_H_
+
+/* host replacement of task.h: suspending the scheduler takes the port lock */
+#include "rtos_pub.h"
+
+#define vTaskSuspendAll()                          rtos_lock_scheduling()
+#define xTaskResumeAll()                           (rtos_unlock_scheduling(), pdFALSE)
+
+#endif // _HOST_TASK_H_
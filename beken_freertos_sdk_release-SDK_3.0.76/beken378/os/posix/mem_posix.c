@@ -0,0 +1,56 @@
+#include "include.h"
+#include <stdlib.h>
+#include <string.h>
+#include "mem_pub.h"
+#include "rtos_pub.h"
+
+/* host heap: the target wrappers around pvPortMalloc map onto libc */
+void os_mem_init(void)
+{
+}
+
+void *os_malloc(size_t size)
+{
+	return malloc(size);
+}
+
+void *os_zalloc(size_t size)
+{
+	return calloc(1, size);
+}
+
+void os_free(void *ptr)
+{
+	free(ptr);
+}
+
+void *os_realloc(void *ptr, size_t size)
+{
+	return realloc(ptr, size);
+}
+
+void *psram_malloc(size_t size)
+{
+	return malloc(size);
+}
+
+void *psram_zalloc(size_t size)
+{
+	return calloc(1, size);
+}
+
+void *beken_malloc(size_t xWantedSize)
+{
+	return malloc(xWantedSize);
+}
+
+void beken_free(void *pv)
+{
+	free(pv);
+}
+
+void *beken_realloc(void *pv, size_t xWantedSize)
+{
+	return realloc(pv, xWantedSize);
+}
+// eof
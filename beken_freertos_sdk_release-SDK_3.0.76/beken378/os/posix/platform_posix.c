@@ -0,0 +1,32 @@
+#include "include.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include "uart_pub.h"
+
+/* the print port of the host build is stdout */
+void bk_printf(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vprintf(fmt, ap);
+	va_end(ap);
+}
+
+void bk_print_string(const char *string)
+{
+	fputs(string, stdout);
+}
+
+void fatal_print(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+
+	abort();
+}
+// eof
@@ -0,0 +1,967 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "error.h"
+#include "rtos_pub.h"
+#include "generic.h"
+#include "mem_pub.h"
+#include "str_pub.h"
+#include "uart_pub.h"
+
+/*
+ * Host port of rtos_pub.h on pthreads. Priorities are ignored and the
+ * scheduler is the host one, so only the blocking semantics (timeouts,
+ * counts, queue order) match FreeRTOS, not the timing.
+ */
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+typedef struct {
+	pthread_t       id;
+	beken_thread_function_t function;
+	beken_thread_arg_t arg;
+	volatile int    finished;
+	char            name[16];
+} posix_thread_t;
+
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t  cond;
+	int             count;
+	int             max_count;
+} posix_sema_t;
+
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t  not_empty;
+	pthread_cond_t  not_full;
+	uint32_t        msg_size;
+	uint32_t        msg_num;
+	uint32_t        head;
+	uint32_t        count;
+	uint8_t         buf[];
+} posix_queue_t;
+
+typedef struct posix_timer {
+	struct posix_timer *next;
+	uint64_t        expiry_ms;
+	uint32_t        period_ms;
+	uint8_t         reload;
+	uint8_t         active;
+	uint8_t         oneshot;
+	void           *owner;      // beken_timer_t or beken2_timer_t
+} posix_timer_t;
+
+/******************************************************
+ *               Variables Definitions
+ ******************************************************/
+static pthread_once_t posix_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t posix_int_lock;
+static pthread_key_t posix_thread_key;
+static struct timespec posix_start;
+static beken_time_t beken_time_offset = 0;
+
+static pthread_mutex_t timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t timer_cond;
+static pthread_cond_t timer_idle;
+static posix_timer_t *timer_list;
+static posix_timer_t *timer_running;
+static pthread_t timer_thread;
+static int timer_started;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+static void posix_init(void)
+{
+	pthread_mutexattr_t attr;
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&posix_int_lock, &attr);
+	pthread_mutexattr_destroy(&attr);
+
+	pthread_key_create(&posix_thread_key, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &posix_start);
+}
+
+static uint64_t posix_now_us(void)
+{
+	struct timespec now;
+
+	pthread_once(&posix_once, posix_init);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)(now.tv_sec - posix_start.tv_sec) * 1000000
+		   + (now.tv_nsec - posix_start.tv_nsec) / 1000;
+}
+
+static void posix_cond_init(pthread_cond_t *cond)
+{
+	pthread_condattr_t attr;
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(cond, &attr);
+	pthread_condattr_destroy(&attr);
+}
+
+/* absolute CLOCK_MONOTONIC deadline timeout_ms from now */
+static void posix_deadline(struct timespec *ts, uint32_t timeout_ms)
+{
+	clock_gettime(CLOCK_MONOTONIC, ts);
+	ts->tv_sec += timeout_ms / 1000;
+	ts->tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+	if (ts->tv_nsec >= 1000000000) {
+		ts->tv_sec ++;
+		ts->tv_nsec -= 1000000000;
+	}
+}
+
+/* wait on cond with the BEKEN_WAIT_FOREVER / BEKEN_NO_WAIT conventions */
+static int posix_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock,
+						   const struct timespec *deadline)
+{
+	if (deadline == NULL)
+		return pthread_cond_wait(cond, lock);
+
+	return pthread_cond_timedwait(cond, lock, deadline);
+}
+
+static void *posix_thread_entry(void *arg)
+{
+	posix_thread_t *thd = (posix_thread_t *)arg;
+
+	pthread_setspecific(posix_thread_key, thd);
+	thd->function(thd->arg);
+	thd->finished = 1;
+
+	return NULL;
+}
+
+OSStatus rtos_create_thread(beken_thread_t *thread, uint8_t priority, const char *name,
+							beken_thread_function_t function, uint32_t stack_size, beken_thread_arg_t arg)
+{
+	posix_thread_t *thd;
+	pthread_attr_t attr;
+
+	UNUSED_PARAMETER(priority);
+	UNUSED_PARAMETER(stack_size);
+	pthread_once(&posix_once, posix_init);
+
+	thd = (posix_thread_t *)calloc(1, sizeof(posix_thread_t));
+	if (thd == NULL)
+		return kNoMemoryErr;
+
+	thd->function = function;
+	thd->arg = arg;
+	if (name)
+		os_strlcpy(thd->name, name, sizeof(thd->name));
+
+	/* the host stack is never the limit the target one is */
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+	if (pthread_create(&thd->id, &attr, posix_thread_entry, thd) != 0) {
+		pthread_attr_destroy(&attr);
+		free(thd);
+		return kGeneralErr;
+	}
+	pthread_attr_destroy(&attr);
+
+	if (thread)
+		*thread = thd;
+
+	return kNoErr;
+}
+
+OSStatus rtos_delete_thread(beken_thread_t *thread)
+{
+	posix_thread_t *self = (posix_thread_t *)pthread_getspecific(posix_thread_key);
+
+	if (thread == NULL || *thread == self) {
+		if (self)
+			self->finished = 1;
+		pthread_exit(NULL);
+	}
+
+	/* killing another thread is not supported, it must return by itself */
+	return kUnsupportedErr;
+}
+
+OSStatus rtos_thread_set_priority(beken_thread_t *thread, int priority)
+{
+	return kNoErr;
+}
+
+OSStatus rtos_thread_join(beken_thread_t *thread)
+{
+	posix_thread_t *thd = (posix_thread_t *)*thread;
+
+	while (!thd->finished)
+		rtos_delay_milliseconds(10);
+
+	return kNoErr;
+}
+
+BOOL rtos_is_current_thread(beken_thread_t *thread)
+{
+	return (pthread_getspecific(posix_thread_key) == *thread) ? true : false;
+}
+
+beken_thread_t *rtos_get_current_thread(void)
+{
+	pthread_once(&posix_once, posix_init);
+	return (beken_thread_t *)pthread_getspecific(posix_thread_key);
+}
+
+void rtos_suspend_thread(beken_thread_t *thread)
+{
+}
+
+void rtos_resume_thread(beken_thread_t *thread)
+{
+}
+
+OSStatus rtos_thread_force_awake(beken_thread_t *thread)
+{
+	return kUnsupportedErr;
+}
+
+OSStatus rtos_print_thread_status(char *pcWriteBuffer, int xWriteBufferLen)
+{
+	snprintf(pcWriteBuffer, xWriteBufferLen, "host threads are not tracked\r\n");
+	return kNoErr;
+}
+
+OSStatus rtos_check_stack(void)
+{
+	return kNoErr;
+}
+
+void rtos_thread_sleep(uint32_t seconds)
+{
+	rtos_delay_milliseconds(seconds * 1000);
+}
+
+void rtos_thread_msleep(uint32_t ms)
+{
+	rtos_delay_milliseconds(ms);
+}
+
+OSStatus rtos_delay_milliseconds(uint32_t num_ms)
+{
+	struct timespec ts;
+
+	ts.tv_sec = num_ms / 1000;
+	ts.tv_nsec = (long)(num_ms % 1000) * 1000000;
+	while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+		;
+
+	return kNoErr;
+}
+
+OSStatus beken_time_get_time(beken_time_t *time_ptr)
+{
+	*time_ptr = rtos_get_time() + beken_time_offset;
+	return kNoErr;
+}
+
+OSStatus beken_time_get_time_s(beken_time_t *time_ptr)
+{
+	*time_ptr = rtos_get_time() / 1000 + beken_time_offset;
+	return kNoErr;
+}
+
+OSStatus beken_time_set_time_s(beken_time_t *time_ptr)
+{
+	beken_time_offset = *time_ptr - rtos_get_time() / 1000;
+	return kNoErr;
+}
+
+OSStatus beken_time_set_time(beken_time_t *time_ptr)
+{
+	beken_time_offset = *time_ptr - rtos_get_time();
+	return kNoErr;
+}
+
+beken_time_t rtos_get_time(void)
+{
+	return (beken_time_t)(posix_now_us() / 1000);
+}
+
+uint64_t rtos_get_time_us(void)
+{
+	return posix_now_us();
+}
+
+uint32_t rtos_get_tick_count(void)
+{
+	return rtos_get_time();
+}
+
+uint32_t beken_tick_ms(void)
+{
+	return 1;
+}
+
+OSStatus rtos_init_semaphore(beken_semaphore_t *semaphore, int maxCount)
+{
+	return rtos_init_semaphore_adv(semaphore, maxCount, 0);
+}
+
+OSStatus rtos_init_semaphore_adv(beken_semaphore_t *semaphore, int maxCount, int init_count)
+{
+	posix_sema_t *sema = (posix_sema_t *)calloc(1, sizeof(posix_sema_t));
+
+	if (sema == NULL) {
+		*semaphore = NULL;
+		return kGeneralErr;
+	}
+
+	pthread_mutex_init(&sema->lock, NULL);
+	posix_cond_init(&sema->cond);
+	sema->count = init_count;
+	sema->max_count = maxCount;
+	*semaphore = sema;
+
+	return kNoErr;
+}
+
+OSStatus rtos_get_semaphore(beken_semaphore_t *semaphore, uint32_t timeout_ms)
+{
+	posix_sema_t *sema = (posix_sema_t *)*semaphore;
+	struct timespec deadline;
+	OSStatus ret = kNoErr;
+
+	if (timeout_ms != BEKEN_WAIT_FOREVER)
+		posix_deadline(&deadline, timeout_ms);
+
+	pthread_mutex_lock(&sema->lock);
+	while (sema->count == 0) {
+		if (posix_cond_wait(&sema->cond, &sema->lock,
+							(timeout_ms == BEKEN_WAIT_FOREVER) ? NULL : &deadline) == ETIMEDOUT) {
+			ret = kTimeoutErr;
+			break;
+		}
+	}
+	if (ret == kNoErr)
+		sema->count --;
+	pthread_mutex_unlock(&sema->lock);
+
+	return ret;
+}
+
+int rtos_get_sema_count(beken_semaphore_t *semaphore)
+{
+	posix_sema_t *sema = (posix_sema_t *)*semaphore;
+
+	return sema->count;
+}
+
+int rtos_set_semaphore(beken_semaphore_t *semaphore)
+{
+	posix_sema_t *sema = (posix_sema_t *)*semaphore;
+	int ret = kGeneralErr;
+
+	pthread_mutex_lock(&sema->lock);
+	if (sema->count < sema->max_count) {
+		sema->count ++;
+		pthread_cond_signal(&sema->cond);
+		ret = kNoErr;
+	}
+	pthread_mutex_unlock(&sema->lock);
+
+	return ret;
+}
+
+OSStatus rtos_deinit_semaphore(beken_semaphore_t *semaphore)
+{
+	posix_sema_t *sema;
+
+	if (semaphore != NULL && *semaphore != NULL) {
+		sema = (posix_sema_t *)*semaphore;
+		pthread_cond_destroy(&sema->cond);
+		pthread_mutex_destroy(&sema->lock);
+		free(sema);
+		*semaphore = NULL;
+	}
+	return kNoErr;
+}
+
+/* no interrupts on the host, one recursive lock stands in for all of them */
+uint32_t rtos_disable_int(void)
+{
+	pthread_once(&posix_once, posix_init);
+	pthread_mutex_lock(&posix_int_lock);
+	return 0;
+}
+
+void rtos_enable_int(uint32_t int_level)
+{
+	pthread_mutex_unlock(&posix_int_lock);
+}
+
+void rtos_enter_critical(void)
+{
+	rtos_disable_int();
+}
+
+void rtos_exit_critical(void)
+{
+	rtos_enable_int(0);
+}
+
+void rtos_lock_scheduling(void)
+{
+	rtos_disable_int();
+}
+
+void rtos_unlock_scheduling(void)
+{
+	rtos_enable_int(0);
+}
+
+static OSStatus posix_mutex_create(beken_mutex_t *mutex, int type)
+{
+	pthread_mutex_t *m = (pthread_mutex_t *)malloc(sizeof(pthread_mutex_t));
+	pthread_mutexattr_t attr;
+
+	if (m == NULL) {
+		*mutex = NULL;
+		return kGeneralErr;
+	}
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, type);
+	pthread_mutex_init(m, &attr);
+	pthread_mutexattr_destroy(&attr);
+	*mutex = m;
+
+	return kNoErr;
+}
+
+OSStatus rtos_init_mutex(beken_mutex_t *mutex)
+{
+	return posix_mutex_create(mutex, PTHREAD_MUTEX_NORMAL);
+}
+
+OSStatus rtos_lock_mutex(beken_mutex_t *mutex)
+{
+	if (pthread_mutex_lock((pthread_mutex_t *)*mutex) != 0)
+		return kGeneralErr;
+
+	return kNoErr;
+}
+
+OSStatus rtos_unlock_mutex(beken_mutex_t *mutex)
+{
+	if (pthread_mutex_unlock((pthread_mutex_t *)*mutex) != 0)
+		return kGeneralErr;
+
+	return kNoErr;
+}
+
+OSStatus rtos_trylock_mutex(beken_mutex_t *mutex)
+{
+	if (pthread_mutex_trylock((pthread_mutex_t *)*mutex) != 0)
+		return kGeneralErr;
+
+	return kNoErr;
+}
+
+OSStatus rtos_deinit_mutex(beken_mutex_t *mutex)
+{
+	pthread_mutex_destroy((pthread_mutex_t *)*mutex);
+	free(*mutex);
+	*mutex = NULL;
+	return kNoErr;
+}
+
+OSStatus rtos_init_recursive_mutex(beken_mutex_t *mutex)
+{
+	return posix_mutex_create(mutex, PTHREAD_MUTEX_RECURSIVE);
+}
+
+OSStatus rtos_lock_recursive_mutex(beken_mutex_t *mutex, uint32_t timeout)
+{
+	struct timespec deadline;
+
+	if (timeout == BEKEN_WAIT_FOREVER)
+		return rtos_lock_mutex(mutex);
+
+	posix_deadline(&deadline, timeout);
+	if (pthread_mutex_timedlock((pthread_mutex_t *)*mutex, &deadline) != 0)
+		return kGeneralErr;
+
+	return kNoErr;
+}
+
+OSStatus rtos_unlock_recursive_mutex(beken_mutex_t *mutex)
+{
+	return rtos_unlock_mutex(mutex);
+}
+
+OSStatus rtos_init_queue(beken_queue_t *queue, const char *name, uint32_t message_size, uint32_t number_of_messages)
+{
+	posix_queue_t *q;
+
+	UNUSED_PARAMETER(name);
+
+	q = (posix_queue_t *)calloc(1, sizeof(posix_queue_t) + message_size * number_of_messages);
+	if (q == NULL) {
+		*queue = NULL;
+		return kGeneralErr;
+	}
+
+	pthread_mutex_init(&q->lock, NULL);
+	posix_cond_init(&q->not_empty);
+	posix_cond_init(&q->not_full);
+	q->msg_size = message_size;
+	q->msg_num = number_of_messages;
+	*queue = q;
+
+	return kNoErr;
+}
+
+static OSStatus posix_queue_push(posix_queue_t *q, void *message, uint32_t timeout_ms, int front)
+{
+	struct timespec deadline;
+	uint32_t slot;
+
+	if (timeout_ms != BEKEN_WAIT_FOREVER)
+		posix_deadline(&deadline, timeout_ms);
+
+	pthread_mutex_lock(&q->lock);
+	while (q->count == q->msg_num) {
+		if (posix_cond_wait(&q->not_full, &q->lock,
+							(timeout_ms == BEKEN_WAIT_FOREVER) ? NULL : &deadline) == ETIMEDOUT) {
+			pthread_mutex_unlock(&q->lock);
+			return kGeneralErr;
+		}
+	}
+
+	if (front) {
+		q->head = (q->head + q->msg_num - 1) % q->msg_num;
+		slot = q->head;
+	} else
+		slot = (q->head + q->count) % q->msg_num;
+
+	memcpy(q->buf + slot * q->msg_size, message, q->msg_size);
+	q->count ++;
+	pthread_cond_signal(&q->not_empty);
+	pthread_mutex_unlock(&q->lock);
+
+	return kNoErr;
+}
+
+OSStatus rtos_push_to_queue(beken_queue_t *queue, void *message, uint32_t timeout_ms)
+{
+	return posix_queue_push((posix_queue_t *)*queue, message, timeout_ms, 0);
+}
+
+OSStatus rtos_push_to_queue_front(beken_queue_t *queue, void *message, uint32_t timeout_ms)
+{
+	return posix_queue_push((posix_queue_t *)*queue, message, timeout_ms, 1);
+}
+
+OSStatus rtos_pop_from_queue(beken_queue_t *queue, void *message, uint32_t timeout_ms)
+{
+	posix_queue_t *q = (posix_queue_t *)*queue;
+	struct timespec deadline;
+
+	if (timeout_ms != BEKEN_WAIT_FOREVER)
+		posix_deadline(&deadline, timeout_ms);
+
+	pthread_mutex_lock(&q->lock);
+	while (q->count == 0) {
+		if (posix_cond_wait(&q->not_empty, &q->lock,
+							(timeout_ms == BEKEN_WAIT_FOREVER) ? NULL : &deadline) == ETIMEDOUT) {
+			pthread_mutex_unlock(&q->lock);
+			return kGeneralErr;
+		}
+	}
+
+	memcpy(message, q->buf + q->head * q->msg_size, q->msg_size);
+	q->head = (q->head + 1) % q->msg_num;
+	q->count --;
+	pthread_cond_signal(&q->not_full);
+	pthread_mutex_unlock(&q->lock);
+
+	return kNoErr;
+}
+
+OSStatus rtos_deinit_queue(beken_queue_t *queue)
+{
+	posix_queue_t *q = (posix_queue_t *)*queue;
+
+	if (q) {
+		pthread_cond_destroy(&q->not_empty);
+		pthread_cond_destroy(&q->not_full);
+		pthread_mutex_destroy(&q->lock);
+		free(q);
+	}
+	*queue = NULL;
+
+	return kNoErr;
+}
+
+BOOL rtos_is_queue_empty(beken_queue_t *queue)
+{
+	return (((posix_queue_t *)*queue)->count == 0) ? true : false;
+}
+
+BOOL rtos_is_queue_full(beken_queue_t *queue)
+{
+	posix_queue_t *q = (posix_queue_t *)*queue;
+
+	return (q->count == q->msg_num) ? true : false;
+}
+
+int rtos_queue_len(beken_queue_t *queue)
+{
+	return ((posix_queue_t *)*queue)->count;
+}
+
+/*
+ * timers: one service thread keeps the active timers sorted by expiry and
+ * runs the callbacks outside timer_lock, like the FreeRTOS timer task
+ */
+static void posix_timer_unlink(posix_timer_t *tmr)
+{
+	posix_timer_t **pp = &timer_list;
+
+	while (*pp) {
+		if (*pp == tmr) {
+			*pp = tmr->next;
+			break;
+		}
+		pp = &(*pp)->next;
+	}
+	tmr->next = NULL;
+	tmr->active = 0;
+}
+
+static void posix_timer_link(posix_timer_t *tmr)
+{
+	posix_timer_t **pp = &timer_list;
+
+	posix_timer_unlink(tmr);
+	tmr->expiry_ms = rtos_get_time_us() / 1000 + tmr->period_ms;
+	while (*pp && (*pp)->expiry_ms <= tmr->expiry_ms)
+		pp = &(*pp)->next;
+	tmr->next = *pp;
+	*pp = tmr;
+	tmr->active = 1;
+	pthread_cond_signal(&timer_cond);
+}
+
+static void *posix_timer_task(void *arg)
+{
+	posix_timer_t *tmr;
+	struct timespec deadline;
+	uint64_t now;
+	void *owner;
+	uint8_t oneshot;
+
+	pthread_mutex_lock(&timer_lock);
+	while (1) {
+		if (timer_list == NULL) {
+			pthread_cond_wait(&timer_cond, &timer_lock);
+			continue;
+		}
+
+		now = rtos_get_time_us() / 1000;
+		tmr = timer_list;
+		if (tmr->expiry_ms > now) {
+			posix_deadline(&deadline, (uint32_t)(tmr->expiry_ms - now));
+			pthread_cond_timedwait(&timer_cond, &timer_lock, &deadline);
+			continue;
+		}
+
+		owner = tmr->owner;
+		oneshot = tmr->oneshot;
+		if (tmr->reload)
+			posix_timer_link(tmr);
+		else
+			posix_timer_unlink(tmr);
+
+		timer_running = tmr;
+		pthread_mutex_unlock(&timer_lock);
+
+		if (oneshot) {
+			beken2_timer_t *timer = (beken2_timer_t *)owner;
+
+			if (BEKEN_MAGIC_WORD == timer->beken_magic && timer->function)
+				timer->function(timer->left_arg, timer->right_arg);
+		} else {
+			beken_timer_t *timer = (beken_timer_t *)owner;
+
+			if (timer->state == BEKEN_TIMER_INIT && timer->function)
+				timer->function(timer->arg);
+		}
+
+		pthread_mutex_lock(&timer_lock);
+		timer_running = NULL;
+		pthread_cond_broadcast(&timer_idle);
+	}
+
+	return NULL;
+}
+
+static posix_timer_t *posix_timer_create(void *owner, uint32_t time_ms, uint8_t reload, uint8_t oneshot)
+{
+	posix_timer_t *tmr = (posix_timer_t *)calloc(1, sizeof(posix_timer_t));
+
+	if (tmr == NULL)
+		return NULL;
+
+	tmr->owner = owner;
+	tmr->period_ms = time_ms;
+	tmr->reload = reload;
+	tmr->oneshot = oneshot;
+
+	pthread_mutex_lock(&timer_lock);
+	if (!timer_started) {
+		posix_cond_init(&timer_cond);
+		posix_cond_init(&timer_idle);
+		if (pthread_create(&timer_thread, NULL, posix_timer_task, NULL) == 0)
+			timer_started = 1;
+	}
+	pthread_mutex_unlock(&timer_lock);
+
+	return tmr;
+}
+
+static OSStatus posix_timer_ctrl(void *handle, int start)
+{
+	posix_timer_t *tmr = (posix_timer_t *)handle;
+
+	if (tmr == NULL)
+		return kGeneralErr;
+
+	pthread_mutex_lock(&timer_lock);
+	if (start)
+		posix_timer_link(tmr);
+	else
+		posix_timer_unlink(tmr);
+	pthread_mutex_unlock(&timer_lock);
+
+	return kNoErr;
+}
+
+static OSStatus posix_timer_period(void *handle, uint32_t time_ms)
+{
+	posix_timer_t *tmr = (posix_timer_t *)handle;
+
+	if (tmr == NULL)
+		return kGeneralErr;
+
+	/* like xTimerChangePeriod, this also starts the timer */
+	pthread_mutex_lock(&timer_lock);
+	tmr->period_ms = time_ms;
+	posix_timer_link(tmr);
+	pthread_mutex_unlock(&timer_lock);
+
+	return kNoErr;
+}
+
+static void posix_timer_delete(void *handle, bool block)
+{
+	posix_timer_t *tmr = (posix_timer_t *)handle;
+
+	if (tmr == NULL)
+		return;
+
+	pthread_mutex_lock(&timer_lock);
+	posix_timer_unlink(tmr);
+	while (block && timer_running == tmr && !pthread_equal(pthread_self(), timer_thread))
+		pthread_cond_wait(&timer_idle, &timer_lock);
+	pthread_mutex_unlock(&timer_lock);
+
+	free(tmr);
+}
+
+static BOOL posix_timer_active(void *handle)
+{
+	posix_timer_t *tmr = (posix_timer_t *)handle;
+
+	return (tmr && tmr->active) ? true : false;
+}
+
+OSStatus rtos_init_oneshot_timer(beken2_timer_t *timer,
+								 uint32_t time_ms,
+								 timer_2handler_t function,
+								 void *larg,
+								 void *rarg)
+{
+	timer->function = function;
+	timer->left_arg = larg;
+	timer->right_arg = rarg;
+	timer->beken_magic = BEKEN_MAGIC_WORD;
+	timer->state = BEKEN_TIMER_INIT;
+	timer->handle = posix_timer_create(timer, time_ms, 0, 1);
+
+	return timer->handle ? kNoErr : kGeneralErr;
+}
+
+OSStatus rtos_start_oneshot_timer(beken2_timer_t *timer)
+{
+	return posix_timer_ctrl(timer->handle, 1);
+}
+
+OSStatus rtos_stop_oneshot_timer(beken2_timer_t *timer)
+{
+	return posix_timer_ctrl(timer->handle, 0);
+}
+
+OSStatus rtos_oneshot_reload_timer(beken2_timer_t *timer)
+{
+	return posix_timer_ctrl(timer->handle, 1);
+}
+
+OSStatus rtos_change_period_1(beken2_timer_t *timer, uint32_t time_ms)
+{
+	return posix_timer_period(timer->handle, time_ms);
+}
+
+static OSStatus deinit_oneshot_timer(beken2_timer_t *timer, bool block)
+{
+	timer->state = BEKEN_TIMER_DELETING;
+	timer->beken_magic = 0;
+	posix_timer_delete(timer->handle, block);
+	timer->function = 0;
+	timer->left_arg = 0;
+	timer->right_arg = 0;
+	timer->handle = 0;
+	timer->state = BEKEN_TIMER_DELETED;
+
+	return kNoErr;
+}
+
+OSStatus rtos_deinit_oneshot_timer_block(beken2_timer_t *timer)
+{
+	return deinit_oneshot_timer(timer, true);
+}
+
+OSStatus rtos_deinit_oneshot_timer(beken2_timer_t *timer)
+{
+	return deinit_oneshot_timer(timer, false);
+}
+
+BOOL rtos_is_oneshot_timer_init(beken2_timer_t *timer)
+{
+	return timer->handle ? true : false;
+}
+
+BOOL rtos_is_oneshot_timer_running(beken2_timer_t *timer)
+{
+	return posix_timer_active(timer->handle);
+}
+
+OSStatus rtos_init_timer(beken_timer_t *timer,
+						 uint32_t time_ms,
+						 timer_handler_t function,
+						 void *arg)
+{
+	timer->function = function;
+	timer->arg = arg;
+	timer->state = BEKEN_TIMER_INIT;
+	timer->handle = posix_timer_create(timer, time_ms, 1, 0);
+
+	return timer->handle ? kNoErr : kGeneralErr;
+}
+
+OSStatus rtos_start_timer(beken_timer_t *timer)
+{
+	return posix_timer_ctrl(timer->handle, 1);
+}
+
+OSStatus rtos_stop_timer(beken_timer_t *timer)
+{
+	return posix_timer_ctrl(timer->handle, 0);
+}
+
+OSStatus rtos_reload_timer(beken_timer_t *timer)
+{
+	return posix_timer_ctrl(timer->handle, 1);
+}
+
+OSStatus rtos_change_period(beken_timer_t *timer, uint32_t time_ms)
+{
+	return posix_timer_period(timer->handle, time_ms);
+}
+
+static OSStatus deinit_timer(beken_timer_t *timer, bool block)
+{
+	timer->state = BEKEN_TIMER_DELETING;
+	posix_timer_delete(timer->handle, block);
+	timer->handle = 0;
+	timer->state = BEKEN_TIMER_DELETED;
+
+	return kNoErr;
+}
+
+OSStatus rtos_deinit_timer_block(beken_timer_t *timer)
+{
+	return deinit_timer(timer, true);
+}
+
+OSStatus rtos_deinit_timer(beken_timer_t *timer)
+{
+	return deinit_timer(timer, false);
+}
+
+BOOL rtos_is_timer_init(beken_timer_t *timer)
+{
+	return timer->handle ? true : false;
+}
+
+BOOL rtos_is_timer_running(beken_timer_t *timer)
+{
+	return posix_timer_active(timer->handle);
+}
+
+uint32_t rtos_get_timer_expiry_time(beken_timer_t *timer)
+{
+	posix_timer_t *tmr = (posix_timer_t *)timer->handle;
+
+	return tmr ? (uint32_t)tmr->expiry_ms : 0;
+}
+
+uint32_t rtos_get_next_expire_time()
+{
+	uint32_t expiry;
+
+	pthread_mutex_lock(&timer_lock);
+	expiry = timer_list ? (uint32_t)timer_list->expiry_ms : 0;
+	pthread_mutex_unlock(&timer_lock);
+
+	return expiry;
+}
+
+uint32_t rtos_get_current_timer_count(void)
+{
+	return rtos_get_time();
+}
+
+int rtos_init_event_fd(beken_event_t event_handle)
+{
+	return -1;
+}
+
+int rtos_deinit_event_fd(int fd)
+{
+	return -1;
+}
+
+/* no interrupt context exists on the host */
+uint32_t platform_is_in_interrupt_context(void)
+{
+	return RTOS_FAILURE;
+}
+// eof
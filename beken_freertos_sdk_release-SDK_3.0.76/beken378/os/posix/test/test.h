@@ -0,0 +1,19 @@
+#ifndef _TEST_H_
+#define _TEST_H_
+
+#include "include.h"
+
+/*
+ * host tests of sdk modules on top of the posix port, each case returns
+ * 0 when it passes and prints what went wrong otherwise
+ */
+typedef struct
+{
+	const char *name;
+	int (*run)(void);
+} TEST_CASE;
+
+int test_kv_log_power_cut(void);
+
+#endif // _TEST_H_
+// eof
@@ -0,0 +1,214 @@
+#include "include.h"
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "error.h"
+#include "drv_model_pub.h"
+#include "flash_pub.h"
+#include "flash_posix.h"
+#include "BkDriverFlash.h"
+#include "flash_kv_log.h"
+
+/*
+ * power cut at every flash program and erase of a kv log workload. A first
+ * run counts the operations, then the workload is replayed once per
+ * operation with the power cut there. After the cut the log is mounted
+ * again: every key must hold the value of the last finished update, only
+ * the key of the cut update may already hold the new one. The workload then
+ * goes on, to check that the recovered log still takes writes.
+ */
+#define TEST_KV_KEYS                8
+#define TEST_KV_OPS                 400
+#define TEST_KV_MORE_OPS            40
+#define TEST_KV_VAL_MAX             300
+
+static const char *test_kv_ns[] = {"chip-config", "chip-counters"};
+static const UINT32 test_kv_sectors[] = {2, 3, 4, 9};
+
+/* version of the value each key holds, -1 when it is deleted */
+static int test_kv_model[TEST_KV_KEYS];
+
+static UINT32 test_kv_op_key(UINT32 op)
+{
+	return (op * 5 + op / 3) % TEST_KV_KEYS;
+}
+
+static int test_kv_op_is_delete(UINT32 op)
+{
+	return (op % 7) == 6;
+}
+
+static UINT32 test_kv_value(UINT32 key, int version, UINT8 *buf)
+{
+	UINT32 i, len = 1 + (version * 37 + key * 11) % TEST_KV_VAL_MAX;
+
+	for (i = 0; i < len; i ++)
+		buf[i] = (UINT8)(version * 13 + i * 7 + key);
+
+	return len;
+}
+
+static void test_kv_name(UINT32 key, char *name)
+{
+	snprintf(name, 8, "k%u", key);
+}
+
+static void test_kv_erase(UINT32 sectors)
+{
+	bk_logic_partition_t *info = bk_flash_get_info(BK_PARTITION_MATTER_FLASH);
+	UINT32 status, protect = FLASH_PROTECT_NONE, old, addr, i;
+	DD_HANDLE hdl;
+
+	info->partition_length = sectors * KV_LOG_SECTOR_SIZE;
+
+	hdl = ddev_open(FLASH_DEV_NAME, &status, 0);
+	ddev_control(hdl, CMD_FLASH_GET_PROTECT, &old);
+	ddev_control(hdl, CMD_FLASH_SET_PROTECT, &protect);
+	for (i = 0; i < sectors; i ++) {
+		addr = info->partition_start_addr + i * KV_LOG_SECTOR_SIZE;
+		ddev_control(hdl, CMD_FLASH_ERASE_SECTOR, &addr);
+	}
+	ddev_control(hdl, CMD_FLASH_SET_PROTECT, &old);
+	ddev_close(hdl);
+
+	kv_log_reset();
+}
+
+static UINT32 test_kv_apply(UINT32 op)
+{
+	UINT8 buf[TEST_KV_VAL_MAX];
+	UINT32 key = test_kv_op_key(op), len;
+	char name[8];
+
+	test_kv_name(key, name);
+	if (test_kv_op_is_delete(op)) {
+		/* deleting a missing key fails on purpose, it changes nothing */
+		kv_log_delete(test_kv_ns[key & 1], name);
+		return kNoErr;
+	}
+
+	len = test_kv_value(key, op, buf);
+	return kv_log_write(test_kv_ns[key & 1], name, (const char *)buf, len);
+}
+
+static void test_kv_model_apply(UINT32 op)
+{
+	test_kv_model[test_kv_op_key(op)] = test_kv_op_is_delete(op) ? -1 : (int)op;
+}
+
+/* 1 when the key holds the given version */
+static int test_kv_holds(UINT32 key, int version)
+{
+	UINT8 want[TEST_KV_VAL_MAX], got[TEST_KV_VAL_MAX];
+	UINT32 want_len, got_len = 0;
+	char name[8];
+
+	test_kv_name(key, name);
+	if (version < 0)
+		return kv_log_exist(test_kv_ns[key & 1], name) != kNoErr;
+
+	if (kv_log_read(test_kv_ns[key & 1], name, (char *)got, sizeof(got), &got_len) != kNoErr)
+		return 0;
+
+	want_len = test_kv_value(key, version, want);
+	return (got_len == want_len) && (memcmp(got, want, want_len) == 0);
+}
+
+/* cut: the operation in progress when the power went away, -1 for none */
+static int test_kv_check(int cut)
+{
+	int key, alt;
+
+	for (key = 0; key < TEST_KV_KEYS; key ++) {
+		if (test_kv_holds(key, test_kv_model[key]))
+			continue;
+
+		alt = -2;
+		if ((cut >= 0) && (test_kv_op_key(cut) == key))
+			alt = test_kv_op_is_delete(cut) ? -1 : cut;
+		if ((alt != -2) && test_kv_holds(key, alt))
+			continue;
+
+		printf("  key %d: expected version %d\n", key, test_kv_model[key]);
+		return -1;
+	}
+
+	return 0;
+}
+
+/* one run of the workload with the power cut at flash operation cut_op */
+static int test_kv_run(UINT32 sectors, UINT32 cut_op, UINT32 *flash_ops)
+{
+	FLASH_POSIX_STATS stats;
+	UINT32 op, more;
+	int cut = -1;
+
+	test_kv_erase(sectors);
+	memset(test_kv_model, 0xff, sizeof(test_kv_model));
+
+	flash_posix_reset_stats();
+	flash_posix_set_power_cut(cut_op);
+	for (op = 0; op < TEST_KV_OPS; op ++) {
+		UINT32 ret = test_kv_apply(op);
+
+		if (flash_posix_power_cut_hit()) {
+			cut = op;
+			break;
+		}
+		if (ret != kNoErr) {
+			printf("  %u sectors: op %u failed\n", sectors, op);
+			return -1;
+		}
+		test_kv_model_apply(op);
+	}
+	flash_posix_set_power_cut(0);
+
+	if (flash_ops) {
+		flash_posix_get_stats(&stats);
+		*flash_ops = stats.write_ops + stats.erase_sectors;
+	}
+
+	/* reboot */
+	kv_log_reset();
+	if (test_kv_check(cut) != 0) {
+		printf("  %u sectors: wrong data after the cut at flash op %u, kv op %d\n", sectors, cut_op, cut);
+		return -1;
+	}
+	if (cut < 0)
+		return 0;
+
+	for (more = 0, op = cut; more < TEST_KV_MORE_OPS; more ++, op ++) {
+		if (test_kv_apply(op) != kNoErr) {
+			printf("  %u sectors: op %u failed after the cut at flash op %u\n", sectors, op, cut_op);
+			return -1;
+		}
+		test_kv_model_apply(op);
+	}
+
+	kv_log_reset();
+	if (test_kv_check(-1) != 0) {
+		printf("  %u sectors: wrong data after recovering from flash op %u\n", sectors, cut_op);
+		return -1;
+	}
+
+	return 0;
+}
+
+int test_kv_log_power_cut(void)
+{
+	UINT32 i, cut, flash_ops;
+
+	for (i = 0; i < sizeof(test_kv_sectors) / sizeof(test_kv_sectors[0]); i ++) {
+		if (test_kv_run(test_kv_sectors[i], 0, &flash_ops) != 0)
+			return -1;
+
+		for (cut = 1; cut <= flash_ops; cut ++) {
+			if (test_kv_run(test_kv_sectors[i], cut, NULL) != 0)
+				return -1;
+		}
+		printf("  %u sectors: %u power cuts\n", test_kv_sectors[i], flash_ops);
+	}
+
+	return 0;
+}
+// eof
@@ -0,0 +1,48 @@
+#include "include.h"
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "drv_model_pub.h"
+#include "flash_pub.h"
+
+static const TEST_CASE test_cases[] =
+{
+	{"kv_log_power_cut",    test_kv_log_power_cut},
+};
+
+int main(int argc, char **argv)
+{
+	UINT32 i;
+	int j, failed = 0, ran = 0;
+
+	drv_model_init();
+	flash_init();
+
+	for (i = 0; i < sizeof(test_cases) / sizeof(test_cases[0]); i ++) {
+		int selected = (argc < 2);
+
+		for (j = 1; j < argc; j ++) {
+			if (strcmp(argv[j], test_cases[i].name) == 0)
+				selected = 1;
+		}
+		if (!selected)
+			continue;
+
+		printf("[%s]\n", test_cases[i].name);
+		if (test_cases[i].run() != 0) {
+			printf("  FAIL\n");
+			failed ++;
+		} else {
+			printf("  ok\n");
+		}
+		ran ++;
+	}
+
+	if (ran == 0) {
+		printf("usage: %s [case ...]\n", argv[0]);
+		return 1;
+	}
+
+	return failed ? 1 : 0;
+}
+// eof
@@ -0,0 +1,186 @@
+# -------------------------------------------------------------------
+# Host build: sdk modules on the posix port of rtos_pub/mem_pub and a
+# ram or file backed flash, linked into a linux benchmark binary and a
+# test binary
+# -------------------------------------------------------------------
+HOST_CC ?= gcc
+HOST_AR ?= ar
+
+CC = $(HOST_CC)
+AR = $(HOST_AR)
+
+Q := @
+ifeq ($(V),1)
+Q :=
+endif
+
+ifeq ($(ECHO),)
+ECHO=echo
+endif
+
+TARGET=out/host
+
+OBJ_DIR=$(TARGET)
+BIN_DIR=$(TARGET)
+
+HOST_LIB = $(BIN_DIR)/libbk_host.a
+HOST_BENCH = $(BIN_DIR)/bk_bench
+HOST_TEST = $(BIN_DIR)/bk_test
+
+# -------------------------------------------------------------------
+# Include folder list, the posix folder shadows sys_config.h and arch.h
+# -------------------------------------------------------------------
+INCLUDES :=
+INCLUDES += -I./beken378/os/posix/include
+INCLUDES += -I./beken378/common
+INCLUDES += -I./beken378/release
+INCLUDES += -I./beken378/os/include
+INCLUDES += -I./beken378/driver/include
+INCLUDES += -I./beken378/driver/common
+INCLUDES += -I./beken378/driver/flash
+INCLUDES += -I./beken378/func/include
+INCLUDES += -I./beken378/func/user_driver
+INCLUDES += -I./beken378/func/key_value_flash
+INCLUDES += -I./beken378/func/easy_flash/inc
+INCLUDES += -I./beken378/func/easy_flash/port
+INCLUDES += -I./beken378/func/base64
+INCLUDES += -I./beken378/func/paho-mqtt/packet/src
+INCLUDES += -I./beken378/func/paho-mqtt/mqtt_ui
+INCLUDES += -I./beken378/func/mbedtls/mbedtls-2.27.0/include
+INCLUDES += -I./demos/common/json
+
+# -------------------------------------------------------------------
+# Source file list
+# -------------------------------------------------------------------
+SRC_HOST_C :=
+SRC_HOST_C += ./beken378/os/posix/rtos_pub.c
+SRC_HOST_C += ./beken378/os/posix/mem_posix.c
+SRC_HOST_C += ./beken378/os/posix/flash_posix.c
+SRC_HOST_C += ./beken378/os/posix/platform_posix.c
+SRC_HOST_C += ./beken378/os/mem_arch.c
+SRC_HOST_C += ./beken378/os/str_arch.c
+SRC_HOST_C += ./beken378/driver/common/drv_model.c
+
+# modules under benchmark
+SRC_HOST_C += ./beken378/func/easy_flash/src/easyflash.c
+SRC_HOST_C += ./beken378/func/easy_flash/src/ef_env.c
+SRC_HOST_C += ./beken378/func/easy_flash/src/ef_utils.c
+SRC_HOST_C += ./beken378/func/easy_flash/port/ef_port.c
+SRC_HOST_C += ./beken378/func/key_value_flash/flash_kv_log.c
+SRC_HOST_C += ./beken378/func/base64/base_64.c
+SRC_HOST_C += ./demos/common/json/cJSON.c
+SRC_HOST_C += ./beken378/func/paho-mqtt/packet/src/MQTTConnectClient.c
+SRC_HOST_C += ./beken378/func/paho-mqtt/packet/src/MQTTDeserializePublish.c
+SRC_HOST_C += ./beken378/func/paho-mqtt/packet/src/MQTTPacket.c
+SRC_HOST_C += ./beken378/func/paho-mqtt/packet/src/MQTTSerializePublish.c
+SRC_HOST_C += ./beken378/func/paho-mqtt/packet/src/MQTTSubscribeClient.c
+SRC_HOST_C += ./beken378/func/paho-mqtt/packet/src/MQTTUnsubscribeClient.c
+SRC_HOST_C += ./beken378/func/paho-mqtt/mqtt_ui/mqtt_topic_trie.c
+SRC_HOST_C += ./beken378/func/mbedtls/mbedtls-2.27.0/library/aes.c
+SRC_HOST_C += ./beken378/func/mbedtls/mbedtls-2.27.0/library/aesni.c
+SRC_HOST_C += ./beken378/func/mbedtls/mbedtls-2.27.0/library/padlock.c
+SRC_HOST_C += ./beken378/func/mbedtls/mbedtls-2.27.0/library/platform_util.c
+SRC_HOST_C += ./beken378/func/mbedtls/mbedtls-2.27.0/library/sha256.c
+SRC_HOST_C += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/portable/MemMang/heap_tlsf.c
+SRC_HOST_C += ./os/FreeRTOSv9.0.0/FreeRTOS/Source/portable/MemMang/heap_4.c
+
+# ecp_alt.c is built on the mbedtls of the non matter build, see ECP_INCLUDES
+SRC_ECP_C :=
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls/library/bignum.c
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls/library/ecdh.c
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls/library/ecdsa.c
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls/library/asn1parse.c
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls/library/asn1write.c
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls-port/src/ecp_alt.c
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls-port/src/ecp_curves_alt.c
+SRC_ECP_C += ./beken378/func/mbedtls/mbedtls-port/src/ecp_comb_alt.c
+SRC_HOST_C += $(SRC_ECP_C)
+
+SRC_BENCH_C :=
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_main.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_alloc.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_heap.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_rtos.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_kv.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_json.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_crypto.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_ecp.c
+SRC_BENCH_C += ./beken378/os/posix/bench/bench_mqtt.c
+
+SRC_TEST_C :=
+SRC_TEST_C += ./beken378/os/posix/test/test_main.c
+SRC_TEST_C += ./beken378/os/posix/test/test_kv_log.c
+
+OBJ_HOST_LIST = $(SRC_HOST_C:%.c=$(OBJ_DIR)/%.o)
+OBJ_BENCH_LIST = $(SRC_BENCH_C:%.c=$(OBJ_DIR)/%.o)
+OBJ_TEST_LIST = $(SRC_TEST_C:%.c=$(OBJ_DIR)/%.o)
+DEPENDENCY_LIST = $(SRC_HOST_C:%.c=$(OBJ_DIR)/%.d) $(SRC_BENCH_C:%.c=$(OBJ_DIR)/%.d) $(SRC_TEST_C:%.c=$(OBJ_DIR)/%.d)
+
+# -------------------------------------------------------------------
+# Compile options, no CFG_OS_FREERTOS: the posix port replaces it
+# -------------------------------------------------------------------
+CFLAGS =
+CFLAGS += -g -O2 -std=gnu99 -Wall -Wno-format -Wno-unknown-pragmas -fsigned-char -fno-strict-aliasing
+CFLAGS += -DCFG_HOST_POSIX=1
+
+LFLAGS =
+LFLAGS += -pthread -lm
+
+# heap_4 is linked next to heap_tlsf as the baseline of the heap suite
+HEAP4_RENAME :=
+HEAP4_RENAME += -DpvPortMalloc=heap4_pvPortMalloc
+HEAP4_RENAME += -DvPortFree=heap4_vPortFree
+HEAP4_RENAME += -DpvPortRealloc=heap4_pvPortRealloc
+HEAP4_RENAME += -DxPortGetFreeHeapSize=heap4_xPortGetFreeHeapSize
+HEAP4_RENAME += -DxPortGetMinimumEverFreeHeapSize=heap4_xPortGetMinimumEverFreeHeapSize
+HEAP4_RENAME += -DvPortInitialiseBlocks=heap4_vPortInitialiseBlocks
+
+$(OBJ_DIR)/./os/FreeRTOSv9.0.0/FreeRTOS/Source/portable/MemMang/heap_4.o: CFLAGS += $(HEAP4_RENAME)
+
+# the two mbedtls trees share header names, the ecp objects only see the old one
+ECP_INCLUDES :=
+ECP_INCLUDES += $(filter-out -I./beken378/func/mbedtls/mbedtls-2.27.0/include,$(INCLUDES))
+ECP_INCLUDES += -I./beken378/func/mbedtls/mbedtls/include
+ECP_INCLUDES += -I./beken378/func/mbedtls/mbedtls-port/inc
+
+OBJ_ECP_LIST = $(SRC_ECP_C:%.c=$(OBJ_DIR)/%.o) $(OBJ_DIR)/./beken378/os/posix/bench/bench_ecp.o
+$(OBJ_ECP_LIST): INCLUDES = $(ECP_INCLUDES)
+$(OBJ_ECP_LIST): CFLAGS += -DMBEDTLS_CONFIG_FILE=\"mbedtls_host_ecp_config.h\"
+
+# -------------------------------------------------------------------
+# Make rules
+# -------------------------------------------------------------------
+.PHONY: all host bench test clean
+
+all: host
+
+host: $(HOST_BENCH) $(HOST_TEST)
+
+bench: $(HOST_BENCH)
+	$(Q)$(HOST_BENCH) $(BENCH_ARGS)
+
+test: $(HOST_TEST)
+	$(Q)$(HOST_TEST) $(TEST_ARGS)
+
+$(HOST_LIB): $(OBJ_HOST_LIST)
+	$(Q)$(ECHO) "  $(GREEN)AR   $@$(NC)"
+	$(Q)$(AR) -rcs $@ $^
+
+$(HOST_BENCH): $(OBJ_BENCH_LIST) $(HOST_LIB)
+	$(Q)$(ECHO) "  $(GREEN)LD   $@$(NC)"
+	$(Q)$(CC) $(OBJ_BENCH_LIST) $(HOST_LIB) $(LFLAGS) -o $@
+
+$(HOST_TEST): $(OBJ_TEST_LIST) $(HOST_LIB)
+	$(Q)$(ECHO) "  $(GREEN)LD   $@$(NC)"
+	$(Q)$(CC) $(OBJ_TEST_LIST) $(HOST_LIB) $(LFLAGS) -o $@
+
+$(OBJ_DIR)/%.o: %.c
+	$(Q)if [ ! -d $(dir $@) ]; then mkdir -p $(dir $@); fi
+	$(Q)$(ECHO) "  $(GREEN)CC   $<$(NC)"
+	$(Q)$(CC) $(CFLAGS) $(INCLUDES) -c $< -o $@
+	$(Q)$(CC) $(CFLAGS) $(INCLUDES) -c $< -MM -MT $@ -MF $(patsubst %.o,%.d,$@)
+
+-include $(DEPENDENCY_LIST)
+
+clean:
+	$(Q)-rm -rf $(TARGET)
@@ -0,0 +1,831 @@
+/*
+ * Two level segregated fit (TLSF) implementation of pvPortMalloc() and
+ * vPortFree(), built instead of heap_4.c when CFG_HEAP_TLSF is set.
+ *
+ * Free blocks are kept in lists indexed by a first level (power of two) and a
+ * second level (linear subdivision) size class, with a bitmap per level.  A
+ * fitting block is found with two bit scans, and a freed block is merged with
+ * both physical neighbours through the previous block pointer kept in every
+ * header, so malloc and free take a bounded number of steps however
+ * fragmented the heap is.  Allocations are good fit rather than first fit,
+ * which keeps the large blocks intact longer than heap_4.c does.
+ *
+ * The SRAM heap and, on the PSRAM parts, the PSRAM heap are two pools sharing
+ * the same code.  The statistics and the caller tracking of heap_4.c are kept.
+ */
+#include "include.h"
+#include "mem_pub.h"
+
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#if CFG_MEM_DEBUG
+#include "doubly_list.h"
+#include "str_pub.h"
+#include "fake_clock_pub.h"
+#endif
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* Number of second level lists per first level class is 2^tlsfSL_INDEX_COUNT_LOG2. */
+#define tlsfSL_INDEX_COUNT_LOG2		( 4 )
+#define tlsfALIGN_SIZE_LOG2			( 3 )
+/* Largest block that can be managed is 2^tlsfFL_INDEX_MAX bytes. */
+#define tlsfFL_INDEX_MAX			( 22 )
+
+#define tlsfSL_INDEX_COUNT			( 1 << tlsfSL_INDEX_COUNT_LOG2 )
+#define tlsfFL_INDEX_SHIFT			( tlsfSL_INDEX_COUNT_LOG2 + tlsfALIGN_SIZE_LOG2 )
+#define tlsfFL_INDEX_COUNT			( tlsfFL_INDEX_MAX - tlsfFL_INDEX_SHIFT + 1 )
+/* Blocks below this size all live in first level 0, linearly spaced. */
+#define tlsfSMALL_BLOCK_SIZE		( ( size_t ) 1 << tlsfFL_INDEX_SHIFT )
+
+#if( portBYTE_ALIGNMENT != ( 1 << tlsfALIGN_SIZE_LOG2 ) )
+	#error tlsfALIGN_SIZE_LOG2 must match portBYTE_ALIGNMENT
+#endif
+
+/* Sizes are multiples of portBYTE_ALIGNMENT, the low bit marks a free block. */
+#define tlsfBLOCK_FREE_BIT			( ( size_t ) 1 )
+#define tlsfBLOCK_SIZE_MASK			( ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Allocate the memory for the heap. */
+#if configDYNAMIC_HEAP_SIZE
+uint8_t *ucHeap;
+#elif( configAPPLICATION_ALLOCATED_HEAP == 1 )
+	/* The application writer has already defined the array used for the RTOS
+	heap - probably so it can be placed in a special segment or address. */
+	extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Header placed in front of every block, free or allocated. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxPrevPhysBlock;	/*<< The block just below this one in memory, NULL for the first one. */
+	size_t xBlockSize;						/*<< The size of the block, header included, tlsfBLOCK_FREE_BIT when free. */
+#if CFG_MEM_DEBUG
+	struct list_head node;					/*<< linked to xUsed */
+	unsigned int leakTime;					/*<< the leak time (*1sec)*/
+	char funcName[16];						/*<< the function name */
+	unsigned int line;						/*<< the function line */
+	int wantedSize;							/*<< malloc size */
+#endif
+	/* Only valid while the block is free, they overlap the application data. */
+	struct A_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block of the same size class. */
+	struct A_BLOCK_LINK *pxPrevFreeBlock;	/*<< The previous free block of the same size class. */
+} BlockLink_t;
+
+/* One independent heap region. */
+typedef struct TLSF_POOL
+{
+	uint32_t ulFlBitmap;									/*<< Bit set for each first level with a free block. */
+	uint32_t ulSlBitmap[ tlsfFL_INDEX_COUNT ];				/*<< Bit set for each second level with a free block. */
+	BlockLink_t *pxBlocks[ tlsfFL_INDEX_COUNT ][ tlsfSL_INDEX_COUNT ];
+	uint8_t *pucStart;
+	uint8_t *pucEnd;
+	/* Keeps track of the number of free bytes remaining, but says nothing about
+	fragmentation. */
+	size_t xFreeBytesRemaining;
+	size_t xMinimumEverFreeBytesRemaining;
+} TlsfPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void );
+extern void bk_printf(const char *fmt, ...);
+
+/*-----------------------------------------------------------*/
+
+/* The size of the structure placed at the beginning of each allocated memory
+block must by correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* A free block must be able to hold its free list links. */
+static const size_t xMinimumBlockSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+static TlsfPool_t xSramPool;
+#if CFG_MEM_DEBUG
+static struct list_head xUsed;
+#endif
+
+#if ((CFG_SOC_NAME == SOC_BK7221U) || (CFG_SOC_NAME == SOC_BK7252N))
+uint8_t *psram_ucHeap;
+static TlsfPool_t xPsramPool;
+
+#if (CFG_SOC_NAME == SOC_BK7221U)
+#define PSRAM_START_ADDRESS    (void*)(0x00900000)
+#define PSRAM_END_ADDRESS      (void*)(0x00900000 + 256 * 1024)
+#elif(CFG_SOC_NAME == SOC_BK7252N)
+#define PSRAM_START_ADDRESS    (void*)(0x02000000)
+#define PSRAM_END_ADDRESS      (void*)(0x02000000 + 256 * 1024)
+#endif
+#endif
+
+/*-----------------------------------------------------------*/
+
+static inline int prvFls( size_t xValue )
+{
+	return ( int ) ( sizeof( unsigned int ) * 8 ) - 1 - __builtin_clz( ( unsigned int ) xValue );
+}
+
+static inline int prvFfs( uint32_t ulValue )
+{
+	return __builtin_ctz( ulValue );
+}
+
+static inline size_t prvBlockSize( const BlockLink_t *pxBlock )
+{
+	return pxBlock->xBlockSize & tlsfBLOCK_SIZE_MASK;
+}
+
+static inline BlockLink_t *prvBlockNext( const BlockLink_t *pxBlock )
+{
+	return ( BlockLink_t * ) ( ( ( uint8_t * ) pxBlock ) + prvBlockSize( pxBlock ) );
+}
+
+static inline int prvBlockIsFree( const BlockLink_t *pxBlock )
+{
+	return ( pxBlock->xBlockSize & tlsfBLOCK_FREE_BIT ) != 0;
+}
+
+/* Size class a block of xSize bytes is filed under. */
+static void prvMappingInsert( size_t xSize, int *pxFl, int *pxSl )
+{
+	int xFl, xSl;
+
+	if( xSize < tlsfSMALL_BLOCK_SIZE )
+	{
+		xFl = 0;
+		xSl = ( int ) xSize / ( tlsfSMALL_BLOCK_SIZE / tlsfSL_INDEX_COUNT );
+	}
+	else
+	{
+		xFl = prvFls( xSize );
+		xSl = ( int ) ( xSize >> ( xFl - tlsfSL_INDEX_COUNT_LOG2 ) ) ^ ( 1 << tlsfSL_INDEX_COUNT_LOG2 );
+		xFl -= ( tlsfFL_INDEX_SHIFT - 1 );
+	}
+
+	*pxFl = xFl;
+	*pxSl = xSl;
+}
+
+/* Smallest size class whose every block is at least xSize bytes. */
+static void prvMappingSearch( size_t xSize, int *pxFl, int *pxSl )
+{
+	if( xSize >= tlsfSMALL_BLOCK_SIZE )
+	{
+		xSize += ( ( size_t ) 1 << ( prvFls( xSize ) - tlsfSL_INDEX_COUNT_LOG2 ) ) - 1;
+	}
+
+	prvMappingInsert( xSize, pxFl, pxSl );
+}
+
+static BlockLink_t *prvSearchSuitableBlock( TlsfPool_t *pxPool, int *pxFl, int *pxSl )
+{
+	int xFl = *pxFl, xSl = *pxSl;
+	uint32_t ulSlMap, ulFlMap;
+
+	if( xFl >= tlsfFL_INDEX_COUNT )
+	{
+		return NULL;
+	}
+
+	ulSlMap = pxPool->ulSlBitmap[ xFl ] & ( ~( uint32_t ) 0 << xSl );
+	if( ulSlMap == 0 )
+	{
+		/* Nothing left in this first level, take the next non empty one. */
+		ulFlMap = ( xFl + 1 < 32 ) ? ( pxPool->ulFlBitmap & ( ~( uint32_t ) 0 << ( xFl + 1 ) ) ) : 0;
+		if( ulFlMap == 0 )
+		{
+			return NULL;
+		}
+
+		xFl = prvFfs( ulFlMap );
+		ulSlMap = pxPool->ulSlBitmap[ xFl ];
+	}
+
+	xSl = prvFfs( ulSlMap );
+	*pxFl = xFl;
+	*pxSl = xSl;
+
+	return pxPool->pxBlocks[ xFl ][ xSl ];
+}
+
+static void prvRemoveFreeBlock( TlsfPool_t *pxPool, BlockLink_t *pxBlock, int xFl, int xSl )
+{
+	BlockLink_t *pxPrev = pxBlock->pxPrevFreeBlock;
+	BlockLink_t *pxNext = pxBlock->pxNextFreeBlock;
+
+	if( pxNext != NULL )
+	{
+		pxNext->pxPrevFreeBlock = pxPrev;
+	}
+
+	if( pxPrev != NULL )
+	{
+		pxPrev->pxNextFreeBlock = pxNext;
+	}
+	else
+	{
+		pxPool->pxBlocks[ xFl ][ xSl ] = pxNext;
+		if( pxNext == NULL )
+		{
+			pxPool->ulSlBitmap[ xFl ] &= ~( ( uint32_t ) 1 << xSl );
+			if( pxPool->ulSlBitmap[ xFl ] == 0 )
+			{
+				pxPool->ulFlBitmap &= ~( ( uint32_t ) 1 << xFl );
+			}
+		}
+	}
+}
+
+static void prvUnlinkFreeBlock( TlsfPool_t *pxPool, BlockLink_t *pxBlock )
+{
+	int xFl, xSl;
+
+	prvMappingInsert( prvBlockSize( pxBlock ), &xFl, &xSl );
+	prvRemoveFreeBlock( pxPool, pxBlock, xFl, xSl );
+}
+
+static void prvInsertFreeBlock( TlsfPool_t *pxPool, BlockLink_t *pxBlock )
+{
+	int xFl, xSl;
+	BlockLink_t *pxHead;
+
+	prvMappingInsert( prvBlockSize( pxBlock ), &xFl, &xSl );
+	pxHead = pxPool->pxBlocks[ xFl ][ xSl ];
+
+	pxBlock->pxPrevFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxHead;
+	if( pxHead != NULL )
+	{
+		pxHead->pxPrevFreeBlock = pxBlock;
+	}
+
+	pxPool->pxBlocks[ xFl ][ xSl ] = pxBlock;
+	pxPool->ulFlBitmap |= ( uint32_t ) 1 << xFl;
+	pxPool->ulSlBitmap[ xFl ] |= ( uint32_t ) 1 << xSl;
+}
+
+/* Give the tail of an allocated block back to the pool if it is big enough. */
+static void prvTrimBlock( TlsfPool_t *pxPool, BlockLink_t *pxBlock, size_t xWantedSize )
+{
+	BlockLink_t *pxRemain, *pxNext;
+	size_t xSize = prvBlockSize( pxBlock );
+
+	if( ( xSize - xWantedSize ) >= xMinimumBlockSize )
+	{
+		pxRemain = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+		configASSERT( ( ( ( size_t ) pxRemain ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+		pxRemain->xBlockSize = ( xSize - xWantedSize ) | tlsfBLOCK_FREE_BIT;
+		pxRemain->pxPrevPhysBlock = pxBlock;
+		pxBlock->xBlockSize = xWantedSize | ( pxBlock->xBlockSize & tlsfBLOCK_FREE_BIT );
+
+		pxNext = prvBlockNext( pxRemain );
+		pxNext->pxPrevPhysBlock = pxRemain;
+
+		/* The next block is allocated or the end marker, no merge to do. */
+		pxPool->xFreeBytesRemaining += prvBlockSize( pxRemain );
+		prvInsertFreeBlock( pxPool, pxRemain );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+
+/* Header size and alignment added, 0 when the request can not be served. */
+static size_t prvAdjustSize( size_t xWantedSize )
+{
+	if( xWantedSize > ( ( size_t ) 1 << tlsfFL_INDEX_MAX ) )
+	{
+		return 0;
+	}
+
+	xWantedSize += xHeapStructSize;
+	if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+	{
+		/* Byte alignment required. */
+		xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+	}
+
+	if( xWantedSize < xMinimumBlockSize )
+	{
+		xWantedSize = xMinimumBlockSize;
+	}
+
+	return xWantedSize;
+}
+
+static void *prvPoolMalloc( TlsfPool_t *pxPool, size_t xWantedSize )
+{
+	BlockLink_t *pxBlock;
+	void *pvReturn = NULL;
+	int xFl, xSl;
+
+	xWantedSize = prvAdjustSize( xWantedSize );
+	if( ( xWantedSize > 0 ) && ( xWantedSize <= pxPool->xFreeBytesRemaining ) )
+	{
+		prvMappingSearch( xWantedSize, &xFl, &xSl );
+		pxBlock = prvSearchSuitableBlock( pxPool, &xFl, &xSl );
+
+		if( pxBlock != NULL )
+		{
+			configASSERT( prvBlockSize( pxBlock ) >= xWantedSize );
+			prvRemoveFreeBlock( pxPool, pxBlock, xFl, xSl );
+
+			pxPool->xFreeBytesRemaining -= prvBlockSize( pxBlock );
+			pxBlock->xBlockSize &= ~tlsfBLOCK_FREE_BIT;
+			prvTrimBlock( pxPool, pxBlock, xWantedSize );
+
+			if( pxPool->xFreeBytesRemaining < pxPool->xMinimumEverFreeBytesRemaining )
+			{
+				pxPool->xMinimumEverFreeBytesRemaining = pxPool->xFreeBytesRemaining;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+#if CFG_MEM_DEBUG
+			list_add_tail(&pxBlock->node, &xUsed);
+#endif
+
+			/* Return the memory space pointed to - jumping over the
+			BlockLink_t header at its start. */
+			pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceMALLOC( pvReturn, xWantedSize );
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+
+static void prvPoolFree( TlsfPool_t *pxPool, BlockLink_t *pxBlock )
+{
+	BlockLink_t *pxNeighbour;
+
+	pxPool->xFreeBytesRemaining += prvBlockSize( pxBlock );
+	pxBlock->xBlockSize |= tlsfBLOCK_FREE_BIT;
+
+	/* Merge with the block below. */
+	pxNeighbour = pxBlock->pxPrevPhysBlock;
+	if( ( pxNeighbour != NULL ) && prvBlockIsFree( pxNeighbour ) )
+	{
+		prvUnlinkFreeBlock( pxPool, pxNeighbour );
+		pxNeighbour->xBlockSize += prvBlockSize( pxBlock );
+		pxBlock = pxNeighbour;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Merge with the block above, the end marker is never free. */
+	pxNeighbour = prvBlockNext( pxBlock );
+	if( prvBlockIsFree( pxNeighbour ) )
+	{
+		prvUnlinkFreeBlock( pxPool, pxNeighbour );
+		pxBlock->xBlockSize += prvBlockSize( pxNeighbour );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvBlockNext( pxBlock )->pxPrevPhysBlock = pxBlock;
+	prvInsertFreeBlock( pxPool, pxBlock );
+}
+
+static void *prvPoolRealloc( TlsfPool_t *pxPool, void *pv, size_t xWantedSize )
+{
+	BlockLink_t *pxLink, *pxNext;
+#if CFG_MEM_DEBUG
+	BlockLink_t *pxNewLink;
+#endif
+	size_t xSize, xAdjusted;
+	void *pvReturn;
+
+	pxLink = ( void * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
+	xSize = prvBlockSize( pxLink );
+	if( ( xSize - xHeapStructSize ) >= xWantedSize ) // have enough memory don't need realloc
+	{
+		return pv;
+	}
+
+	xAdjusted = prvAdjustSize( xWantedSize );
+	if( xAdjusted == 0 )
+	{
+		return NULL;
+	}
+
+	/* Grow in place when the block above is free and big enough. */
+	pxNext = prvBlockNext( pxLink );
+	if( prvBlockIsFree( pxNext ) && ( ( xSize + prvBlockSize( pxNext ) ) >= xAdjusted ) )
+	{
+		prvUnlinkFreeBlock( pxPool, pxNext );
+		pxPool->xFreeBytesRemaining -= prvBlockSize( pxNext );
+		pxLink->xBlockSize += prvBlockSize( pxNext );
+		prvBlockNext( pxLink )->pxPrevPhysBlock = pxLink;
+		prvTrimBlock( pxPool, pxLink, xAdjusted );
+
+		if( pxPool->xFreeBytesRemaining < pxPool->xMinimumEverFreeBytesRemaining )
+		{
+			pxPool->xMinimumEverFreeBytesRemaining = pxPool->xFreeBytesRemaining;
+		}
+#if CFG_MEM_DEBUG
+		pxLink->wantedSize = xWantedSize;
+#endif
+
+		return pv;
+	}
+
+	/* Otherwise move it, pv stays valid if that fails. */
+	pvReturn = prvPoolMalloc( pxPool, xWantedSize );
+	if( pvReturn != NULL )
+	{
+		os_memcpy( pvReturn, pv, xSize - xHeapStructSize );
+#if CFG_MEM_DEBUG
+		/* the moved block keeps the caller of the original allocation */
+		pxNewLink = ( BlockLink_t * ) ( ( ( uint8_t * ) pvReturn ) - xHeapStructSize );
+		pxNewLink->leakTime = pxLink->leakTime;
+		os_memcpy( pxNewLink->funcName, pxLink->funcName, sizeof( pxNewLink->funcName ) );
+		pxNewLink->line = pxLink->line;
+		pxNewLink->wantedSize = xWantedSize;
+		list_del(&pxLink->node);
+#endif
+		prvPoolFree( pxPool, pxLink );
+	}
+
+	return pvReturn;
+}
+
+static TlsfPool_t *prvPoolOf( void *pv )
+{
+#if ((CFG_SOC_NAME == SOC_BK7221U) || (CFG_SOC_NAME == SOC_BK7252N))
+	if( ( ( uint8_t * ) pv >= xPsramPool.pucStart ) && ( ( uint8_t * ) pv < xPsramPool.pucEnd ) )
+	{
+		return &xPsramPool;
+	}
+#endif
+
+	return &xSramPool;
+}
+
+/*-----------------------------------------------------------*/
+
+#if ((CFG_SOC_NAME == SOC_BK7221U) || (CFG_SOC_NAME == SOC_BK7252N))
+#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+void *psram_malloc_cm(const char *call_func_name, int line, size_t xWantedSize, int need_zero )
+#else
+void *psram_malloc( size_t xWantedSize )
+#endif
+{
+	void *pvReturn = NULL;
+
+	if (xWantedSize == 0)
+		xWantedSize = 4;
+
+	vTaskSuspendAll();
+	if( xSramPool.pucStart == NULL )
+	{
+		prvHeapInit();
+	}
+	pvReturn = prvPoolMalloc( &xPsramPool, xWantedSize );
+	#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+	{
+	if(pvReturn && call_func_name) {
+	BlockLink_t *pxLink = (BlockLink_t *)((u8*)pvReturn - xHeapStructSize);
+	bk_printf("\r\nm:%p,%d|%s,%d\r\n", pxLink, prvBlockSize(pxLink), call_func_name, line);
+	}
+	}
+	#endif
+	( void ) xTaskResumeAll();
+
+	#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+	if(pvReturn && need_zero)
+		os_memset(pvReturn, 0, xWantedSize);
+	#endif
+	return pvReturn;
+}
+
+void *psram_realloc( void *pv, size_t xWantedSize )
+{
+	void *pvReturn;
+
+	if (pv == NULL)
+		return psram_malloc(xWantedSize);
+
+	vTaskSuspendAll();
+	pvReturn = prvPoolRealloc( &xPsramPool, pv, xWantedSize );
+	( void ) xTaskResumeAll();
+
+	return pvReturn;
+}
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+void *pvPortMalloc_cm(const char *call_func_name, int line, size_t xWantedSize, int need_zero )
+#else
+void *pvPortMalloc( size_t xWantedSize )
+#endif
+{
+	void *pvReturn = NULL;
+
+	if (xWantedSize == 0)
+		xWantedSize = 4;
+
+	vTaskSuspendAll();
+	/* If this is the first call to malloc then the heap will require
+	initialisation to setup the list of free blocks. */
+	if( xSramPool.pucStart == NULL )
+	{
+		prvHeapInit();
+	}
+	pvReturn = prvPoolMalloc( &xSramPool, xWantedSize );
+	#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+	if( pvReturn )
+	{
+		BlockLink_t *pxLink = (BlockLink_t *)((u8*)pvReturn - xHeapStructSize);
+		if(call_func_name) {
+#if OSMALLOC_STATISTICAL
+			bk_printf("\r\nm:%p,%d|%s,%d\r\n", pxLink, prvBlockSize(pxLink), call_func_name, line);
+#endif
+		}
+#if CFG_MEM_DEBUG
+		pxLink->leakTime = fclk_get_second();
+		os_strlcpy(pxLink->funcName, call_func_name, sizeof(pxLink->funcName) - 1);
+		pxLink->line = line;
+		pxLink->wantedSize = xWantedSize;
+#endif
+	}
+	#endif
+	( void ) xTaskResumeAll();
+
+	#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+	if(pvReturn && need_zero)
+		os_memset(pvReturn, 0, xWantedSize);
+	#endif
+	return pvReturn;
+}
+
+/*-----------------------------------------------------------*/
+#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+void *vPortFree_cm(const char *call_func_name, int line, void *pv )
+#else
+void vPortFree( void *pv )
+#endif
+{
+	uint8_t *puc = ( uint8_t * ) pv;
+	BlockLink_t *pxLink;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have an BlockLink_t structure immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( !prvBlockIsFree( pxLink ) );
+
+		if( !prvBlockIsFree( pxLink ) )
+		{
+			vTaskSuspendAll();
+#if OSMALLOC_STATISTICAL
+			if (call_func_name)
+			{
+				bk_printf("\r\nf:%p,%d|%s,%d\r\n", pxLink, prvBlockSize(pxLink), call_func_name, line);
+			}
+#endif
+#if CFG_MEM_DEBUG
+			list_del(&pxLink->node);
+			pxLink->leakTime = 0;
+			pxLink->funcName[0] = 0;
+			pxLink->line = 0;
+#endif
+			traceFREE( pv, prvBlockSize( pxLink ) );
+			prvPoolFree( prvPoolOf( pxLink ), pxLink );
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+	return NULL;
+#endif
+}
+
+#if OSMALLOC_STATISTICAL || CFG_MEM_DEBUG
+void printLeakMem(int leaktime)
+{
+#if CFG_MEM_DEBUG
+	BlockLink_t *pxLink;
+	UINT32 now = fclk_get_second();
+
+	vTaskSuspendAll();
+
+	list_for_each_entry(pxLink, &xUsed, node) {
+		if (now - pxLink->leakTime > leaktime)
+			bk_printf("%d,0x%x,%d,%s,%d\r\n", now - pxLink->leakTime,
+				(u8*)pxLink + xHeapStructSize, pxLink->wantedSize,
+				pxLink->funcName, pxLink->line);
+	}
+
+	xTaskResumeAll();
+#endif
+}
+#endif
+
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+#if ((CFG_SOC_NAME == SOC_BK7221U) || (CFG_SOC_NAME == SOC_BK7252N))
+	return xSramPool.xFreeBytesRemaining + xPsramPool.xFreeBytesRemaining;
+#else
+	return xSramPool.xFreeBytesRemaining;
+#endif
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+#if ((CFG_SOC_NAME == SOC_BK7221U) || (CFG_SOC_NAME == SOC_BK7252N))
+	return xSramPool.xMinimumEverFreeBytesRemaining + xPsramPool.xMinimumEverFreeBytesRemaining;
+#else
+	return xSramPool.xMinimumEverFreeBytesRemaining;
+#endif
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+#if configDYNAMIC_HEAP_SIZE
+extern unsigned char _empty_ram;
+
+#define HEAP_START_ADDRESS    (void*)&_empty_ram
+#if (CFG_SOC_NAME == SOC_BK7231N)
+#define HEAP_END_ADDRESS      (void*)(0x00400000 + 192 * 1024)
+#else
+#define HEAP_END_ADDRESS      (void*)(0x00400000 + 256 * 1024)
+#endif
+
+static void *prvHeapGetHeaderPointer(void)
+{
+	return (void *)HEAP_START_ADDRESS;
+}
+
+size_t prvHeapGetTotalSize(void)
+{
+	ASSERT(HEAP_END_ADDRESS > HEAP_START_ADDRESS);
+	return (HEAP_END_ADDRESS - HEAP_START_ADDRESS);
+}
+#endif
+
+/* One free block spanning the region, closed by an allocated end marker. */
+static void prvPoolInit( TlsfPool_t *pxPool, uint8_t *pucHeap, size_t xTotalHeapSize )
+{
+	BlockLink_t *pxFirstFreeBlock, *pxEnd;
+	size_t uxAddress;
+
+	os_memset( pxPool, 0, sizeof( TlsfPool_t ) );
+
+	/* Ensure the heap starts on a correctly aligned boundary. */
+	uxAddress = ( size_t ) pucHeap;
+
+	if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		uxAddress += ( portBYTE_ALIGNMENT - 1 );
+		uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xTotalHeapSize -= uxAddress - ( size_t ) pucHeap;
+	}
+
+	pxFirstFreeBlock = ( void * ) uxAddress;
+	pxPool->pucStart = ( uint8_t * ) uxAddress;
+	pxPool->pucEnd = ( uint8_t * ) uxAddress + xTotalHeapSize;
+
+	/* pxEnd marks the end of the heap space, it only needs the size field. */
+	uxAddress += xTotalHeapSize;
+	uxAddress -= xHeapStructSize;
+	uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	pxEnd = ( void * ) uxAddress;
+
+	pxFirstFreeBlock->pxPrevPhysBlock = NULL;
+	pxFirstFreeBlock->xBlockSize = ( uxAddress - ( size_t ) pxFirstFreeBlock ) | tlsfBLOCK_FREE_BIT;
+	/* 2^tlsfFL_INDEX_MAX itself would map past the last first level. */
+	configASSERT( prvBlockSize( pxFirstFreeBlock ) < ( ( size_t ) 1 << tlsfFL_INDEX_MAX ) );
+
+	pxEnd->pxPrevPhysBlock = pxFirstFreeBlock;
+	pxEnd->xBlockSize = 0;
+
+	/* Only one block exists - and it covers the entire usable heap space. */
+	pxPool->xFreeBytesRemaining = prvBlockSize( pxFirstFreeBlock );
+	pxPool->xMinimumEverFreeBytesRemaining = pxPool->xFreeBytesRemaining;
+	prvInsertFreeBlock( pxPool, pxFirstFreeBlock );
+}
+
+static void prvHeapInit( void )
+{
+	size_t xTotalHeapSize;
+
+	#if configDYNAMIC_HEAP_SIZE
+	xTotalHeapSize = prvHeapGetTotalSize();
+	ucHeap = prvHeapGetHeaderPointer();
+
+	bk_printf("prvHeapInit-start addr:0x%x, size:%d\r\n", ucHeap, xTotalHeapSize);
+	#else
+	xTotalHeapSize = configTOTAL_HEAP_SIZE;
+	#endif
+
+	prvPoolInit( &xSramPool, ucHeap, xTotalHeapSize );
+
+#if ((CFG_SOC_NAME == SOC_BK7221U) || (CFG_SOC_NAME == SOC_BK7252N))
+	xTotalHeapSize = PSRAM_END_ADDRESS - PSRAM_START_ADDRESS;
+	psram_ucHeap = PSRAM_START_ADDRESS;
+
+	bk_printf("prvHeapInit-start addr:0x%x, size:%d\r\n", psram_ucHeap, xTotalHeapSize);
+	prvPoolInit( &xPsramPool, psram_ucHeap, xTotalHeapSize );
+#endif
+
+#if CFG_MEM_DEBUG
+	INIT_LIST_HEAD(&xUsed);
+#endif
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortRealloc( void *pv, size_t xWantedSize )
+{
+	void *pvReturn;
+
+#if ((CFG_SOC_NAME == SOC_BK7221U) || (CFG_SOC_NAME == SOC_BK7252N))
+	if ((pv != NULL) && (prvPoolOf(pv) == &xPsramPool))
+	{
+		return psram_realloc(pv, xWantedSize);
+	}
+	if (pv == NULL)
+	{
+		return psram_malloc(xWantedSize);
+	}
+#else
+	if (pv == NULL)
+		return pvPortMalloc(xWantedSize);
+#endif
+
+	vTaskSuspendAll();
+	pvReturn = prvPoolRealloc( &xSramPool, pv, xWantedSize );
+	( void ) xTaskResumeAll();
+
+	return pvReturn;
+}